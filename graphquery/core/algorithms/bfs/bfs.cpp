@@ -18,14 +18,12 @@ graphquery::database::analytic::CGraphAlgorithmBFS::compute(storage::IModel * gr
     const auto n_v                  = graph->get_num_vertices();
     const auto n_e                  = graph->get_num_edges();
     const auto sparse               = new storage::Id_t[n_v];
-    const std::shared_ptr inv_graph = graph->make_inverse_graph();
-
     const auto n_total_v            = graph->get_total_num_vertices();
 
     graph->calc_vertex_sparse_map(sparse);
     m_log_system->debug(fmt::format("Source: {}", source));
 
-    if (source >= n_total_v)
+    if (source >= static_cast<storage::Id_t>(n_total_v))
         return 0.0;
 
     std::vector<int64_t> parent = init_parent(graph, sparse, n_v, n_total_v);
@@ -56,7 +54,7 @@ graphquery::database::analytic::CGraphAlgorithmBFS::compute(storage::IModel * gr
             do
             {
                 old_awake_count = awake_count;
-                awake_count     = bu_step(inv_graph, parent, front, curr);
+                awake_count     = bu_step(graph, parent, front, curr);
                 front.swap(curr);
             } while ((awake_count >= old_awake_count) || (awake_count > n_v / beta));
             bitset_to_queue(graph, front, queue);
@@ -126,28 +124,30 @@ graphquery::database::analytic::CGraphAlgorithmBFS::bitset_to_queue(storage::IMo
 }
 
 int64_t
-graphquery::database::analytic::CGraphAlgorithmBFS::bu_step(const std::shared_ptr<std::vector<std::vector<int64_t>>> & inv_graph,
+graphquery::database::analytic::CGraphAlgorithmBFS::bu_step(storage::IModel * graph,
                                                             std::vector<int64_t> & parent,
                                                             const utils::CBitset<> & front,
                                                             utils::CBitset<> & next) noexcept
 {
-    int64_t awake_count = 0;
+    int64_t awake_count  = 0;
+    const auto n_total_v = graph->get_total_num_vertices();
     next.reset();
-#pragma omp parallel for reduction(+ : awake_count) schedule(dynamic, 1024) default(none) shared(inv_graph, parent, front, next)
-    for (int64_t dst = 0; dst < inv_graph->size(); dst++)
+#pragma omp parallel for reduction(+ : awake_count) schedule(dynamic, 1024) default(none) shared(graph, parent, front, next, n_total_v)
+    for (int64_t dst = 0; dst < n_total_v; dst++)
     {
         if (parent[dst] < 0)
         {
-            for (const int64_t src : (*inv_graph)[dst])
-            {
-                if (front.get(src))
-                {
-                    parent[dst] = src;
-                    awake_count++;
-                    next.set(dst);
-                    break;
-                }
-            }
+            graph->dst_edgemap(dst,
+                               [&parent, &front, &next, &awake_count](const int64_t src, const int64_t v) -> bool
+                               {
+                                   if (!front.get(src))
+                                       return false;
+
+                                   parent[v] = src;
+                                   awake_count++;
+                                   next.set(v);
+                                   return true;
+                               });
         }
     }
     return awake_count;
@@ -24,7 +24,7 @@ namespace graphquery::database::analytic
         [[nodiscard]] double compute(storage::IModel *) const noexcept override;
 
       private:
-        static int64_t bu_step(const std::shared_ptr<std::vector<std::vector<int64_t>>> & inv_graph,
+        static int64_t bu_step(storage::IModel * graph,
                                std::vector<int64_t> & parent,
                                const utils::CBitset<uint64_t> & front,
                                utils::CBitset<uint64_t> & next) noexcept;
@@ -28,7 +28,7 @@ graphquery::database::analytic::CGraphAlgorithmSCC::compute(storage::IModel * gr
         instack[i]   = false;
     }
 
-    for (storage::Id_t i = 0; i < n_total; i++)
+    for (storage::Id_t i = 0; i < static_cast<storage::Id_t>(n_total); i++)
     {
         if (disc[sparse[i]] == -1)
             dfs(graph, sparse[i]);
@@ -71,7 +71,7 @@ graphquery::database::analytic::CGraphAlgorithmSCC::dfs(storage::IModel * graph,
             st.pop_back();
             instack[top]   = false;
             represent[top] = v;
-            if (top == v)
+            if (static_cast<storage::Id_t>(top) == v)
                 break;
         }
     }
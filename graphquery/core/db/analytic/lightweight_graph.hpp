@@ -21,6 +21,7 @@ namespace graphquery::database::analytic
         int64_t get_total_num_vertices() noexcept override;
         void edgemap(const std::unique_ptr<IRelax> & relax) override;
         void src_edgemap(storage::Id_t _src, const std::function<void(int64_t src, int64_t dst)> &) override;
+        void dst_edgemap(storage::Id_t _dst, const std::function<bool(int64_t src, int64_t dst)> &) override;
         std::unique_ptr<std::vector<std::vector<int64_t>>> make_inverse_graph() noexcept override;
 
     private:
@@ -31,6 +32,7 @@ namespace graphquery::database::analytic
         uint32_t num_edges;
         std::vector<uint32_t> indegree;
         std::vector<std::vector<storage::Id_t>> m_graph;
+        std::vector<std::vector<storage::Id_t>> m_inv_graph;
     };
 
     inline
@@ -67,11 +69,13 @@ namespace graphquery::database::analytic
     CLightWeightGraphModel::build_graph(const std::vector<storage::ILPGModel::SEdge_t> & edges) noexcept
     {
         m_graph.resize(n);
+        m_inv_graph.resize(n);
         indegree.resize(n);
 
         for(const storage::ILPGModel::SEdge_t & edge : edges)
         {
             m_graph[edge.src].emplace_back(edge.dst);
+            m_inv_graph[edge.dst].emplace_back(edge.src);
             indegree[edge.dst]++;
         }
 
@@ -152,15 +156,22 @@ namespace graphquery::database::analytic
             func(_src, dst);
     }
 
+    inline void
+    CLightWeightGraphModel::dst_edgemap(const storage::Id_t _dst, const std::function<bool(int64_t src, int64_t dst)> & func)
+    {
+        for(const auto src : m_inv_graph[_dst])
+            if(func(src, _dst))
+                return;
+    }
+
     inline std::unique_ptr<std::vector<std::vector<int64_t>>>
     CLightWeightGraphModel::make_inverse_graph() noexcept
     {
         auto inv_graph = std::make_unique<std::vector<std::vector<int64_t>>>();
         inv_graph->resize(n);
 
-        for(storage::Id_t src = 0; src < n; src++)
-            for(storage::Id_t dst = 0; dst < m_graph[src].size(); dst++)
-                (*inv_graph)[dst].emplace_back(src);
+        for(storage::Id_t dst = 0; dst < n; dst++)
+            (*inv_graph)[dst].assign(m_inv_graph[dst].begin(), m_inv_graph[dst].end());
 
         return inv_graph;
     }
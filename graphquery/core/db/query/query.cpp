@@ -21,16 +21,48 @@ namespace
         //~ MATCH (:Person {id: $personId })-[:KNOWS]-(friend:Person)
         _friends = graph->get_edge_dst_vertices(_person_id, "knows", "Person");
 
-        //~ (friend:Person)<-[:HAS_CREATOR]-(message:Message)
-        message_creators = graph->get_edges("Message", "hasCreator");
+        //~ (friend:Person)<-[:HAS_CREATOR]-(message:Message), newest first through the temporal index when declared.
+        std::vector<graphquery::database::storage::ILPGModel::STemporalEdge_t> recent_messages;
+        bool indexed = true;
 
-        res.reserve(20);
-        for(size_t amount = 0, i = 0; amount < limit_size && i < message_creators.size(); i++)
+        for (const auto friend_offset : _friends)
         {
-            if (_friends.contains(message_creators[i].dst))
+            const auto friend_id = graph->get_vertex_id(friend_offset);
+
+            if (!friend_id.has_value())
+                continue;
+
+            auto friend_messages = graph->get_recent_edges(*friend_id, "Message", "hasCreator", true, limit_size, _max_date - 1);
+
+            if (!(indexed = friend_messages.has_value()))
+                break;
+
+            recent_messages.insert(recent_messages.end(), friend_messages->begin(), friend_messages->end());
+        }
+
+        res.reserve(limit_size);
+        if (indexed)
+        {
+            const auto amount = std::min(limit_size, recent_messages.size());
+            std::partial_sort(recent_messages.begin(),
+                              recent_messages.begin() + static_cast<int64_t>(amount),
+                              recent_messages.end(),
+                              [](const auto & a, const auto & b) -> bool { return a.timestamp > b.timestamp; });
+
+            for (size_t i = 0; i < amount; i++)
+                res.emplace_back(recent_messages[i].edge);
+        }
+        else
+        {
+            message_creators = graph->get_edges("Message", "hasCreator");
+
+            for (size_t amount = 0, i = 0; amount < limit_size && i < message_creators.size(); i++)
             {
-                res.emplace_back(message_creators[i]);
-                amount++;
+                if (_friends.contains(message_creators[i].dst))
+                {
+                    res.emplace_back(message_creators[i]);
+                    amount++;
+                }
             }
         }
 
@@ -38,16 +70,25 @@ namespace
         std::vector<std::map<std::string, std::string>> properties_map;
         properties_map.resize(res.size());
 
+        const auto creation_date_column = graph->get_property_column("Message", "creationDate");
+
         for (size_t i = 0; i < std::min(limit_size, res.size()); i++)
         {
-            auto & edge          = res[i];
+            auto & edge = res[i];
+
+            //~ WHERE message.creationDate < $maxDate, read from the column when declared before building the maps.
+            if (creation_date_column.has_value())
+            {
+                if (const auto creation_date = graph->get_column_value(*creation_date_column, edge.src); !creation_date.has_value() || *creation_date >= _max_date)
+                    continue;
+            }
+
             auto message_props   = graph->get_properties_by_id_map(edge.src);
             auto friend_props    = graph->get_properties_by_id_map(edge.dst);
             auto w_message_props = std::unordered_map<std::string, std::string>();
             auto w_friend_props  = std::unordered_map<std::string, std::string>();
 
-            //~ WHERE message.creationDate < $maxDate
-            if (std::stol(message_props.at("creationDate")) >= _max_date)
+            if (!creation_date_column.has_value() && std::stol(message_props.at("creationDate")) >= _max_date)
                 continue;
 
             w_message_props["postOrCommendId"]           = std::to_string(edge.src);
@@ -77,8 +118,39 @@ namespace
         uniq_messages.reserve(person_comments.size());
         std::for_each(person_comments.begin(), person_comments.end(), [&uniq_messages](const graphquery::database::storage::ILPGModel::SEdge_t & edge) { uniq_messages.insert(edge.src); });
 
-        //~ (start:Person {id: $personId})<-[:HAS_CREATOR]-(:Message)<-[:REPLY_OF]-(comment:Comment)
-        comments = graph->get_edges("Comment", "replyOf", [&uniq_messages](const graphquery::database::storage::ILPGModel::SEdge_t & edge) -> bool { return uniq_messages.contains(edge.dst); });
+        //~ (start:Person {id: $personId})<-[:HAS_CREATOR]-(:Message)<-[:REPLY_OF]-(comment:Comment), newest first through the temporal index when declared.
+        std::vector<graphquery::database::storage::ILPGModel::STemporalEdge_t> recent_comments;
+        bool indexed = true;
+
+        for (const auto message_offset : uniq_messages)
+        {
+            const auto message_id = graph->get_vertex_id(message_offset);
+
+            if (!message_id.has_value())
+                continue;
+
+            auto message_comments = graph->get_recent_edges(*message_id, "Comment", "replyOf", true, limit_size);
+
+            if (!(indexed = message_comments.has_value()))
+                break;
+
+            recent_comments.insert(recent_comments.end(), message_comments->begin(), message_comments->end());
+        }
+
+        if (indexed)
+        {
+            const auto amount = std::min(limit_size, recent_comments.size());
+            std::partial_sort(recent_comments.begin(),
+                              recent_comments.begin() + static_cast<int64_t>(amount),
+                              recent_comments.end(),
+                              [](const auto & a, const auto & b) -> bool { return a.timestamp > b.timestamp; });
+
+            comments.reserve(amount);
+            for (size_t i = 0; i < amount; i++)
+                comments.emplace_back(recent_comments[i].edge);
+        }
+        else
+            comments = graph->get_edges("Comment", "replyOf", [&uniq_messages](const graphquery::database::storage::ILPGModel::SEdge_t & edge) -> bool { return uniq_messages.contains(edge.dst); });
 
         comment_creators.reserve(comments.size());
 
@@ -144,12 +216,17 @@ namespace
     void _interaction_delete_7(graphquery::database::storage::ILPGModel * graph, const graphquery::database::storage::Id_t _comment_id) noexcept
     {
         auto subcomments = graph->get_edges("Comment", "replyOf", _comment_id);
+        auto transaction = graph->begin_transaction();
 
+        //~ Replies are removed together, such that a crash never leaves part of the thread deleted.
         for (const auto & edge : subcomments)
         {
             auto src_edge_id = graph->get_vertex_id(edge.src);
-            graph->rm_vertex(*src_edge_id);
+            transaction.rm_vertex(*src_edge_id);
         }
+
+        //~ A failing removal reverts the others, which the model reports.
+        (void) graph->commit_transaction(transaction);
     }
 
     void _interaction_delete_8(graphquery::database::storage::ILPGModel * graph,
@@ -163,9 +240,20 @@ namespace
     {
         constexpr size_t message_limit = 10;
 
-        //~ MATCH (:Person {id: $personId})<-[:HAS_CREATOR]-(message)
-        auto person_comments = graph->get_edges("Message", "hasCreator", _person_id);
-        person_comments.resize(message_limit);
+        //~ MATCH (:Person {id: $personId})<-[:HAS_CREATOR]-(message), newest first through the temporal index when declared.
+        std::vector<graphquery::database::storage::ILPGModel::SEdge_t> person_comments = {};
+
+        if (auto recent_messages = graph->get_recent_edges(_person_id, "Message", "hasCreator", true, message_limit); recent_messages.has_value())
+        {
+            person_comments.reserve(recent_messages->size());
+            for (const auto & message : *recent_messages)
+                person_comments.emplace_back(message.edge);
+        }
+        else
+        {
+            person_comments = graph->get_edges("Message", "hasCreator", _person_id);
+            person_comments.resize(std::min(message_limit, person_comments.size()));
+        }
 
         //~ MATCH (message)-[:REPLY_OF*0..]->(post:Post)
         std::vector<graphquery::database::storage::ILPGModel::SEdge_t> posts = {};
@@ -38,13 +38,18 @@ namespace graphquery::database::storage
      * property
      * master
      */
-    typedef uint32_t Id_t;
+#if defined(GRAPHQUERY_64BIT_IDS)
+    typedef uint64_t Id_t; //~ Offsets and identifiers beyond 2^32 blocks, at the cost of wider blocks.
+#else
+    typedef uint32_t Id_t; //~ Compact offsets and identifiers, bounding each block file to 2^32 blocks.
+#endif
     typedef std::make_signed<Id_t> uId_t;
 
     //~ Current configuration of database and graph entry.
-    static constexpr uint8_t CFG_LPG_LABEL_LENGTH          = _align_(20); //~ Length for a graph entry name
-    static constexpr uint8_t CFG_LPG_PROPERTY_KEY_LENGTH   = _align_(15); //~ Length for a property key name
-    static constexpr uint8_t CFG_LPG_PROPERTY_VALUE_LENGTH = _align_(30); //~ Length for a property value name
+    static constexpr uint8_t CFG_LPG_LABEL_LENGTH           = _align_(20); //~ Length for a graph entry name
+    static constexpr uint8_t CFG_LPG_PROPERTY_KEY_LENGTH    = _align_(15); //~ Length for a property key name
+    static constexpr uint8_t CFG_LPG_PROPERTY_INLINE_LENGTH = 8;           //~ Length for a property value held inline, longer values reside in the heap
+    static constexpr uint8_t CFG_LPG_VERTEX_LABELS_MAX_AMT  = 128;         //~ Amount of vertex labels, bounding the label mask of a vertex
 
     static constexpr uint8_t CFG_GRAPH_NAME_LENGTH          = _align_(20); //~ Length for a graph entry name
     static constexpr uint8_t CFG_GRAPH_MODEL_TYPE_LENGTH    = _align_(20); //~ Length for a graph model type
@@ -53,4 +58,16 @@ namespace graphquery::database::storage
     //~ System config
     static constexpr auto CFG_SYSTEM_HEARTBEAT_INTERVAL = std::chrono::seconds(20);
     static constexpr auto OMP_NUM_THREADS               = 64;
+
+    //~ Storage config
+    static constexpr int64_t CFG_LPG_RESERVED_ADDRESS_SPACE  = static_cast<int64_t>(1) << 30;   //~ Least address space reserved per block file, growth within it never moves the mapping (0 disables)
+    static constexpr uint8_t CFG_LPG_RESERVED_ADDRESS_FACTOR = 8;                               //~ Multiple of its size a block file reserves once opened, sizing the reservation per file
+    static constexpr bool CFG_LPG_HUGE_PAGES                 = true;                            //~ Align and advise the vertex and edge files for transparent huge pages
+    static constexpr bool CFG_LPG_POPULATE_ON_LOAD           = false;                           //~ Fault block files in entirely when opened, trading load time for first access latency
+    static constexpr int64_t CFG_LPG_FLUSH_COALESCE_PAGES    = 8;                               //~ Clean pages between dirty ranges that are flushed alongside them, trading bytes written for fewer syncs
+    static constexpr auto CFG_LPG_FLUSH_INTERVAL             = std::chrono::milliseconds(1000); //~ Interval of the background flush of the transaction log
+    static constexpr auto CFG_LPG_GROUP_COMMIT_MAX_DELAY     = std::chrono::microseconds(0);    //~ Longest a group commit waits for further commits, zero batches solely those arriving during a sync
+    static constexpr uint64_t CFG_LPG_GROUP_COMMIT_MAX_BATCH = 64;                              //~ Commits closing a group commit before its delay passes
+    static constexpr uint64_t CFG_LPG_CHECKPOINT_LOG_SIZE    = static_cast<uint64_t>(1) << 26;  //~ Size the transaction log reaches before a checkpoint truncates it, bounding the replay on recovery
+    static constexpr uint64_t CFG_LPG_BULK_LOAD_BATCH_C      = static_cast<uint64_t>(1) << 20;  //~ Rows buffered by a dataset load before being applied together as a bulk load
 } // namespace graphquery::database::storage
@@ -75,8 +75,20 @@ namespace graphquery::database::storage
         static const auto initial_dynamic_path = m_dataset_path / "initial_snapshot" / "dynamic";
 
         _disable_sync_();
+
+        //~ Columns for the properties filtered and projected by the interactive queries, filled as vertices are loaded.
+        (void) (*m_graph)->create_property_column("Message", "creationDate", ILPGModel::EColumnType_t::date);
+        (void) (*m_graph)->create_property_column("Person", "firstName", ILPGModel::EColumnType_t::string);
+        (void) (*m_graph)->create_property_column("Person", "lastName", ILPGModel::EColumnType_t::string);
+
         load_dataset_segment(initial_static_path);
         load_dataset_segment(initial_dynamic_path);
+
+        //~ Newest first adjacencies for the messages of a person and the replies of a message.
+        (void) (*m_graph)->create_temporal_index("Message", "hasCreator", "creationDate", true);
+        (void) (*m_graph)->create_temporal_index("Comment", "replyOf", "creationDate", true);
+        if (!(*m_graph)->finish_bulk_load())
+            _log_system->error("Dataset has been loaded, yet could not be made durable");
         _enable_sync_();
     }
 
@@ -101,6 +113,8 @@ namespace graphquery::database::storage
 
         std::vector<ILPGModel::SProperty_t> props;
         std::vector<std::string_view> labels;
+        ILPGModel::STransaction_t batch = {};
+
         for (const auto & row : fd)
         {
             labels.emplace_back(file_name);
@@ -118,11 +132,16 @@ namespace graphquery::database::storage
             for (const auto & prop_idx : prop_indices)
                 props.emplace_back(col_names[prop_idx], row[prop_idx].get<>());
 
-            (*m_graph)->add_vertex(id, labels, props);
+            batch.add_vertex(id, labels, props);
+
+            if (batch.mutations.size() >= CFG_LPG_BULK_LOAD_BATCH_C)
+                (*m_graph)->bulk_load(batch, true);
 
             props.clear();
             labels.clear();
         }
+
+        (*m_graph)->bulk_load(batch, true);
     }
 
     inline void CDatasetLDBC::load_edge_file([[maybe_unused]] const std::string_view file_name, [[maybe_unused]] csv::CSVReader & fd) const noexcept
@@ -145,6 +164,9 @@ namespace graphquery::database::storage
         }
 
         std::vector<ILPGModel::SProperty_t> props;
+        ILPGModel::STransaction_t batch = {};
+
+        //~ Rows of the snapshot are unique, therefore the existence check of each edge is skipped.
         for (const auto & row : fd)
         {
             const auto src_id = row[edge_idx_map.first].get<int64_t>();
@@ -153,10 +175,15 @@ namespace graphquery::database::storage
             for (const auto & prop_idx : prop_indices)
                 props.emplace_back(col_names[prop_idx], row[prop_idx].get<>());
 
-            (*m_graph)->add_edge(src_id, dst_id, edge_label, props, undirected);
+            batch.add_edge(src_id, dst_id, edge_label, props, undirected);
+
+            if (batch.mutations.size() >= CFG_LPG_BULK_LOAD_BATCH_C)
+                (*m_graph)->bulk_load(batch, true);
 
             props.clear();
         }
+
+        (*m_graph)->bulk_load(batch, true);
     }
 
     inline void CDatasetLDBC::load_dataset_segment(const std::filesystem::path & path) const noexcept
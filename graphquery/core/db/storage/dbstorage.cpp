@@ -155,6 +155,15 @@ graphquery::database::storage::CDBStorage::define_graph_model(const std::string_
         m_graph_model_lib->get_function<void(ILPGModel **, const std::shared_ptr<logger::CLogSystem> &, const bool &)>("create_graph_model")(m_loaded_graph.get(), _log_system, _get_sync_state_());
         (*m_loaded_graph)->init(m_db_file.get_path().parent_path().string(), name);
 
+        if (!(*m_loaded_graph)->check_if_loaded())
+        {
+            _log_system->error(fmt::format("Graph ({}) could not be loaded by memory model of type ({})", name, type));
+            delete *m_loaded_graph;
+            *m_loaded_graph = nullptr;
+            m_graph_model_lib.reset();
+            return false;
+        }
+
         m_existing_graph_loaded = true;
     }
     catch (std::runtime_error & e)
@@ -0,0 +1,157 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file dirty_page_set.hpp
+ * \brief Concurrent set of the pages written to within a mapped
+ *        file, such that a sync flushes solely the ranges changed
+ *        since the prior one rather than the entire file.
+ ************************************************************/
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+
+namespace graphquery::database::storage
+{
+    class CDirtyPageSet
+    {
+      public:
+        //~ Each leaf holds the bits of LEAF_WORDS * 64 pages, allocated once a page within it is first marked.
+        static constexpr uint32_t LEAF_WORDS = 1024;
+        static constexpr uint32_t LEAF_C     = 4096;
+        static constexpr int64_t LEAF_PAGES  = static_cast<int64_t>(LEAF_WORDS) * 64;
+
+        explicit CDirtyPageSet(int64_t page_size) noexcept;
+        ~CDirtyPageSet();
+        CDirtyPageSet(const CDirtyPageSet &)             = delete;
+        CDirtyPageSet & operator=(const CDirtyPageSet &) = delete;
+
+        inline void mark(int64_t offset, int64_t size) noexcept;
+        [[nodiscard]] bool drain(int64_t max_gap, const std::function<void(int64_t offset, int64_t size)> & func) noexcept;
+
+      private:
+        [[nodiscard]] std::atomic<uint64_t> * attain_leaf(uint32_t leaf_idx) noexcept;
+
+        const int64_t m_page_size;
+        std::atomic<bool> m_overflow;
+        std::atomic<uint32_t> m_leaf_c;
+        std::array<std::atomic<std::atomic<uint64_t> *>, LEAF_C> m_leaves;
+    };
+} // namespace graphquery::database::storage
+
+inline graphquery::database::storage::CDirtyPageSet::CDirtyPageSet(const int64_t page_size) noexcept: m_page_size(page_size), m_overflow(false), m_leaf_c(0), m_leaves()
+{
+}
+
+inline graphquery::database::storage::CDirtyPageSet::~
+CDirtyPageSet()
+{
+    for (auto & leaf : m_leaves)
+        delete[] leaf.load(std::memory_order_relaxed);
+}
+
+inline std::atomic<uint64_t> *
+graphquery::database::storage::CDirtyPageSet::attain_leaf(const uint32_t leaf_idx) noexcept
+{
+    std::atomic<uint64_t> * leaf = m_leaves[leaf_idx].load(std::memory_order_acquire);
+
+    if (leaf != nullptr)
+        return leaf;
+
+    //~ Racing markers allocate a leaf each, the loser frees its own.
+    auto * allocated = new std::atomic<uint64_t>[LEAF_WORDS]();
+
+    if (m_leaves[leaf_idx].compare_exchange_strong(leaf, allocated, std::memory_order_acq_rel))
+    {
+        uint32_t leaf_c = m_leaf_c.load(std::memory_order_relaxed);
+        while (leaf_c <= leaf_idx && !m_leaf_c.compare_exchange_weak(leaf_c, leaf_idx + 1, std::memory_order_release))
+            ;
+        return allocated;
+    }
+
+    delete[] allocated;
+    return leaf;
+}
+
+inline void
+graphquery::database::storage::CDirtyPageSet::mark(const int64_t offset, const int64_t size) noexcept
+{
+    if (size <= 0)
+        return;
+
+    const int64_t first_page = offset / m_page_size;
+    const int64_t last_page  = (offset + size - 1) / m_page_size;
+
+    for (int64_t page = first_page; page <= last_page; page++)
+    {
+        const auto leaf_idx = static_cast<uint64_t>(page / LEAF_PAGES);
+
+        //~ Pages beyond the tracked extent fall back to flushing the entire file.
+        if (leaf_idx >= LEAF_C)
+        {
+            m_overflow.store(true, std::memory_order_release);
+            return;
+        }
+
+        const int64_t leaf_page = page % LEAF_PAGES;
+        const uint64_t bit      = static_cast<uint64_t>(1) << (leaf_page % 64);
+        auto & word             = attain_leaf(static_cast<uint32_t>(leaf_idx))[leaf_page / 64];
+
+        //~ Pages written repeatedly between syncs are marked once, avoiding contended updates.
+        if ((word.load(std::memory_order_relaxed) & bit) == 0)
+            word.fetch_or(bit, std::memory_order_release);
+    }
+}
+
+inline bool
+graphquery::database::storage::CDirtyPageSet::drain(const int64_t max_gap, const std::function<void(int64_t offset, int64_t size)> & func) noexcept
+{
+    int64_t run_start     = -1;
+    int64_t run_end       = -1;
+    const uint32_t leaf_c = m_leaf_c.load(std::memory_order_acquire);
+
+    for (uint32_t leaf_idx = 0; leaf_idx < leaf_c; leaf_idx++)
+    {
+        std::atomic<uint64_t> * leaf = m_leaves[leaf_idx].load(std::memory_order_acquire);
+
+        if (leaf == nullptr)
+            continue;
+
+        for (uint32_t w = 0; w < LEAF_WORDS; w++)
+        {
+            if (leaf[w].load(std::memory_order_relaxed) == 0)
+                continue;
+
+            //~ Cleared prior to flushing, such that a page written meanwhile is flushed again by the next drain.
+            uint64_t bits = leaf[w].exchange(0, std::memory_order_acq_rel);
+
+            while (bits != 0)
+            {
+                const int64_t page = leaf_idx * LEAF_PAGES + w * 64 + std::countr_zero(bits);
+                bits &= bits - 1;
+
+                //~ Runs separated by at most max_gap clean pages are coalesced into a single flush.
+                if (run_end >= 0 && page - run_end <= max_gap)
+                {
+                    run_end = page + 1;
+                    continue;
+                }
+
+                if (run_end >= 0)
+                    func(run_start * m_page_size, (run_end - run_start) * m_page_size);
+
+                run_start = page;
+                run_end   = page + 1;
+            }
+        }
+    }
+
+    if (run_end >= 0)
+        func(run_start * m_page_size, (run_end - run_start) * m_page_size);
+
+    return m_overflow.exchange(false, std::memory_order_acq_rel);
+}
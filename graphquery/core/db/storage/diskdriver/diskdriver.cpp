@@ -5,6 +5,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cstdint>
 
@@ -14,12 +15,14 @@
 //~ static symbol link
 std::shared_ptr<graphquery::logger::CLogSystem> graphquery::database::storage::CDiskDriver::m_log_system;
 
-graphquery::database::storage::CDiskDriver::CDiskDriver(const int map_mode_flags, const int file_mode, const int map_mode_prot)
+graphquery::database::storage::CDiskDriver::CDiskDriver(const int map_mode_flags, const int file_mode, const int map_mode_prot, const int64_t reserved_size)
 {
     m_log_system               = logger::CLogSystem::get_instance();
     this->m_file_mode          = file_mode;
     this->m_map_mode_prot      = map_mode_prot;
     this->m_map_mode_flags     = map_mode_flags;
+    this->m_reserved_size      = reserved_size;
+    this->m_reserved_min       = reserved_size;
     this->m_memory_mapped_file = nullptr;
     this->reader_c             = 0;
     this->m_writer_lock.unlock();
@@ -72,6 +75,12 @@ graphquery::database::storage::CDiskDriver::close_fd() const noexcept
 void
 graphquery::database::storage::CDiskDriver::resize(const int64_t file_size) noexcept
 {
+    if (m_reserved_size > 0)
+    {
+        grow_in_place(file_size);
+        return;
+    }
+
     m_writer_lock.lock();
     const auto old_size = m_fd_info.st_size;
 
@@ -89,11 +98,87 @@ graphquery::database::storage::CDiskDriver::resize(const int64_t file_size) noex
 void
 graphquery::database::storage::CDiskDriver::resize_override(const int64_t file_size) noexcept
 {
+    if (m_reserved_size > 0)
+    {
+        wait_for_extension();
+        std::lock_guard lock(m_resize_lock);
+
+        const int64_t old_size = m_mapped_size.load(std::memory_order_relaxed);
+        const int64_t new_size = resize_to_pagesize(file_size);
+        truncate(new_size);
+
+        //~ Shrinking returns the tail to the reservation, as touching pages past the end of the file would fault.
+        if (new_size < old_size)
+        {
+            m_mapped_size.store(new_size, std::memory_order_release);
+            release_range(new_size, old_size - new_size);
+        }
+        else
+            remap(old_size);
+
+        return;
+    }
+
     const auto old_size = m_fd_info.st_size;
     truncate(resize_to_pagesize(file_size));
     remap(old_size);
 }
 
+void
+graphquery::database::storage::CDiskDriver::grow_in_place(const int64_t file_size) noexcept
+{
+    std::lock_guard lock(m_resize_lock);
+    const int64_t old_size = m_mapped_size.load(std::memory_order_relaxed);
+
+    if (old_size >= file_size)
+        return;
+
+    //~ Beyond the reservation the mapping must move, therefore readers are excluded as without a reservation.
+    if (resize_to_pagesize(file_size) > m_reserved_size)
+    {
+        m_writer_lock.lock();
+        truncate(resize_to_pagesize(file_size));
+        remap(old_size);
+        m_writer_lock.unlock();
+        return;
+    }
+
+    truncate(resize_to_pagesize(file_size));
+    remap(old_size);
+}
+
+void
+graphquery::database::storage::CDiskDriver::extend_in_background(const int64_t file_size) noexcept
+{
+    if (m_extending.exchange(true, std::memory_order_acquire))
+        return;
+
+    //~ Extensions stay within the reservation, as moving the mapping requires the accessors to be excluded.
+    const int64_t extended_size = std::min(resize_to_pagesize(file_size), m_reserved_size);
+
+    if (extended_size <= m_mapped_size.load(std::memory_order_relaxed))
+    {
+        m_extending.store(false, std::memory_order_release);
+        return;
+    }
+
+    std::lock_guard lock(m_extension_lock);
+    m_extension = std::async(std::launch::async,
+                             [this, extended_size]() -> void
+                             {
+                                 grow_in_place(extended_size);
+                                 m_extending.store(false, std::memory_order_release);
+                             });
+}
+
+void
+graphquery::database::storage::CDiskDriver::wait_for_extension() noexcept
+{
+    std::lock_guard lock(m_extension_lock);
+    if (m_extension.valid())
+        m_extension.wait();
+}
+
 graphquery::database::storage::CDiskDriver::SRet_t
 graphquery::database::storage::CDiskDriver::truncate(const int64_t file_size) noexcept
 {
@@ -122,7 +207,15 @@ graphquery::database::storage::CDiskDriver::truncate(const int64_t file_size) no
 graphquery::database::storage::CDiskDriver::SRet_t
 graphquery::database::storage::CDiskDriver::map() noexcept
 {
-    this->m_memory_mapped_file = static_cast<char *>(mmap(nullptr, m_fd_info.st_size, m_map_mode_prot, m_map_mode_flags, m_file_descriptor, 0));
+    if (m_reserved_size > 0)
+    {
+        if (reserve() == SRet_t::ERROR)
+            return SRet_t::ERROR;
+
+        return map_range(0, m_fd_info.st_size, populate_flags());
+    }
+
+    this->m_memory_mapped_file = static_cast<char *>(mmap(nullptr, m_fd_info.st_size, m_map_mode_prot, m_map_mode_flags | populate_flags(), m_file_descriptor, 0));
 
     if (this->m_memory_mapped_file == MAP_FAILED)
     {
@@ -130,12 +223,97 @@ graphquery::database::storage::CDiskDriver::map() noexcept
         return SRet_t::ERROR;
     }
 
+    m_mapped_size.store(m_fd_info.st_size, std::memory_order_release);
+    apply_hints(0, m_fd_info.st_size);
+    return SRet_t::VALID;
+}
+
+graphquery::database::storage::CDiskDriver::SRet_t
+graphquery::database::storage::CDiskDriver::reserve() noexcept
+{
+    //~ Sized per file, a reservation holds a multiple of the file, such that small files claim little address space.
+    m_reserved_size = std::max(m_reserved_min, static_cast<int64_t>(std::bit_ceil(static_cast<uint64_t>(m_fd_info.st_size) * m_reserve_factor)));
+
+    //~ Inaccessible and without backing, the reservation solely claims the address range.
+    const int64_t alignment = m_huge_pages ? static_cast<int64_t>(HUGE_PAGE_SIZE) : 0;
+    auto * region           = static_cast<char *>(mmap(nullptr, m_reserved_size + alignment, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0));
+
+    if (region == MAP_FAILED)
+    {
+        m_log_system->error(fmt::format("Error reserving address space of {} bytes {} ({})", m_reserved_size, strerror(errno), errno));
+        return SRet_t::ERROR;
+    }
+
+    //~ Huge pages require the mapping to start on a huge page boundary, the slack either side is returned.
+    if (alignment > 0)
+    {
+        const auto address = std::bit_cast<uintptr_t>(region);
+        const auto head    = static_cast<int64_t>(((address + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1)) - address);
+
+        if (head > 0)
+            munmap(region, head);
+        if (alignment - head > 0)
+            munmap(region + head + m_reserved_size, alignment - head);
+
+        region += head;
+    }
+
+    this->m_memory_mapped_file = region;
+    m_mapped_size.store(0, std::memory_order_release);
+    return SRet_t::VALID;
+}
+
+graphquery::database::storage::CDiskDriver::SRet_t
+graphquery::database::storage::CDiskDriver::map_range(const int64_t offset, const int64_t size, const int extra_flags) noexcept
+{
+    //~ Mapping fixed over the reservation, the file is mapped in place and existing references remain valid.
+    const int64_t aligned_offset = offset & ~static_cast<int64_t>(PAGE_SIZE - 1);
+    void * addr = mmap(&m_memory_mapped_file[aligned_offset], size + offset - aligned_offset, m_map_mode_prot, m_map_mode_flags | MAP_FIXED | extra_flags, m_file_descriptor, aligned_offset);
+
+    if (addr == MAP_FAILED)
+    {
+        m_log_system->error(fmt::format("Error mapping file to reserved memory {} ({})", strerror(errno), errno));
+        return SRet_t::ERROR;
+    }
+
+    //~ A fresh mapping carries no advice, therefore the hints are applied to the grown range.
+    m_mapped_size.store(offset + size, std::memory_order_release);
+    apply_hints(aligned_offset, size + offset - aligned_offset);
+    return SRet_t::VALID;
+}
+
+graphquery::database::storage::CDiskDriver::SRet_t
+graphquery::database::storage::CDiskDriver::release_range(const int64_t offset, const int64_t size) noexcept
+{
+    void * addr = mmap(&m_memory_mapped_file[offset], size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+
+    if (addr == MAP_FAILED)
+    {
+        m_log_system->error(fmt::format("Error returning memory to the reservation {} ({})", strerror(errno), errno));
+        return SRet_t::ERROR;
+    }
+
     return SRet_t::VALID;
 }
 
 graphquery::database::storage::CDiskDriver::SRet_t
 graphquery::database::storage::CDiskDriver::remap([[maybe_unused]] const int64_t old_size) noexcept
 {
+    if (m_reserved_size > 0)
+    {
+        if (m_fd_info.st_size <= m_reserved_size)
+            return map_range(old_size, m_fd_info.st_size - old_size);
+
+        //~ Outgrown, the file is moved into a reservation a multiple of its size.
+        if (munmap(m_memory_mapped_file, m_reserved_size) == -1)
+            m_log_system->warning(fmt::format("Error releasing reserved memory {} ({})", strerror(errno), errno));
+
+        if (reserve() == SRet_t::ERROR)
+            return SRet_t::ERROR;
+
+        return map_range(0, m_fd_info.st_size);
+    }
+
 #if defined(__APPLE__)
     this->m_memory_mapped_file = static_cast<char *>(mmap(m_memory_mapped_file, m_fd_info.st_size, m_map_mode_prot, m_map_mode_flags, m_file_descriptor, 0));
 #else
@@ -148,13 +326,16 @@ graphquery::database::storage::CDiskDriver::remap([[maybe_unused]] const int64_t
         return SRet_t::ERROR;
     }
 
+    m_mapped_size.store(m_fd_info.st_size, std::memory_order_release);
     return SRet_t::VALID;
 }
 
 graphquery::database::storage::CDiskDriver::SRet_t
 graphquery::database::storage::CDiskDriver::unmap() const noexcept
 {
-    if (munmap(this->m_memory_mapped_file, this->m_fd_info.st_size) == -1)
+    const int64_t mapped_size = m_reserved_size > 0 ? m_reserved_size : m_mapped_size.load(std::memory_order_acquire);
+
+    if (munmap(this->m_memory_mapped_file, mapped_size) == -1)
     {
         m_log_system->error(fmt::format("Error unmapping file from memory {} ({})", strerror(errno), errno));
         return SRet_t::ERROR;
@@ -163,6 +344,187 @@ graphquery::database::storage::CDiskDriver::unmap() const noexcept
     return SRet_t::VALID;
 }
 
+void
+graphquery::database::storage::CDiskDriver::set_access_hint(const EAccessHint_t hint) noexcept
+{
+    m_access_hint = hint;
+
+    if (m_initialised && m_scope_c.load(std::memory_order_acquire) == 0)
+        (void) advise(hint);
+}
+
+void
+graphquery::database::storage::CDiskDriver::set_huge_pages(const bool huge_pages) noexcept
+{
+    m_huge_pages = huge_pages;
+}
+
+void
+graphquery::database::storage::CDiskDriver::set_populate(const bool populate) noexcept
+{
+    m_populate = populate;
+}
+
+void
+graphquery::database::storage::CDiskDriver::set_reserve_factor(const uint8_t reserve_factor) noexcept
+{
+    //~ Below two, a file outgrowing its reservation could be moved into one leaving it no room to grow.
+    m_reserve_factor = std::max<uint8_t>(reserve_factor, 2);
+}
+
+graphquery::database::storage::CDiskDriver::SAccessScope_t
+graphquery::database::storage::CDiskDriver::scoped_access(const EAccessHint_t hint) noexcept
+{
+    return {*this, hint};
+}
+
+graphquery::database::storage::CDiskDriver::SAccessScope_t::SAccessScope_t(CDiskDriver & file, const EAccessHint_t hint) noexcept: m_file(file)
+{
+    //~ Overlapping scopes keep the hint of the first, as the kernel holds a single advice per range.
+    if (m_file.m_scope_c.fetch_add(1, std::memory_order_acq_rel) > 0 || !m_file.m_initialised)
+        return;
+
+    (void) m_file.advise(hint);
+
+    if (hint == EAccessHint_t::sequential)
+        (void) m_file.prefetch();
+}
+
+graphquery::database::storage::CDiskDriver::SAccessScope_t::~SAccessScope_t()
+{
+    if (m_file.m_scope_c.fetch_sub(1, std::memory_order_acq_rel) == 1 && m_file.m_initialised)
+        (void) m_file.advise(m_file.m_access_hint);
+}
+
+graphquery::database::storage::CDiskDriver::SRet_t
+graphquery::database::storage::CDiskDriver::advise(const EAccessHint_t hint, const int64_t offset, const int64_t size) const noexcept
+{
+    switch (hint)
+    {
+    case EAccessHint_t::sequential: return madvise_range(MADV_SEQUENTIAL, offset, size);
+    case EAccessHint_t::random: return madvise_range(MADV_RANDOM, offset, size);
+    default: return madvise_range(MADV_NORMAL, offset, size);
+    }
+}
+
+graphquery::database::storage::CDiskDriver::SRet_t
+graphquery::database::storage::CDiskDriver::prefetch(const int64_t offset, const int64_t size) const noexcept
+{
+    return madvise_range(MADV_WILLNEED, offset, size);
+}
+
+graphquery::database::storage::CDiskDriver::SRet_t
+graphquery::database::storage::CDiskDriver::madvise_range(const int advice, const int64_t offset, const int64_t size) const noexcept
+{
+    const int64_t mapped_size = m_mapped_size.load(std::memory_order_acquire);
+    const int64_t begin       = offset & ~static_cast<int64_t>(PAGE_SIZE - 1);
+    const int64_t end         = size < 0 ? mapped_size : std::min(offset + size, mapped_size);
+
+    if (!m_initialised || end <= begin)
+        return SRet_t::VALID;
+
+    if (madvise(&m_memory_mapped_file[begin], end - begin, advice) == -1)
+    {
+        m_log_system->warning(fmt::format("Issue advising the kernel of access to ({}) {} ({})", m_path.generic_string(), strerror(errno), errno));
+        return SRet_t::ERROR;
+    }
+
+    return SRet_t::VALID;
+}
+
+void
+graphquery::database::storage::CDiskDriver::apply_hints(const int64_t offset, const int64_t size) const noexcept
+{
+    if (m_scope_c.load(std::memory_order_acquire) == 0 && m_access_hint != EAccessHint_t::normal)
+        (void) advise(m_access_hint, offset, size);
+
+#if defined(MADV_HUGEPAGE)
+    //~ Solely a hint, file systems without huge page support decline it.
+    if (m_huge_pages)
+        (void) madvise(&m_memory_mapped_file[offset], size, MADV_HUGEPAGE);
+#endif
+}
+
+int
+graphquery::database::storage::CDiskDriver::populate_flags() const noexcept
+{
+#if defined(MAP_POPULATE)
+    return m_populate ? MAP_POPULATE : 0;
+#else
+    return 0;
+#endif
+}
+
+void
+graphquery::database::storage::CDiskDriver::set_dirty_tracking(const bool dirty_tracking) noexcept
+{
+    //~ Tracked files flush solely the ranges marked by their writers, therefore every write must be marked.
+    m_dirty_pages = dirty_tracking ? std::make_unique<CDirtyPageSet>(PAGE_SIZE) : nullptr;
+}
+
+void
+graphquery::database::storage::CDiskDriver::start_flusher(const std::chrono::milliseconds interval) noexcept
+{
+    stop_flusher();
+    m_flusher = std::jthread(
+        [this, interval](const std::stop_token & stop) -> void
+        {
+            std::unique_lock lock(m_flusher_wait_lock);
+            while (!m_flusher_cv.wait_for(lock, stop, interval, [&stop]() -> bool { return stop.stop_requested(); }))
+                (void) flush_dirty(MS_SYNC);
+        });
+}
+
+void
+graphquery::database::storage::CDiskDriver::stop_flusher() noexcept
+{
+    if (!m_flusher.joinable())
+        return;
+
+    m_flusher.request_stop();
+    m_flusher.join();
+}
+
+graphquery::database::storage::CDiskDriver::SRet_t
+graphquery::database::storage::CDiskDriver::flush_dirty(const int flags) const noexcept
+{
+    std::lock_guard lock(m_flush_lock);
+
+    if (!m_initialised || m_dirty_pages == nullptr)
+        return SRet_t::VALID;
+
+    SRet_t ret = SRet_t::VALID;
+    const bool overflow = m_dirty_pages->drain(CFG_LPG_FLUSH_COALESCE_PAGES,
+                                               [this, flags, &ret](const int64_t offset, const int64_t size) -> void
+                                               {
+                                                   if (msync_range(offset, size, flags) == SRet_t::ERROR)
+                                                       ret = SRet_t::ERROR;
+                                               });
+
+    if (overflow)
+        return msync_range(0, m_mapped_size.load(std::memory_order_acquire), flags);
+
+    return ret;
+}
+
+graphquery::database::storage::CDiskDriver::SRet_t
+graphquery::database::storage::CDiskDriver::msync_range(const int64_t offset, const int64_t size, const int flags) const noexcept
+{
+    //~ Ranges marked prior to the file shrinking are clipped to the mapping.
+    const int64_t end = std::min(offset + size, m_mapped_size.load(std::memory_order_acquire));
+
+    if (end <= offset)
+        return SRet_t::VALID;
+
+    if (msync(&m_memory_mapped_file[offset], static_cast<size_t>(end - offset), flags) == -1)
+    {
+        m_log_system->warning(fmt::format("Issue syncing the buffer {} ({})", strerror(errno), errno));
+        return SRet_t::ERROR;
+    }
+
+    return SRet_t::VALID;
+}
+
 void
 graphquery::database::storage::CDiskDriver::set_path(std::filesystem::path path) noexcept
 {
@@ -255,6 +617,23 @@ graphquery::database::storage::CDiskDriver::create_folder(const std::filesystem:
     return SRet_t::VALID;
 }
 
+graphquery::database::storage::CDiskDriver::SRet_t
+graphquery::database::storage::CDiskDriver::sync_folder(const std::filesystem::path & folder_path)
+{
+    //~ Entries created or renamed within the folder are solely durable once the folder itself is synced.
+    const int fd = ::open(folder_path.c_str(), O_RDONLY | O_DIRECTORY);
+
+    if (fd == -1)
+    {
+        m_log_system->error(fmt::format("Folder ({}) could not be opened to sync", folder_path.generic_string()));
+        return SRet_t::ERROR;
+    }
+
+    const bool synced = fsync(fd) == 0;
+    ::close(fd);
+    return synced ? SRet_t::VALID : SRet_t::ERROR;
+}
+
 graphquery::database::storage::CDiskDriver::SRet_t
 graphquery::database::storage::CDiskDriver::open(const std::string_view file_name)
 {
@@ -279,7 +658,10 @@ graphquery::database::storage::CDiskDriver::sync() const noexcept
 {
     if (this->m_initialised && m_map_mode_flags == MAP_SHARED)
     {
-        if (msync(m_memory_mapped_file, static_cast<size_t>(m_fd_info.st_size), MS_SYNC) == -1)
+        if (m_dirty_pages != nullptr)
+            return flush_dirty(MS_SYNC);
+
+        if (msync(m_memory_mapped_file, static_cast<size_t>(m_mapped_size.load(std::memory_order_acquire)), MS_SYNC) == -1)
         {
             m_log_system->warning("Issue syncing the buffer");
             return SRet_t::ERROR;
@@ -297,7 +679,10 @@ graphquery::database::storage::CDiskDriver::async() const noexcept
 {
     if (this->m_initialised && m_map_mode_flags == MAP_SHARED)
     {
-        if (msync(m_memory_mapped_file, static_cast<size_t>(m_fd_info.st_size), MS_ASYNC) == -1)
+        if (m_dirty_pages != nullptr)
+            return flush_dirty(MS_ASYNC);
+
+        if (msync(m_memory_mapped_file, static_cast<size_t>(m_mapped_size.load(std::memory_order_acquire)), MS_ASYNC) == -1)
         {
             m_log_system->warning("Issue syncing the buffer");
             return SRet_t::ERROR;
@@ -310,12 +695,104 @@ graphquery::database::storage::CDiskDriver::async() const noexcept
     return SRet_t::ERROR;
 }
 
+graphquery::database::storage::CDiskDriver::SRet_t
+graphquery::database::storage::CDiskDriver::save_to(const std::filesystem::path & folder_path) const noexcept
+{
+    if (!m_initialised)
+    {
+        m_log_system->warning("File has not been initialised");
+        return SRet_t::ERROR;
+    }
+
+    const std::filesystem::path image_path = folder_path / m_path.filename();
+    const int fd                           = ::open(image_path.c_str(), O_CREAT | O_TRUNC | O_WRONLY, S_IWUSR | S_IRUSR);
+
+    if (fd == -1)
+    {
+        m_log_system->error(fmt::format("File descriptor ({}) could not be created to save the file", image_path.generic_string()));
+        return SRet_t::ERROR;
+    }
+
+    //~ Written from the mapping, therefore the image holds writes yet to be synced to the file itself.
+    const int64_t size = m_mapped_size.load(std::memory_order_acquire);
+    int64_t written    = 0;
+
+    while (written < size)
+    {
+        const ssize_t n = ::write(fd, &m_memory_mapped_file[written], static_cast<size_t>(size - written));
+
+        if (n == -1)
+        {
+            if (errno == EINTR)
+                continue;
+
+            m_log_system->error(fmt::format("Issue saving the file ({}) (Error: {})", image_path.generic_string(), errno));
+            ::close(fd);
+            return SRet_t::ERROR;
+        }
+
+        written += n;
+    }
+
+    const bool synced = fdatasync(fd) == 0;
+    ::close(fd);
+    return synced ? SRet_t::VALID : SRet_t::ERROR;
+}
+
+graphquery::database::storage::CDiskDriver::SRet_t
+graphquery::database::storage::CDiskDriver::restore_from(const std::filesystem::path & folder_path) noexcept
+{
+    if (!m_initialised)
+    {
+        m_log_system->warning("File has not been initialised");
+        return SRet_t::ERROR;
+    }
+
+    const std::filesystem::path image_path = folder_path / m_path.filename();
+    const int fd                           = ::open(image_path.c_str(), O_RDONLY);
+    struct stat image_info                 = {};
+
+    if (fd == -1 || fstat(fd, &image_info) == -1)
+    {
+        m_log_system->error(fmt::format("File ({}) could not be opened to restore from", image_path.generic_string()));
+        if (fd != -1)
+            ::close(fd);
+        return SRet_t::ERROR;
+    }
+
+    //~ Restored through the mapping, such that references taken afterwards remain valid.
+    const int64_t size = image_info.st_size;
+    resize_override(size);
+
+    int64_t read_c = 0;
+    while (read_c < size)
+    {
+        const ssize_t n = ::pread(fd, &m_memory_mapped_file[read_c], static_cast<size_t>(size - read_c), read_c);
+
+        if (n <= 0)
+        {
+            if (n == -1 && errno == EINTR)
+                continue;
+
+            m_log_system->error(fmt::format("Issue restoring the file ({}) (Error: {})", image_path.generic_string(), errno));
+            ::close(fd);
+            return SRet_t::ERROR;
+        }
+
+        read_c += n;
+    }
+
+    ::close(fd);
+    mark_dirty(0, size);
+    return SRet_t::VALID;
+}
+
 void
 graphquery::database::storage::CDiskDriver::clear_contents() noexcept
 {
     if (m_initialised)
     {
-        memset(&m_memory_mapped_file[0], 0, m_fd_info.st_size);
+        memset(&m_memory_mapped_file[0], 0, m_mapped_size.load(std::memory_order_acquire));
         this->reader_c             = 0;
         this->m_writer_lock.unlock();
     }
@@ -326,7 +803,7 @@ graphquery::database::storage::CDiskDriver::get_filesize() const noexcept
 {
     if (m_initialised)
     {
-        return m_fd_info.st_size;
+        return m_mapped_size.load(std::memory_order_acquire);
     }
     return 0;
 }
@@ -336,8 +813,12 @@ graphquery::database::storage::CDiskDriver::close()
 {
     if (this->m_initialised)
     {
+        stop_flusher();
+        wait_for_extension();
+
+        //~ The entire file is synced on closing, including writes not marked to a tracked file.
         if (m_map_mode_flags == MAP_SHARED)
-            assert(sync() == SRet_t::VALID);
+            assert(msync_range(0, m_mapped_size.load(std::memory_order_acquire), MS_SYNC) == SRet_t::VALID);
         assert(unmap() == SRet_t::VALID);
         assert(close_fd() == SRet_t::VALID);
         this->m_initialised = false;
@@ -353,8 +834,7 @@ graphquery::database::storage::CDiskDriver::read(void * ptr, const int64_t size,
 {
     if (this->m_initialised)
     {
-        if (m_fd_info.st_size <= size * amt + m_seek_offset)
-            resize((size * amt + m_seek_offset) * 2);
+        ensure_mapped(size * amt + m_seek_offset);
 
         memcpy(ptr, &this->m_memory_mapped_file[this->m_seek_offset], size * amt);
 
@@ -371,10 +851,10 @@ graphquery::database::storage::CDiskDriver::write(const void * ptr, const int64_
 {
     if (this->m_initialised)
     {
-        if (m_fd_info.st_size <= size * amt + m_seek_offset)
-            resize((size * amt + m_seek_offset) * 2);
+        ensure_mapped(size * amt + m_seek_offset);
 
         memcpy(&this->m_memory_mapped_file[this->m_seek_offset], ptr, size * amt);
+        mark_dirty(m_seek_offset, size * amt);
         if (update)
             this->m_seek_offset += size * amt;
     }
@@ -390,7 +870,7 @@ graphquery::database::storage::CDiskDriver::operator[](const int64_t idx) const
     char ret = {};
     if (this->m_initialised)
     {
-        assert(idx >= 0L && idx <= this->m_fd_info.st_size);
+        assert(idx >= 0L && idx <= m_mapped_size.load(std::memory_order_acquire));
 
         ret = this->m_memory_mapped_file[idx];
     }
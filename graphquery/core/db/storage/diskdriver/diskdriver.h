@@ -11,6 +11,7 @@
 #pragma once
 
 #include "memory_ref.h"
+#include "dirty_page_set.hpp"
 #include "log/logsystem/logsystem.h"
 #include "db/storage/config.h"
 
@@ -22,8 +23,13 @@
 #include <condition_variable>
 #include <unistd.h>
 #include <bit>
+#include <atomic>
 #include <cassert>
+#include <future>
+#include <mutex>
 #include <shared_mutex>
+#include <stop_token>
+#include <thread>
 
 #define KB(x) ((size_t) (x * (1 << 10)))
 #define MB(x) ((size_t) (x * (1 << 20)))
@@ -40,10 +46,44 @@ namespace graphquery::database::storage
             VALID = 0X0000
         };
 
-        explicit CDiskDriver(int map_mode_flags = MAP_SHARED, int file_mode = O_RDWR, int map_mode_prot = PROT_READ | PROT_WRITE);
+        /****************************************************************
+         * \enum EAccessHint_t
+         * \brief Expected pattern of access to a mapped file, forwarded
+         *        to the kernel to steer readahead and page reclaim.
+         *
+         * \param normal     - default readahead
+         * \param sequential - ascending scan, aggressive readahead
+         * \param random     - point lookups, without readahead
+         ***************************************************************/
+        enum class EAccessHint_t : uint8_t
+        {
+            normal     = 0,
+            sequential = 1,
+            random     = 2
+        };
+
+        /****************************************************************
+         * \struct SAccessScope_t
+         * \brief Applies an access hint to the whole file for the
+         *        lifetime of the scope, restoring the hint of the file
+         *        once the last open scope ends.
+         ***************************************************************/
+        struct SAccessScope_t
+        {
+            SAccessScope_t(CDiskDriver & file, EAccessHint_t hint) noexcept;
+            ~SAccessScope_t();
+            SAccessScope_t(const SAccessScope_t &)             = delete;
+            SAccessScope_t & operator=(const SAccessScope_t &) = delete;
+
+          private:
+            CDiskDriver & m_file;
+        };
+
+        explicit CDiskDriver(int map_mode_flags = MAP_SHARED, int file_mode = O_RDWR, int map_mode_prot = PROT_READ | PROT_WRITE, int64_t reserved_size = 0);
         ~CDiskDriver();
 
-        static constexpr auto PAGE_SIZE  = KB(4);
+        static constexpr auto PAGE_SIZE      = KB(4);
+        static constexpr auto HUGE_PAGE_SIZE = MB(2);
         CDiskDriver(CDiskDriver &&)      = delete;
         CDiskDriver(const CDiskDriver &) = delete;
 
@@ -65,12 +105,11 @@ namespace graphquery::database::storage
         template<bool write>
         void * ref(int64_t seek, const int64_t size) noexcept
         {
-            static char * ptr = nullptr;
+            char * ptr = nullptr;
             seek              = seek == -1 ? m_seek_offset : seek;
             if (this->m_initialised)
             {
-                if (m_fd_info.st_size <= seek + size)
-                    resize((seek + size) * 2);
+                ensure_mapped(seek + size);
 
                 if constexpr (write)
                     m_writer_lock.lock();
@@ -92,11 +131,10 @@ namespace graphquery::database::storage
         template<bool write>
         void * ref_update(const int64_t size) noexcept
         {
-            static char * ptr = nullptr;
+            char * ptr = nullptr;
             if (this->m_initialised)
             {
-                if (m_fd_info.st_size <= m_seek_offset + size)
-                    resize((m_seek_offset + size) * 2);
+                ensure_mapped(m_seek_offset + size);
 
                 if constexpr (write)
                     m_writer_lock.lock();
@@ -129,8 +167,21 @@ namespace graphquery::database::storage
         void resize(int64_t file_size) noexcept;
         void resize_override(int64_t file_size) noexcept;
         void set_path(std::filesystem::path file_path) noexcept;
+        void set_access_hint(EAccessHint_t hint) noexcept;
+        void set_huge_pages(bool huge_pages) noexcept;
+        void set_populate(bool populate) noexcept;
+        void set_reserve_factor(uint8_t reserve_factor) noexcept;
+        void set_dirty_tracking(bool dirty_tracking) noexcept;
+        inline void mark_dirty(int64_t offset, int64_t size) noexcept;
+        void start_flusher(std::chrono::milliseconds interval) noexcept;
+        void stop_flusher() noexcept;
+        [[nodiscard]] SAccessScope_t scoped_access(EAccessHint_t hint) noexcept;
+        [[maybe_unused]] SRet_t advise(EAccessHint_t hint, int64_t offset = 0, int64_t size = -1) const noexcept;
+        [[maybe_unused]] SRet_t prefetch(int64_t offset = 0, int64_t size = -1) const noexcept;
         [[nodiscard]] SRet_t sync() const noexcept;
         [[nodiscard]] SRet_t async() const noexcept;
+        [[maybe_unused]] SRet_t save_to(const std::filesystem::path & folder_path) const noexcept;
+        [[maybe_unused]] SRet_t restore_from(const std::filesystem::path & folder_path) noexcept;
         [[nodiscard]] char operator[](int64_t idx) const noexcept;
         [[nodiscard]] bool check_if_initialised() const noexcept;
         [[nodiscard]] std::filesystem::path get_path() const noexcept;
@@ -138,6 +189,7 @@ namespace graphquery::database::storage
         [[nodiscard]] static bool check_if_folder_exists(std::string_view file_path) noexcept;
         [[nodiscard]] static bool check_if_file_exists(std::string_view path, std::string_view file_name) noexcept;
         [[maybe_unused]] static SRet_t create_folder(const std::filesystem::path & path, std::string_view folder_name);
+        [[maybe_unused]] static SRet_t sync_folder(const std::filesystem::path & folder_path);
         [[maybe_unused]] static SRet_t create_file(const std::filesystem::path & path, std::string_view file_name, int64_t file_size = PAGE_SIZE);
 
         static constexpr auto DEFAULT_FILE_SIZE = PAGE_SIZE;
@@ -152,6 +204,19 @@ namespace graphquery::database::storage
         [[maybe_unused]] SRet_t map() noexcept;
         [[maybe_unused]] SRet_t remap(int64_t old_size) noexcept;
         [[maybe_unused]] SRet_t truncate(int64_t) noexcept;
+        [[maybe_unused]] SRet_t reserve() noexcept;
+        [[maybe_unused]] SRet_t map_range(int64_t offset, int64_t size, int extra_flags = 0) noexcept;
+        [[maybe_unused]] SRet_t madvise_range(int advice, int64_t offset, int64_t size) const noexcept;
+        void apply_hints(int64_t offset, int64_t size) const noexcept;
+        [[nodiscard]] int populate_flags() const noexcept;
+        [[nodiscard]] SRet_t flush_dirty(int flags) const noexcept;
+        [[nodiscard]] SRet_t msync_range(int64_t offset, int64_t size, int flags) const noexcept;
+        [[maybe_unused]] SRet_t release_range(int64_t offset, int64_t size) noexcept;
+
+        void grow_in_place(int64_t file_size) noexcept;
+        void extend_in_background(int64_t file_size) noexcept;
+        void wait_for_extension() noexcept;
+        inline void ensure_mapped(int64_t end_addr) noexcept;
 
         inline static int64_t resize_to_pagesize(int64_t size) noexcept;
 
@@ -169,5 +234,44 @@ namespace graphquery::database::storage
         int64_t m_seek_offset        = {}; //~ Current offset within the memory map.
         char * m_memory_mapped_file  = {}; //~ buffer address of the memory mapped file.
         std::filesystem::path m_path = {}; //~ Set path of the current context.
+
+        int64_t m_reserved_size            = {}; //~ Address space reserved for the mapping to grow into, zero maps the file alone.
+        int64_t m_reserved_min             = {}; //~ Least address space reserved, whatever the size of the file.
+        uint8_t m_reserve_factor           = 2;  //~ Multiple of the file size reserved once mapped.
+        std::atomic<int64_t> m_mapped_size = {}; //~ Bytes of the file currently accessible through the mapping.
+        std::atomic<bool> m_extending      = {}; //~ Whether an extension is running in the background.
+        std::mutex m_resize_lock           = {}; //~ Serialises growth within the reservation.
+        std::mutex m_extension_lock        = {}; //~ Guards the handle of the background extension.
+        std::future<void> m_extension      = {}; //~ Background extension ahead of the accessed region.
+
+        EAccessHint_t m_access_hint        = {}; //~ Hint applied to the file outside of access scopes.
+        std::atomic<uint32_t> m_scope_c    = {}; //~ Amount of open access scopes overriding the hint.
+        bool m_huge_pages                  = {}; //~ Whether the mapping is aligned and advised for transparent huge pages.
+        bool m_populate                    = {}; //~ Whether the file is faulted in entirely when opened.
+
+        std::unique_ptr<CDirtyPageSet> m_dirty_pages = {}; //~ Pages written since the last sync, when tracked.
+        mutable std::mutex m_flush_lock              = {}; //~ Orders flushes, such that a sync waits upon the ranges a concurrent one drained.
+        std::mutex m_flusher_wait_lock               = {}; //~ Guards the sleep of the background flusher.
+        std::condition_variable_any m_flusher_cv     = {}; //~ Wakes the background flusher once stopped.
+        std::jthread m_flusher                       = {}; //~ Background flusher of the tracked pages.
     };
+
+    inline void
+    CDiskDriver::mark_dirty(const int64_t offset, const int64_t size) noexcept
+    {
+        if (m_dirty_pages != nullptr)
+            m_dirty_pages->mark(offset, size);
+    }
+
+    inline void
+    CDiskDriver::ensure_mapped(const int64_t end_addr) noexcept
+    {
+        const int64_t mapped_size = m_mapped_size.load(std::memory_order_acquire);
+
+        if (mapped_size <= end_addr)
+            resize(end_addr * 2);
+        //~ Extend ahead of the accessed region, such that growth is rarely waited upon.
+        else if (m_reserved_size > 0 && end_addr * 4 > mapped_size * 3)
+            extend_in_background(mapped_size * 2);
+    }
 } // namespace graphquery::database::storage
\ No newline at end of file
@@ -15,10 +15,14 @@
 #include "config.h"
 #include "memory_model.h"
 
+#include <bitset>
 #include <cstdint>
 #include <functional>
+#include <limits>
 #include <vector>
 #include <optional>
+#include <string>
+#include <string_view>
 #include <unordered_set>
 
 namespace graphquery::database::storage
@@ -83,15 +87,43 @@ namespace graphquery::database::storage
             }
         };
 
+        /****************************************************************
+         * \struct STemporalEdge_t
+         * \brief Structure of an edge within a temporal index, paired
+         *        with the timestamp it is ordered by.
+         *
+         * \param edge SEdge_t      - edge entry of the adjacency
+         * \param timestamp int64_t - value of the indexed timestamp property
+         ***************************************************************/
+        struct STemporalEdge_t
+        {
+            SEdge_t edge      = {};
+            int64_t timestamp = {};
+        };
+
+        /****************************************************************
+         * \struct SVertex_t
+         * \brief Structure of a vertex within the graph
+         *
+         * \param id Id_t                    - unique identifier of the vertex
+         * \param property_id Id_t           - head of the property chain
+         * \param label_id Id_t              - head of the label ref chain (kept for older graphs)
+         * \param outdegree uint32_t         - amount of outgoing edges
+         * \param indegree uint32_t          - amount of incoming edges
+         * \param property_c uint16_t        - amount of properties
+         * \param edge_label_c uint16_t      - amount of distinct outgoing edge labels
+         * \param label_mask std::bitset<>   - set of the vertex label ids of the vertex
+         ***************************************************************/
         struct SVertex_t
         {
-            Id_t id               = {};
-            Id_t property_id      = {};
-            Id_t label_id         = {};
-            uint32_t outdegree    = {};
-            uint32_t indegree     = {};
-            uint16_t property_c   = {};
-            uint16_t edge_label_c = {};
+            Id_t id                                               = {};
+            Id_t property_id                                      = {};
+            Id_t label_id                                         = {};
+            uint32_t outdegree                                    = {};
+            uint32_t indegree                                     = {};
+            uint16_t property_c                                   = {};
+            uint16_t edge_label_c                                 = {};
+            std::bitset<CFG_LPG_VERTEX_LABELS_MAX_AMT> label_mask = {};
 
             SVertex_t() = default;
 
@@ -104,6 +136,7 @@ namespace graphquery::database::storage
                 this->property_c   = cpy.property_c;
                 this->label_id     = cpy.label_id;
                 this->edge_label_c = cpy.edge_label_c;
+                this->label_mask   = cpy.label_mask;
             }
 
             SVertex_t & operator=(const SVertex_t & cpy)
@@ -115,29 +148,133 @@ namespace graphquery::database::storage
                 this->property_c   = cpy.property_c;
                 this->label_id     = cpy.label_id;
                 this->edge_label_c = cpy.edge_label_c;
+                this->label_mask   = cpy.label_mask;
                 return *this;
             }
         };
 
-	struct SProperty_t
-	{
-    	    char key[CFG_LPG_PROPERTY_KEY_LENGTH]     = {0};
-    	    char value[CFG_LPG_PROPERTY_VALUE_LENGTH] = {0};
+        /****************************************************************
+         * \struct SProperty_t
+         * \brief Structure of a property key value pair, the value is
+         *        of any length and stored within the heap when too long
+         *        to be held inline.
+         *
+         * \param key std::string   - key of the property
+         * \param value std::string - value of the property
+         ***************************************************************/
+        struct SProperty_t
+        {
+            std::string key   = {};
+            std::string value = {};
 
-    	    SProperty_t() = default;
+            SProperty_t() = default;
+            SProperty_t(const std::string_view & k, const std::string_view & v): key(k), value(v) {}
+        };
 
-    	    SProperty_t(const std::string_view &k, const std::string_view &v)
-    	    {
-        	size_t keyLength = std::min(k.length(), static_cast<size_t>(CFG_LPG_PROPERTY_KEY_LENGTH - 1));
-        	size_t valueLength = std::min(v.length(), static_cast<size_t>(CFG_LPG_PROPERTY_VALUE_LENGTH - 1));
+        /****************************************************************
+         * \enum EMutationType_t
+         * \brief Kind of a mutation buffered by a transaction.
+         *
+         * \param add_vertex - insert a vertex, of the given id or the next
+         * \param add_edge   - insert an edge between two vertices
+         * \param rm_vertex  - remove a vertex along with its edges
+         * \param rm_edge    - remove the edges between two vertices
+         ***************************************************************/
+        enum class EMutationType_t : uint8_t
+        {
+            add_vertex = 0,
+            add_edge   = 1,
+            rm_vertex  = 2,
+            rm_edge    = 3
+        };
 
-        	std::copy_n(k.data(), keyLength, key);
-        	key[keyLength] = '\0';
+        /****************************************************************
+         * \struct SMutation_t
+         * \brief Mutation buffered by a transaction, applied once the
+         *        transaction commits.
+         *
+         * \param type EMutationType_t      - kind of the mutation
+         * \param src Id_t                  - vertex mutated, or source of the edge (max assigns the next id)
+         * \param dst Id_t                  - destination of the edge
+         * \param undirected bool           - whether the edge is inserted in both directions
+         * \param edge_label std::string    - label of the edge, empty removes edges of any label
+         * \param labels std::vector<>      - labels of the vertex
+         * \param props std::vector<>       - properties of the vertex or edge
+         ***************************************************************/
+        struct SMutation_t
+        {
+            EMutationType_t type            = {};
+            Id_t src                        = std::numeric_limits<Id_t>::max();
+            Id_t dst                        = {};
+            bool undirected                 = {};
+            std::string edge_label          = {};
+            std::vector<std::string> labels = {};
+            std::vector<SProperty_t> props  = {};
+        };
 
-        	std::copy_n(v.data(), valueLength, value);
-       		value[valueLength] = '\0';
-    	    }
-	};
+        /****************************************************************
+         * \struct STransaction_t
+         * \brief Handle of a multi statement transaction. Mutations are
+         *        buffered until committed, at which point the model logs
+         *        them as a single group, synced once and applied as a
+         *        whole, or not at all should one of them fail. Aborting
+         *        discards the buffered mutations.
+         ***************************************************************/
+        struct STransaction_t
+        {
+            void add_vertex(const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & props) { add_vertex(std::numeric_limits<Id_t>::max(), labels, props); }
+
+            void add_vertex(const Id_t id, const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & props)
+            {
+                auto & mutation = mutations.emplace_back(SMutation_t {.type = EMutationType_t::add_vertex, .src = id, .props = props});
+                mutation.labels.assign(labels.begin(), labels.end());
+            }
+
+            void add_edge(const Id_t src, const Id_t dst, const std::string_view edge_label, const std::vector<SProperty_t> & props, const bool undirected = false)
+            {
+                mutations.emplace_back(SMutation_t {.type = EMutationType_t::add_edge, .src = src, .dst = dst, .undirected = undirected, .edge_label = std::string(edge_label), .props = props});
+            }
+
+            void rm_vertex(const Id_t id) { mutations.emplace_back(SMutation_t {.type = EMutationType_t::rm_vertex, .src = id}); }
+
+            void rm_edge(const Id_t src, const Id_t dst, const std::string_view edge_label = "")
+            {
+                mutations.emplace_back(SMutation_t {.type = EMutationType_t::rm_edge, .src = src, .dst = dst, .edge_label = std::string(edge_label)});
+            }
+
+            std::vector<SMutation_t> mutations = {};
+        };
+
+        /****************************************************************
+         * \enum EColumnType_t
+         * \brief Declared type of a property column, each value is held
+         *        within 8 bytes regardless of the type.
+         *
+         * \param int64   - signed integer
+         * \param date    - milliseconds since epoch, parsed from either millis or iso dates
+         * \param float64 - double, held by its bit pattern
+         * \param string  - dictionary encoded, held by the id of the distinct string
+         ***************************************************************/
+        enum class EColumnType_t : uint8_t
+        {
+            int64   = 0,
+            date    = 1,
+            float64 = 2,
+            string  = 3
+        };
+
+        /****************************************************************
+         * \enum EIndexType_t
+         * \brief Declared kind of a secondary property index.
+         *
+         * \param hash    - equality lookups on the value as stored
+         * \param ordered - range lookups on the value parsed by its declared type
+         ***************************************************************/
+        enum class EIndexType_t : uint8_t
+        {
+            hash    = 0,
+            ordered = 1
+        };
 
         [[nodiscard]] virtual uint16_t get_num_vertex_labels() = 0;
         [[nodiscard]] virtual uint16_t get_num_edge_labels() = 0;
@@ -146,10 +283,10 @@ namespace graphquery::database::storage
         virtual std::vector<SVertex_t> get_vertices_by_label(std::string_view label_id) = 0;
 
         virtual std::vector<SProperty_t> get_properties_by_id(int64_t id) = 0;
-        virtual std::vector<SProperty_t> get_properties_by_property_id(uint32_t id) = 0;
+        virtual std::vector<SProperty_t> get_properties_by_property_id(Id_t id) = 0;
         virtual std::vector<SProperty_t> get_properties_by_vertex(Id_t id) = 0;
         virtual std::unordered_map<std::string, std::string> get_properties_by_id_map(int64_t id) = 0;
-        virtual std::unordered_map<std::string, std::string> get_properties_by_property_id_map(uint32_t id) = 0;
+        virtual std::unordered_map<std::string, std::string> get_properties_by_property_id_map(Id_t id) = 0;
         virtual std::unordered_map<std::string, std::string> get_properties_by_vertex_map(Id_t id) = 0;
 
         virtual std::vector<SEdge_t> get_edges(Id_t src, Id_t dst) = 0;
@@ -168,6 +305,24 @@ namespace graphquery::database::storage
         virtual std::vector<SEdge_t> get_edges(std::string_view vertex_label, std::string_view edge_label, Id_t dst) = 0;
         virtual std::vector<SEdge_t> get_edges_by_offset(Id_t vertex_id, std::string_view edge_label, std::string_view vertex_label) = 0;
 
+        virtual bool create_temporal_index(std::string_view vertex_label, std::string_view edge_label, std::string_view property_key, bool incoming, bool edge_property = false) = 0;
+        virtual std::optional<std::vector<STemporalEdge_t>> get_recent_edges(Id_t vertex_id,
+                                                                             std::string_view vertex_label,
+                                                                             std::string_view edge_label,
+                                                                             bool incoming,
+                                                                             size_t limit,
+                                                                             int64_t max_timestamp = std::numeric_limits<int64_t>::max()) = 0;
+
+        virtual bool create_property_column(std::string_view vertex_label, std::string_view property_key, EColumnType_t type) = 0;
+        virtual std::optional<uint8_t> get_property_column(std::string_view vertex_label, std::string_view property_key) = 0;
+        virtual std::optional<int64_t> get_column_value(uint8_t column_id, Id_t vertex_offset) = 0;
+        virtual std::optional<std::string> get_column_string(uint8_t column_id, Id_t vertex_offset) = 0;
+        virtual bool scan_property_column(uint8_t column_id, const std::function<void(const int64_t * values, const uint8_t * valid, int64_t value_c)> & func) = 0;
+
+        virtual bool create_property_index(std::string_view vertex_label, std::string_view property_key, EIndexType_t index_type, EColumnType_t value_type = EColumnType_t::string) = 0;
+        virtual std::optional<std::vector<Id_t>> get_vertices_by_property(std::string_view vertex_label, std::string_view property_key, std::string_view value) = 0;
+        virtual std::optional<std::vector<Id_t>> get_vertices_by_property_range(std::string_view vertex_label, std::string_view property_key, std::string_view lower, std::string_view upper) = 0;
+
         virtual void rm_vertex(Id_t vertex_id) = 0;
         virtual void rm_edge(Id_t src, Id_t dst) = 0;
         virtual void rm_edge(Id_t src, Id_t dst, std::string_view edge_label) = 0;
@@ -175,6 +330,18 @@ namespace graphquery::database::storage
         virtual void add_vertex(const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & prop) = 0;
         virtual void add_edge(Id_t src, Id_t dst, std::string_view edge_label, const std::vector<SProperty_t> & prop, bool undirected = false) = 0;
 
+        [[nodiscard]] STransaction_t begin_transaction() const noexcept { return {}; }
+        void abort_transaction(STransaction_t & transaction) const noexcept { transaction.mutations.clear(); }
+
+        //~ Returns whether every statement was applied and made durable. Should a statement fail, those applied before it are reverted,
+        //~ such that the transaction leaves no change. The buffered statements are consumed either way.
+        [[nodiscard]] virtual bool commit_transaction(STransaction_t & transaction) = 0;
+
+        //~ Inserts bypassing the transaction log. None of the rows are recoverable after a crash until the bulk load is finished,
+        //~ which returns whether they were made durable.
+        virtual void bulk_load(STransaction_t & batch, bool deduplicated) = 0;
+        [[nodiscard]] virtual bool finish_bulk_load() = 0;
+
     protected:
         const bool & _sync_state_;
         std::shared_ptr<graphquery::logger::CLogSystem> m_log_system;
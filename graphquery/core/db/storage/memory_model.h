@@ -16,6 +16,7 @@
 #include "diskdriver/diskdriver.h"
 #include "db/storage/model.h"
 
+#include <optional>
 #include <string_view>
 
 namespace graphquery::database::storage
@@ -40,6 +41,9 @@ namespace graphquery::database::storage
         virtual void load_graph(std::filesystem::path path, std::string_view graph) noexcept = 0;
         virtual void create_graph(std::filesystem::path path, std::string_view graph) noexcept = 0;
 
+        //~ Whether the graph was created or loaded, a model failing to load is unusable and is closed by the caller.
+        [[nodiscard]] virtual bool check_if_loaded() const noexcept { return true; }
+
     private:
         virtual void init(const std::filesystem::path path, std::string_view graph) final
         {
@@ -31,6 +31,7 @@ namespace graphquery::database::storage
         virtual int64_t get_total_num_vertices() noexcept = 0;
         virtual void edgemap(const std::unique_ptr<analytic::IRelax> & relax) = 0;
         virtual void src_edgemap(Id_t vertex_offset, const std::function<void(int64_t src, int64_t dst)> &) = 0;
+        virtual void dst_edgemap(Id_t vertex_offset, const std::function<bool(int64_t src, int64_t dst)> &) = 0;
         virtual std::unique_ptr<std::vector<std::vector<int64_t>>> make_inverse_graph() noexcept = 0;
     };
 } // namespace graphquery::database::storage
\ No newline at end of file
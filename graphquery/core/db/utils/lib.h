@@ -1,107 +1,203 @@
-/************************************************************
- * \author Ryan Skelton
- * \date 18/09/2023
- * \file lib.h
- * \brief Header of commonly used functions within the core
- *        segment of the program, which can be included and
- *        utilised by other translation units.
- ************************************************************/
-
-#pragma once
-
-#include <climits>
-#include <algorithm>
-
-namespace graphquery::database::utils
-{
-    template<typename T>
-    struct STimedResult_t
-    {
-        T result;
-        std::chrono::duration<double> elapsed;
-    };
-
-    template<>
-    struct STimedResult_t<void>
-    {
-        std::chrono::duration<double> elapsed;
-    };
-
-    template<typename T>
-    T operator|(T lhs, T rhs)
-    {
-        using u_t = typename std::underlying_type_t<T>;
-        return static_cast<T>(static_cast<u_t>(lhs) | static_cast<u_t>(rhs));
-    }
-
-    inline int32_t abs(const int32_t val) noexcept
-    {
-        int const mask = val >> (sizeof(int) * CHAR_BIT - 1);
-        return (val + mask) ^ mask;
-    }
-
-    inline int64_t ceilaferdiv(const int64_t _x, const int64_t _y)
-    {
-        return 1LL + ((_x - 1LL) / _y);
-    }
-
-    // Converts a string to lowercase
-    inline std::string to_lower_case(std::string to_convert)
-    {
-        for (char & i : to_convert)
-            i = i | 32;
-
-        return to_convert;
-    }
-
-    // Converts a string to lowercase
-    inline std::string to_upper_case(std::string to_convert)
-    {
-        for (char & i : to_convert)
-            i = i & ~32;
-
-        return to_convert;
-    }
-
-    inline std::vector<std::string> split(std::string_view in, const char sep)
-    {
-        std::vector<std::string> ret;
-        ret.reserve(std::count(in.begin(), in.end(), sep) + 1); // optional
-        for (auto p = in.begin();; ++p)
-        {
-            auto q = p;
-            p      = std::find(p, in.end(), sep);
-            ret.emplace_back(q, p);
-            if (p == in.end())
-                return ret;
-        }
-    }
-
-    template<typename Ret, typename Func, typename Obj, typename... Args>
-    inline constexpr auto measure(Func && func, const Obj & obj, Args &&... args) -> STimedResult_t<Ret>
-    {
-        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
-
-        // Use std::invoke to call the function, which handles both member functions and function pointers
-        auto func_result = std::invoke(std::forward<Func>(func), obj, std::forward<Args>(args)...);
-
-        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
-        const std::chrono::duration<double> elapsed     = end - start;
-
-        return STimedResult_t<Ret> {func_result, elapsed};
-    }
-
-    template<typename Func, typename Obj, typename... Args>
-    inline constexpr auto measure(Func && func, const Obj & obj, Args &&... args) -> STimedResult_t<void>
-    {
-        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
-
-        // Use std::invoke to call the function, which handles both member functions and function pointers
-        std::invoke(std::forward<Func>(func), obj, std::forward<Args>(args)...);
-
-        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
-        const std::chrono::duration<double> elapsed     = end - start;
-
-        return STimedResult_t<void> {elapsed};
-    }
-} // namespace graphquery::database::utils
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file lib.h
+ * \brief Header of commonly used functions within the core
+ *        segment of the program, which can be included and
+ *        utilised by other translation units.
+ ************************************************************/
+
+#pragma once
+
+#include <climits>
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <optional>
+#include <string_view>
+
+namespace graphquery::database::utils
+{
+    template<typename T>
+    struct STimedResult_t
+    {
+        T result;
+        std::chrono::duration<double> elapsed;
+    };
+
+    template<>
+    struct STimedResult_t<void>
+    {
+        std::chrono::duration<double> elapsed;
+    };
+
+    template<typename T>
+    T operator|(T lhs, T rhs)
+    {
+        using u_t = typename std::underlying_type_t<T>;
+        return static_cast<T>(static_cast<u_t>(lhs) | static_cast<u_t>(rhs));
+    }
+
+    inline int32_t abs(const int32_t val) noexcept
+    {
+        int const mask = val >> (sizeof(int) * CHAR_BIT - 1);
+        return (val + mask) ^ mask;
+    }
+
+    inline int64_t ceilaferdiv(const int64_t _x, const int64_t _y)
+    {
+        return 1LL + ((_x - 1LL) / _y);
+    }
+
+    // Converts a string to lowercase
+    inline std::string to_lower_case(std::string to_convert)
+    {
+        for (char & i : to_convert)
+            i = i | 32;
+
+        return to_convert;
+    }
+
+    // Converts a string to lowercase
+    inline std::string to_upper_case(std::string to_convert)
+    {
+        for (char & i : to_convert)
+            i = i & ~32;
+
+        return to_convert;
+    }
+
+    inline std::vector<std::string> split(std::string_view in, const char sep)
+    {
+        std::vector<std::string> ret;
+        ret.reserve(std::count(in.begin(), in.end(), sep) + 1); // optional
+        for (auto p = in.begin();; ++p)
+        {
+            auto q = p;
+            p      = std::find(p, in.end(), sep);
+            ret.emplace_back(q, p);
+            if (p == in.end())
+                return ret;
+        }
+    }
+
+    //~ Parses a date into milliseconds since epoch, either given directly or as yyyy-mm-dd[Thh:mm[:ss[.sss]][Z|+hhmm|+hh:mm]],
+    //~ rejecting the value unless it is consumed entirely.
+    inline std::optional<int64_t> parse_date(const std::string_view value) noexcept
+    {
+        int64_t ret = {};
+
+        if (const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), ret); ec == std::errc() && ptr == value.data() + value.size())
+            return ret;
+
+        const auto field = [&value](const size_t pos, const size_t len) -> std::optional<int32_t>
+        {
+            int32_t field_value = {};
+            if (value.size() < pos + len || !std::all_of(value.begin() + pos, value.begin() + pos + len, [](const char c) -> bool { return c >= '0' && c <= '9'; }))
+                return std::nullopt;
+            if (const auto [ptr, ec] = std::from_chars(value.data() + pos, value.data() + pos + len, field_value); ec != std::errc() || ptr != value.data() + pos + len)
+                return std::nullopt;
+            return field_value;
+        };
+
+        const auto year = field(0, 4), month = field(5, 2), day = field(8, 2);
+        if (!(year.has_value() && month.has_value() && day.has_value()) || value[4] != '-' || value[7] != '-')
+            return std::nullopt;
+
+        const std::chrono::year_month_day ymd {std::chrono::year {*year}, std::chrono::month {static_cast<uint32_t>(*month)}, std::chrono::day {static_cast<uint32_t>(*day)}};
+        if (!ymd.ok())
+            return std::nullopt;
+
+        ret        = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::sys_days {ymd}.time_since_epoch()).count();
+        size_t pos = 10;
+
+        if (pos == value.size())
+            return ret;
+
+        if (value[pos] != 'T' && value[pos] != ' ')
+            return std::nullopt;
+
+        const auto hour = field(11, 2), minute = field(14, 2);
+        if (!(hour.has_value() && minute.has_value()) || value[13] != ':' || *hour > 23 || *minute > 59)
+            return std::nullopt;
+
+        ret += (*hour * 3600LL + *minute * 60LL) * 1000LL;
+        pos = 16;
+
+        if (pos < value.size() && value[pos] == ':')
+        {
+            const auto second = field(17, 2);
+            if (!second.has_value() || *second > 60)
+                return std::nullopt;
+
+            ret += *second * 1000LL;
+            pos = 19;
+
+            //~ Fractions beyond milliseconds are truncated.
+            if (pos < value.size() && value[pos] == '.')
+            {
+                int32_t millis = 0;
+                size_t digit_c = 0;
+
+                for (pos++; pos < value.size() && value[pos] >= '0' && value[pos] <= '9'; pos++, digit_c++)
+                    if (digit_c < 3)
+                        millis = millis * 10 + (value[pos] - '0');
+
+                if (digit_c == 0)
+                    return std::nullopt;
+
+                for (; digit_c < 3; digit_c++)
+                    millis *= 10;
+
+                ret += millis;
+            }
+        }
+
+        if (pos == value.size())
+            return ret;
+
+        if (value[pos] == 'Z')
+            return pos + 1 == value.size() ? std::optional<int64_t>(ret) : std::nullopt;
+
+        //~ An offset from utc, of the form +hhmm or +hh:mm.
+        if (value[pos] != '+' && value[pos] != '-')
+            return std::nullopt;
+
+        const bool separated = value.size() == pos + 6 && value[pos + 3] == ':';
+        const auto zone_hour = field(pos + 1, 2), zone_minute = field(pos + (separated ? 4 : 3), 2);
+
+        if (!(zone_hour.has_value() && zone_minute.has_value()) || value.size() != pos + (separated ? 6 : 5))
+            return std::nullopt;
+
+        const int64_t zone_offset = (*zone_hour * 60LL + *zone_minute) * 60LL * 1000LL;
+        return value[pos] == '+' ? ret - zone_offset : ret + zone_offset;
+    }
+
+    template<typename Ret, typename Func, typename Obj, typename... Args>
+    inline constexpr auto measure(Func && func, const Obj & obj, Args &&... args) -> STimedResult_t<Ret>
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        // Use std::invoke to call the function, which handles both member functions and function pointers
+        auto func_result = std::invoke(std::forward<Func>(func), obj, std::forward<Args>(args)...);
+
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        const std::chrono::duration<double> elapsed     = end - start;
+
+        return STimedResult_t<Ret> {func_result, elapsed};
+    }
+
+    template<typename Func, typename Obj, typename... Args>
+    inline constexpr auto measure(Func && func, const Obj & obj, Args &&... args) -> STimedResult_t<void>
+    {
+        const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+        // Use std::invoke to call the function, which handles both member functions and function pointers
+        std::invoke(std::forward<Func>(func), obj, std::forward<Args>(args)...);
+
+        const std::chrono::steady_clock::time_point end = std::chrono::steady_clock::now();
+        const std::chrono::duration<double> elapsed     = end - start;
+
+        return STimedResult_t<void> {elapsed};
+    }
+} // namespace graphquery::database::utils
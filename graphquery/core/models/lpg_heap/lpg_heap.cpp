@@ -0,0 +1,2214 @@
+#include "lpg_heap.h"
+
+#include "db/utils/lib.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <charconv>
+#include <cstring>
+#include <limits>
+#include <mutex>
+
+graphquery::database::storage::CMemoryModelHeapLPG::CMemoryModelHeapLPG(const std::shared_ptr<logger::CLogSystem> & log_system, const bool & sync_state_, const bool durable):
+    ILPGModel(log_system, sync_state_), m_durable(durable)
+{
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::close() noexcept
+{
+    //~ Called by the derived destructor, whilst the adjacency is still intact.
+    if (m_graph_path.empty())
+        return;
+
+    std::unique_lock lock(m_graph_lock);
+    flush_edges();
+
+    if (m_durable && m_flush_needed)
+    {
+        store_snapshot(SNAPSHOT_FILE_NAME);
+        m_flush_needed = false;
+    }
+}
+
+std::string_view
+graphquery::database::storage::CMemoryModelHeapLPG::get_name() noexcept
+{
+    return m_graph_name;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::create_rollback(const std::string_view name) noexcept
+{
+    std::unique_lock lock(m_graph_lock);
+
+    const uint8_t entry = m_rollback_c++ % ROLLBACK_MAX_AMOUNT;
+    store_snapshot(fmt::format("{}_{}", ROLLBACK_FILE_NAME, entry));
+
+    const std::string entry_name = std::string(name.substr(0, CFG_GRAPH_ROLLBACK_NAME_LENGTH - 1));
+    if (entry < m_rollback_table.size())
+        m_rollback_table[entry] = entry_name;
+    else
+        m_rollback_table.emplace_back(entry_name);
+
+    store_rollback_table();
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::rollback(const uint8_t rollback_entry) noexcept
+{
+    std::unique_lock lock(m_graph_lock);
+
+    if (rollback_entry >= m_rollback_table.size())
+    {
+        m_log_system->warning(fmt::format("Rollback entry ({}) does not exist", rollback_entry));
+        return;
+    }
+
+    m_log_system->info(fmt::format("Starting db rollback ({})", m_rollback_table[rollback_entry]));
+    const auto & [loaded, elapsed] = utils::measure<bool>(&CMemoryModelHeapLPG::load_snapshot, this, fmt::format("{}_{}", ROLLBACK_FILE_NAME, rollback_entry));
+
+    if (!loaded)
+    {
+        m_log_system->error(fmt::format("Rollback entry ({}) could not be read", rollback_entry));
+        return;
+    }
+
+    m_flush_needed = true;
+    m_log_system->info(fmt::format("Rollback has completed within {}s", elapsed.count()));
+}
+
+std::vector<std::string>
+graphquery::database::storage::CMemoryModelHeapLPG::fetch_rollback_table() const noexcept
+{
+    std::shared_lock lock(m_graph_lock);
+    return m_rollback_table;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::sync_graph() noexcept
+{
+    std::unique_lock lock(m_graph_lock);
+    flush_edges();
+
+    //~ Without durability the graph only reaches disk through a rollback snapshot.
+    if (m_durable && m_flush_needed)
+    {
+        store_snapshot(SNAPSHOT_FILE_NAME);
+        m_flush_needed = false;
+        m_log_system->debug("Graph has been synced");
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::create_graph(std::filesystem::path path, const std::string_view graph) noexcept
+{
+    std::unique_lock lock(m_graph_lock);
+
+    this->m_graph_name = graph;
+    this->m_graph_path = path;
+
+    reset_graph();
+    store_rollback_table();
+
+    if (m_durable)
+        store_snapshot(SNAPSHOT_FILE_NAME);
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::load_graph(const std::filesystem::path path, const std::string_view graph) noexcept
+{
+    std::unique_lock lock(m_graph_lock);
+
+    this->m_graph_name = graph;
+    this->m_graph_path = path;
+
+    reset_graph();
+    load_rollback_table();
+
+    if (m_durable)
+    {
+        if (!load_snapshot(SNAPSHOT_FILE_NAME))
+            m_log_system->error(fmt::format("Graph ({}) snapshot could not be read", graph));
+        return;
+    }
+
+    //~ Otherwise, restore the most recent rollback snapshot, when one was taken.
+    if (m_rollback_c > 0)
+    {
+        const uint8_t entry = (m_rollback_c - 1) % ROLLBACK_MAX_AMOUNT;
+
+        if (!load_snapshot(fmt::format("{}_{}", ROLLBACK_FILE_NAME, entry)))
+            m_log_system->error(fmt::format("Graph ({}) rollback snapshot ({}) could not be read", graph, m_rollback_table[entry]));
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::reset_graph() noexcept
+{
+    reset_edges();
+
+    m_vertices.clear();
+    m_index.clear();
+    m_free_vertices.clear();
+    m_label_vertex.clear();
+    m_property_sets.clear();
+    m_free_property_sets.clear();
+    m_vertex_labels.clear();
+    m_edge_labels.clear();
+    m_property_keys.clear();
+    m_v_label_map.clear();
+    m_e_label_map.clear();
+    m_p_key_map.clear();
+    m_temporal_indexes.clear();
+    m_property_columns.clear();
+    m_property_indexes.clear();
+
+    m_vertices_c   = 0;
+    m_edges_c      = 0;
+    m_flush_needed = false;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::store_rollback_table() const noexcept
+{
+    CSnapshotFile table_file;
+
+    if (!table_file.open(m_graph_path, ROLLBACK_FILE_NAME, true))
+        return;
+
+    table_file.begin_write();
+    table_file.write(m_rollback_c);
+    table_file.write(static_cast<uint8_t>(m_rollback_table.size()));
+
+    for (const auto & name : m_rollback_table)
+        table_file.write_string(name);
+
+    table_file.end_write();
+    table_file.close();
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::load_rollback_table() noexcept
+{
+    CSnapshotFile table_file;
+    m_rollback_table.clear();
+    m_rollback_c = 0;
+
+    if (!table_file.open(m_graph_path, ROLLBACK_FILE_NAME, false))
+        return;
+
+    if (table_file.begin_read())
+    {
+        m_rollback_c               = table_file.read<uint8_t>();
+        const uint8_t rollback_c   = table_file.read<uint8_t>();
+
+        for (uint8_t i = 0; i < rollback_c; i++)
+            m_rollback_table.emplace_back(table_file.read_string());
+    }
+
+    table_file.close();
+}
+
+bool
+graphquery::database::storage::CMemoryModelHeapLPG::store_snapshot(const std::string_view file_name) noexcept
+{
+    CSnapshotFile snapshot;
+
+    if (!snapshot.open(m_graph_path, file_name, true))
+    {
+        m_log_system->error(fmt::format("Snapshot ({}) could not be opened", file_name));
+        return false;
+    }
+
+    snapshot.begin_write();
+
+    //~ Labels and keys.
+    snapshot.write(static_cast<uint16_t>(m_vertex_labels.size()));
+    for (const auto & label : m_vertex_labels)
+        snapshot.write(label);
+
+    snapshot.write(static_cast<uint16_t>(m_edge_labels.size()));
+    for (const auto & label : m_edge_labels)
+        snapshot.write(label);
+
+    snapshot.write(static_cast<uint16_t>(m_property_keys.size()));
+    for (const auto & key : m_property_keys)
+        snapshot.write_string(key);
+
+    //~ Vertices, by offset such that the adjacency remains valid once read.
+    snapshot.write(static_cast<Id_t>(m_vertices.size()));
+    for (const auto & [metadata, valid] : m_vertices)
+    {
+        snapshot.write(static_cast<uint8_t>(valid));
+
+        if (!valid)
+            continue;
+
+        snapshot.write(metadata.id);
+        snapshot.write(metadata.property_id);
+        snapshot.write(metadata.property_c);
+        snapshot.write(static_cast<uint16_t>(metadata.label_mask.count()));
+
+        for (uint16_t label_id = 0; label_id < VERTEX_LABELS_MAX_AMT; label_id++)
+        {
+            if (metadata.label_mask[label_id])
+                snapshot.write(label_id);
+        }
+    }
+
+    //~ Property sets, along with their free list.
+    snapshot.write(static_cast<Id_t>(m_property_sets.size()));
+    for (const auto & property_set : m_property_sets)
+    {
+        snapshot.write(static_cast<uint16_t>(property_set.size()));
+
+        for (const auto & [key_id, value] : property_set)
+        {
+            snapshot.write(key_id);
+            snapshot.write_string(value);
+        }
+    }
+
+    snapshot.write(static_cast<Id_t>(m_free_property_sets.size()));
+    for (const auto property_id : m_free_property_sets)
+        snapshot.write(property_id);
+
+    //~ Outgoing edges, the incoming adjacency is derived once read.
+    snapshot.write(m_edges_c);
+    for (Id_t i = 0; i < m_vertices.size(); i++)
+    {
+        if (!m_vertices[i].valid)
+            continue;
+
+        scan_out_edges(i,
+                       std::nullopt,
+                       [&snapshot](const SEdge_t & edge) -> void { snapshot.write(SPlainEdge_t {edge.src, edge.dst, edge.property_id, edge.edge_label_id, edge.property_c}); });
+    }
+
+    //~ Index declarations, their contents are rebuilt once read.
+    snapshot.write(static_cast<uint8_t>(m_temporal_indexes.size()));
+    for (const auto & index : m_temporal_indexes)
+    {
+        snapshot.write_string(index.vertex_label);
+        snapshot.write_string(index.edge_label);
+        snapshot.write_string(index.property_key);
+        snapshot.write(index.incoming);
+        snapshot.write(index.edge_property);
+    }
+
+    snapshot.write(static_cast<uint8_t>(m_property_columns.size()));
+    for (const auto & column : m_property_columns)
+    {
+        snapshot.write_string(column.vertex_label);
+        snapshot.write_string(column.property_key);
+        snapshot.write(column.type);
+    }
+
+    snapshot.write(static_cast<uint8_t>(m_property_indexes.size()));
+    for (const auto & index : m_property_indexes)
+    {
+        snapshot.write_string(index.vertex_label);
+        snapshot.write_string(index.property_key);
+        snapshot.write(index.index_type);
+        snapshot.write(index.value_type);
+    }
+
+    snapshot.end_write();
+    snapshot.close();
+    return true;
+}
+
+bool
+graphquery::database::storage::CMemoryModelHeapLPG::load_snapshot(const std::string_view file_name) noexcept
+{
+    CSnapshotFile snapshot;
+
+    if (!snapshot.open(m_graph_path, file_name, false))
+        return false;
+
+    if (!snapshot.begin_read())
+    {
+        snapshot.close();
+        return false;
+    }
+
+    reset_graph();
+
+    //~ Labels and keys.
+    m_vertex_labels.resize(snapshot.read<uint16_t>());
+    m_label_vertex.resize(m_vertex_labels.size());
+    for (auto & label : m_vertex_labels)
+    {
+        label                            = snapshot.read<SLabel_t>();
+        m_v_label_map[label.label_s]     = label.label_id;
+    }
+
+    m_edge_labels.resize(snapshot.read<uint16_t>());
+    for (auto & label : m_edge_labels)
+    {
+        label                        = snapshot.read<SLabel_t>();
+        m_e_label_map[label.label_s] = label.label_id;
+    }
+
+    m_property_keys.resize(snapshot.read<uint16_t>());
+    for (uint16_t key_id = 0; key_id < m_property_keys.size(); key_id++)
+    {
+        m_property_keys[key_id]              = snapshot.read_string();
+        m_p_key_map[m_property_keys[key_id]] = key_id;
+    }
+
+    //~ Vertices.
+    m_vertices.resize(snapshot.read<Id_t>());
+    for (Id_t i = 0; i < m_vertices.size(); i++)
+    {
+        auto & [metadata, valid] = m_vertices[i];
+        valid                    = snapshot.read<uint8_t>();
+
+        if (!valid)
+        {
+            m_free_vertices.emplace_back(i);
+            continue;
+        }
+
+        metadata.id          = snapshot.read<Id_t>();
+        metadata.property_id = snapshot.read<Id_t>();
+        metadata.property_c  = snapshot.read<uint16_t>();
+        metadata.label_id    = END_INDEX;
+
+        const auto label_c = snapshot.read<uint16_t>();
+        for (uint16_t j = 0; j < label_c; j++)
+        {
+            const auto label_id = snapshot.read<uint16_t>();
+            metadata.label_mask.set(label_id);
+            m_label_vertex[label_id].emplace_back(i);
+        }
+
+        m_index[metadata.id] = i;
+        m_vertices_c++;
+    }
+
+    //~ Offsets are handed out from the back of the free list.
+    std::ranges::reverse(m_free_vertices);
+    reserve_vertices(m_vertices.size());
+
+    //~ Property sets.
+    m_property_sets.resize(snapshot.read<Id_t>());
+    for (auto & property_set : m_property_sets)
+    {
+        property_set.resize(snapshot.read<uint16_t>());
+
+        for (auto & [key_id, value] : property_set)
+        {
+            key_id = snapshot.read<uint16_t>();
+            value  = snapshot.read_string();
+        }
+    }
+
+    m_free_property_sets.resize(snapshot.read<Id_t>());
+    for (auto & property_id : m_free_property_sets)
+        property_id = snapshot.read<Id_t>();
+
+    //~ Edges, stored to the derived adjacency within a single batch.
+    const auto edge_c          = snapshot.read<Id_t>();
+    std::vector<SEdge_t> edges = {};
+    edges.reserve(edge_c);
+
+    for (Id_t i = 0; i < edge_c; i++)
+    {
+        const auto [src, dst, property_id, edge_label_id, property_c] = snapshot.read<SPlainEdge_t>();
+        SEdge_t & edge                                                = edges.emplace_back();
+        edge.src                                                      = src;
+        edge.dst                                                      = dst;
+        edge.property_id                                              = property_id;
+        edge.edge_label_id                                            = edge_label_id;
+        edge.property_c                                               = property_c;
+
+        m_vertices[src].metadata.outdegree++;
+        m_vertices[dst].metadata.indegree++;
+    }
+
+    m_edges_c = edge_c;
+
+    //~ Index declarations.
+    m_temporal_indexes.resize(snapshot.read<uint8_t>());
+    for (auto & index : m_temporal_indexes)
+    {
+        index.vertex_label  = snapshot.read_string();
+        index.edge_label    = snapshot.read_string();
+        index.property_key  = snapshot.read_string();
+        index.incoming      = snapshot.read<bool>();
+        index.edge_property = snapshot.read<bool>();
+    }
+
+    m_property_columns.resize(snapshot.read<uint8_t>());
+    for (auto & column : m_property_columns)
+    {
+        column.vertex_label = snapshot.read_string();
+        column.property_key = snapshot.read_string();
+        column.type         = snapshot.read<EColumnType_t>();
+    }
+
+    m_property_indexes.resize(snapshot.read<uint8_t>());
+    for (auto & index : m_property_indexes)
+    {
+        index.vertex_label = snapshot.read_string();
+        index.property_key = snapshot.read_string();
+        index.index_type   = snapshot.read<EIndexType_t>();
+        index.value_type   = snapshot.read<EColumnType_t>();
+    }
+
+    snapshot.close();
+
+    //~ Rebuild the index contents from the restored graph.
+    if (!m_temporal_indexes.empty())
+    {
+        for (const auto & edge : edges)
+            store_temporal_entries(edge);
+    }
+
+    for (Id_t i = 0; i < m_vertices.size(); i++)
+    {
+        if (m_vertices[i].valid)
+            store_vertex_index_entries(i);
+    }
+
+    store_edges(edges);
+    return true;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::store_edges(const std::vector<SEdge_t> & edges) noexcept
+{
+    for (const auto & edge : edges)
+        store_edge(edge);
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::reserve_vertices([[maybe_unused]] const Id_t vertex_c) noexcept
+{
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::flush_edges() noexcept
+{
+}
+
+bool
+graphquery::database::storage::CMemoryModelHeapLPG::check_if_vertex_valid(const Id_t vertex_offset) const noexcept
+{
+    return vertex_offset < m_vertices.size() && m_vertices[vertex_offset].valid;
+}
+
+graphquery::database::storage::Id_t
+graphquery::database::storage::CMemoryModelHeapLPG::store_property_set(const std::vector<SProperty_t> & props) noexcept
+{
+    if (props.empty())
+        return END_INDEX;
+
+    std::vector<SPropertyEntry_t> property_set = {};
+    property_set.reserve(props.size());
+
+    for (const auto & [key, value] : props)
+    {
+        const auto key_exists = check_if_property_key_exists(key);
+        property_set.emplace_back(key_exists.has_value() ? *key_exists : create_property_key(key), value);
+    }
+
+    if (!m_free_property_sets.empty())
+    {
+        const Id_t property_id = m_free_property_sets.back();
+        m_free_property_sets.pop_back();
+        m_property_sets[property_id] = std::move(property_set);
+        return property_id;
+    }
+
+    m_property_sets.emplace_back(std::move(property_set));
+    return m_property_sets.size() - 1;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::rm_property_set(const Id_t property_id) noexcept
+{
+    if (property_id == END_INDEX || property_id >= m_property_sets.size())
+        return;
+
+    m_property_sets[property_id].clear();
+    m_property_sets[property_id].shrink_to_fit();
+    m_free_property_sets.emplace_back(property_id);
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SProperty_t>
+graphquery::database::storage::CMemoryModelHeapLPG::read_property_set(const Id_t property_id) const noexcept
+{
+    if (property_id == END_INDEX || property_id >= m_property_sets.size())
+        return {};
+
+    std::vector<SProperty_t> ret = {};
+    ret.reserve(m_property_sets[property_id].size());
+
+    for (const auto & [key_id, value] : m_property_sets[property_id])
+        ret.emplace_back(m_property_keys[key_id], value);
+
+    return ret;
+}
+
+std::unordered_map<std::string, std::string>
+graphquery::database::storage::CMemoryModelHeapLPG::read_property_set_map(const Id_t property_id) const noexcept
+{
+    if (property_id == END_INDEX || property_id >= m_property_sets.size())
+        return {};
+
+    std::unordered_map<std::string, std::string> ret = {};
+    ret.reserve(m_property_sets[property_id].size());
+
+    for (const auto & [key_id, value] : m_property_sets[property_id])
+        ret[m_property_keys[key_id]] = value;
+
+    return ret;
+}
+
+std::optional<std::string_view>
+graphquery::database::storage::CMemoryModelHeapLPG::get_property_value(const Id_t property_id, const std::string_view key) const noexcept
+{
+    const auto key_id = check_if_property_key_exists(key);
+
+    if (!key_id.has_value() || property_id == END_INDEX || property_id >= m_property_sets.size())
+        return std::nullopt;
+
+    for (const auto & entry : m_property_sets[property_id])
+    {
+        if (entry.key_id == *key_id)
+            return entry.value;
+    }
+
+    return std::nullopt;
+}
+
+uint16_t
+graphquery::database::storage::CMemoryModelHeapLPG::create_vertex_label(const std::string_view label) noexcept
+{
+    const auto label_id = static_cast<uint16_t>(m_vertex_labels.size());
+    SLabel_t & entry    = m_vertex_labels.emplace_back();
+
+    strncpy(&entry.label_s[0], label.data(), std::min(label.size(), static_cast<size_t>(CFG_LPG_LABEL_LENGTH - 1)));
+    entry.label_id = label_id;
+    m_label_vertex.emplace_back();
+    m_v_label_map[std::string(label)] = label_id;
+
+    return label_id;
+}
+
+uint16_t
+graphquery::database::storage::CMemoryModelHeapLPG::create_edge_label(const std::string_view label) noexcept
+{
+    assert(!label.empty());
+
+    const auto label_id = static_cast<uint16_t>(m_edge_labels.size());
+    SLabel_t & entry    = m_edge_labels.emplace_back();
+
+    strncpy(&entry.label_s[0], label.data(), std::min(label.size(), static_cast<size_t>(CFG_LPG_LABEL_LENGTH - 1)));
+    entry.label_id                    = label_id;
+    m_e_label_map[std::string(label)] = label_id;
+
+    return label_id;
+}
+
+uint16_t
+graphquery::database::storage::CMemoryModelHeapLPG::create_property_key(const std::string_view key) noexcept
+{
+    const auto key_id = static_cast<uint16_t>(m_property_keys.size());
+
+    m_property_keys.emplace_back(key);
+    m_p_key_map[std::string(key)] = key_id;
+
+    return key_id;
+}
+
+std::optional<uint16_t>
+graphquery::database::storage::CMemoryModelHeapLPG::check_if_vertex_label_exists(const std::string_view label) const noexcept
+{
+    const auto label_it = m_v_label_map.find(std::string(label));
+
+    if (label_it == m_v_label_map.end())
+        return std::nullopt;
+
+    return label_it->second;
+}
+
+std::optional<uint16_t>
+graphquery::database::storage::CMemoryModelHeapLPG::check_if_edge_label_exists(const std::string_view label) const noexcept
+{
+    const auto label_it = m_e_label_map.find(std::string(label));
+
+    if (label_it == m_e_label_map.end())
+        return std::nullopt;
+
+    return label_it->second;
+}
+
+std::optional<uint16_t>
+graphquery::database::storage::CMemoryModelHeapLPG::check_if_property_key_exists(const std::string_view key) const noexcept
+{
+    const auto key_it = m_p_key_map.find(std::string(key));
+
+    if (key_it == m_p_key_map.end())
+        return std::nullopt;
+
+    return key_it->second;
+}
+
+bool
+graphquery::database::storage::CMemoryModelHeapLPG::contains_vertex_label_id(const Id_t vertex_offset, const uint16_t label_id) const noexcept
+{
+    return check_if_vertex_valid(vertex_offset) && label_id < VERTEX_LABELS_MAX_AMT && m_vertices[vertex_offset].metadata.label_mask[label_id];
+}
+
+std::optional<graphquery::database::storage::Id_t>
+graphquery::database::storage::CMemoryModelHeapLPG::lookup_vertex(const Id_t id) const noexcept
+{
+    const auto vertex_it = m_index.find(id);
+
+    if (vertex_it == m_index.end())
+        return std::nullopt;
+
+    return vertex_it->second;
+}
+
+graphquery::database::storage::CMemoryModelHeapLPG::EActionState_t
+graphquery::database::storage::CMemoryModelHeapLPG::add_vertex_entry(const Id_t id, const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & props) noexcept
+{
+    if (m_index.contains(id))
+        return EActionState_t::invalid;
+
+    std::bitset<CFG_LPG_VERTEX_LABELS_MAX_AMT> label_mask = {};
+    for (const auto & label : labels)
+    {
+        const auto label_exists = check_if_vertex_label_exists(label);
+
+        if (!label_exists.has_value() && m_vertex_labels.size() >= VERTEX_LABELS_MAX_AMT)
+            return EActionState_t::invalid;
+
+        label_mask.set(label_exists.has_value() ? *label_exists : create_vertex_label(label));
+    }
+
+    Id_t vertex_offset = {};
+    if (!m_free_vertices.empty())
+    {
+        vertex_offset = m_free_vertices.back();
+        m_free_vertices.pop_back();
+    }
+    else
+    {
+        vertex_offset = m_vertices.size();
+        m_vertices.emplace_back();
+        reserve_vertices(m_vertices.size());
+    }
+
+    auto & [metadata, valid] = m_vertices[vertex_offset];
+    metadata                 = {};
+    metadata.id              = id;
+    metadata.label_id        = END_INDEX;
+    metadata.label_mask      = label_mask;
+    metadata.property_c      = props.size();
+    metadata.property_id     = store_property_set(props);
+    valid                    = true;
+
+    for (uint16_t label_id = 0; label_id < m_vertex_labels.size(); label_id++)
+    {
+        if (!label_mask[label_id])
+            continue;
+
+        m_label_vertex[label_id].emplace_back(vertex_offset);
+        m_vertex_labels[label_id].item_c++;
+    }
+
+    m_index[id] = vertex_offset;
+    m_vertices_c++;
+
+    //~ Offsets are reused, therefore every column is written to drop the values of a former vertex.
+    store_vertex_index_entries(vertex_offset);
+    return EActionState_t::valid;
+}
+
+graphquery::database::storage::CMemoryModelHeapLPG::EActionState_t
+graphquery::database::storage::CMemoryModelHeapLPG::add_edge_entry(const Id_t src,
+                                                                   const Id_t dst,
+                                                                   const std::string_view edge_label,
+                                                                   const std::vector<SProperty_t> & props,
+                                                                   const bool undirected,
+                                                                   const bool deduplicated) noexcept
+{
+    const auto src_idx = lookup_vertex(src);
+    const auto dst_idx = lookup_vertex(dst);
+
+    if (!(src_idx.has_value() && dst_idx.has_value()))
+        return EActionState_t::invalid;
+
+    const std::optional<uint16_t> edge_label_exists = check_if_edge_label_exists(edge_label);
+    const auto edge_label_id                        = edge_label_exists.has_value() ? *edge_label_exists : create_edge_label(edge_label);
+
+    if (!deduplicated && check_if_edge_exists(*src_idx, *dst_idx, edge_label_id))
+        return EActionState_t::invalid;
+
+    store_edge_entry(*src_idx, *dst_idx, edge_label_id, props);
+
+    //~ The adjacency holds unique entries, therefore a present reverse edge is kept.
+    if (undirected && (deduplicated || !check_if_edge_exists(*dst_idx, *src_idx, edge_label_id)))
+        store_edge_entry(*dst_idx, *src_idx, edge_label_id, props);
+
+    return EActionState_t::valid;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::store_edge_entry(const Id_t src_idx, const Id_t dst_idx, const uint16_t edge_label_id, const std::vector<SProperty_t> & props) noexcept
+{
+    SEdge_t edge       = {};
+    edge.src           = src_idx;
+    edge.dst           = dst_idx;
+    edge.edge_label_id = edge_label_id;
+    edge.property_c    = props.size();
+    edge.property_id   = store_property_set(props);
+
+    store_edge(edge);
+
+    m_vertices[src_idx].metadata.outdegree++;
+    m_vertices[dst_idx].metadata.indegree++;
+    m_edge_labels[edge_label_id].item_c++;
+    m_edges_c++;
+
+    if (!m_temporal_indexes.empty())
+        store_temporal_entries(edge);
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::release_edges(const std::vector<SEdge_t> & edges) noexcept
+{
+    for (const auto & edge : edges)
+    {
+        m_vertices[edge.src].metadata.outdegree--;
+        m_vertices[edge.dst].metadata.indegree--;
+        m_edge_labels[edge.edge_label_id].item_c--;
+        m_edges_c--;
+
+        if (!m_temporal_indexes.empty())
+            rm_temporal_entries(edge);
+
+        rm_property_set(edge.property_id);
+    }
+}
+
+graphquery::database::storage::CMemoryModelHeapLPG::EActionState_t
+graphquery::database::storage::CMemoryModelHeapLPG::rm_vertex_entry(const Id_t src) noexcept
+{
+    const auto vertex_idx = lookup_vertex(src);
+
+    if (!vertex_idx.has_value())
+        return EActionState_t::invalid;
+
+    //~ Incident edges are removed along with the vertex, such that its offset can be reused at once.
+    std::vector<SEdge_t> removed = {};
+    rm_vertex_edges(*vertex_idx, removed);
+    release_edges(removed);
+
+    rm_vertex_index_entries(*vertex_idx);
+
+    auto & [metadata, valid] = m_vertices[*vertex_idx];
+    rm_property_set(metadata.property_id);
+
+    for (uint16_t label_id = 0; label_id < m_vertex_labels.size(); label_id++)
+    {
+        if (!metadata.label_mask[label_id])
+            continue;
+
+        std::erase(m_label_vertex[label_id], *vertex_idx);
+        m_vertex_labels[label_id].item_c--;
+    }
+
+    metadata = {};
+    valid    = false;
+    m_index.erase(src);
+    m_free_vertices.emplace_back(*vertex_idx);
+    m_vertices_c--;
+
+    return EActionState_t::valid;
+}
+
+graphquery::database::storage::CMemoryModelHeapLPG::EActionState_t
+graphquery::database::storage::CMemoryModelHeapLPG::rm_edge_entry(const Id_t src, const Id_t dst, const std::optional<std::string_view> edge_label) noexcept
+{
+    const auto src_idx = lookup_vertex(src);
+    const auto dst_idx = lookup_vertex(dst);
+
+    if (!(src_idx.has_value() && dst_idx.has_value()))
+        return EActionState_t::invalid;
+
+    std::optional<uint16_t> edge_label_id = std::nullopt;
+    if (edge_label.has_value())
+    {
+        edge_label_id = check_if_edge_label_exists(*edge_label);
+
+        if (!edge_label_id.has_value())
+            return EActionState_t::invalid;
+    }
+
+    std::vector<SEdge_t> removed = {};
+    rm_edges(*src_idx, *dst_idx, edge_label_id, removed);
+    release_edges(removed);
+
+    return EActionState_t::valid;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::add_vertex(const Id_t src, const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & prop)
+{
+    std::unique_lock lock(m_graph_lock);
+
+    if (add_vertex_entry(src, labels, prop) != EActionState_t::valid)
+    {
+        m_log_system->warning(fmt::format("Issue adding vertex"));
+        return;
+    }
+
+    m_flush_needed = true;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::add_vertex(const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & prop)
+{
+    std::unique_lock lock(m_graph_lock);
+
+    if (add_vertex_entry(m_vertices_c, labels, prop) != EActionState_t::valid)
+    {
+        m_log_system->warning("Issue adding vertex");
+        return;
+    }
+
+    m_flush_needed = true;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::add_edge(const Id_t src, const Id_t dst, const std::string_view edge_label, const std::vector<SProperty_t> & prop, const bool undirected)
+{
+    std::unique_lock lock(m_graph_lock);
+
+    if (add_edge_entry(src, dst, edge_label, prop, undirected) != EActionState_t::valid)
+    {
+        m_log_system->warning(fmt::format("Issue adding edge({}) to vertex({})", dst, src));
+        return;
+    }
+
+    m_flush_needed = true;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::rm_vertex(const Id_t src)
+{
+    std::unique_lock lock(m_graph_lock);
+
+    if (rm_vertex_entry(src) != EActionState_t::valid)
+    {
+        m_log_system->warning(fmt::format("Issue removing vertex({})", src));
+        return;
+    }
+
+    m_flush_needed = true;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::rm_edge(const Id_t src, const Id_t dst)
+{
+    std::unique_lock lock(m_graph_lock);
+
+    if (rm_edge_entry(src, dst, std::nullopt) != EActionState_t::valid)
+    {
+        m_log_system->warning(fmt::format("Issue removing edge({}) to vertex({})", dst, src));
+        return;
+    }
+
+    m_flush_needed = true;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::rm_edge(const Id_t src, const Id_t dst, const std::string_view edge_label)
+{
+    std::unique_lock lock(m_graph_lock);
+
+    if (rm_edge_entry(src, dst, edge_label) != EActionState_t::valid)
+    {
+        m_log_system->warning(fmt::format("Issue removing edge({}) to vertex({})", dst, src));
+        return;
+    }
+
+    m_flush_needed = true;
+}
+
+graphquery::database::storage::ILPGModel::SMutation_t
+graphquery::database::storage::CMemoryModelHeapLPG::make_edge_mutation(const SEdge_t & edge) const noexcept
+{
+    return SMutation_t {.type       = EMutationType_t::add_edge,
+                        .src        = m_vertices[edge.src].metadata.id,
+                        .dst        = m_vertices[edge.dst].metadata.id,
+                        .edge_label = m_edge_labels[edge.edge_label_id].label_s,
+                        .props      = read_property_set(edge.property_id)};
+}
+
+graphquery::database::storage::CMemoryModelHeapLPG::EActionState_t
+graphquery::database::storage::CMemoryModelHeapLPG::apply_mutation(const SMutation_t & mutation, std::vector<SMutation_t> & undo) noexcept
+{
+    //~ The statements reverting the mutation are pushed in the reverse order of their application, as the undo is rewound newest first.
+    const size_t undo_c  = undo.size();
+    EActionState_t state = EActionState_t::valid;
+
+    switch (mutation.type)
+    {
+    case EMutationType_t::add_vertex:
+    {
+        const Id_t id = mutation.src == std::numeric_limits<Id_t>::max() ? m_vertices_c : mutation.src;
+        const std::vector<std::string_view> labels(mutation.labels.begin(), mutation.labels.end());
+        state = add_vertex_entry(id, labels, mutation.props);
+        undo.emplace_back(SMutation_t {.type = EMutationType_t::rm_vertex, .src = id});
+        break;
+    }
+    case EMutationType_t::add_edge:
+    {
+        //~ A present reverse edge is kept by an undirected insert, therefore solely a reverse edge stored by it is removed.
+        const auto src_idx        = lookup_vertex(mutation.src);
+        const auto dst_idx        = lookup_vertex(mutation.dst);
+        const auto edge_label_id  = check_if_edge_label_exists(mutation.edge_label);
+        const bool reverse_exists = src_idx.has_value() && dst_idx.has_value() && edge_label_id.has_value() && check_if_edge_exists(*dst_idx, *src_idx, *edge_label_id);
+
+        state = add_edge_entry(mutation.src, mutation.dst, mutation.edge_label, mutation.props, mutation.undirected);
+        undo.emplace_back(
+            SMutation_t {.type = EMutationType_t::rm_edge, .src = mutation.src, .dst = mutation.dst, .undirected = mutation.undirected && !reverse_exists, .edge_label = mutation.edge_label});
+        break;
+    }
+    case EMutationType_t::rm_vertex:
+    {
+        //~ Incident edges are restored once the vertex is, self loops being held by the outgoing edges.
+        if (const auto vertex_idx = lookup_vertex(mutation.src); vertex_idx.has_value())
+        {
+            scan_out_edges(*vertex_idx, std::nullopt, [this, &undo](const SEdge_t & edge) -> void { undo.emplace_back(make_edge_mutation(edge)); });
+            scan_in_edges(*vertex_idx,
+                          std::nullopt,
+                          [this, &undo](const SEdge_t & edge) -> void
+                          {
+                              if (edge.src != edge.dst)
+                                  undo.emplace_back(make_edge_mutation(edge));
+                          });
+
+            const SVertex_t & metadata = m_vertices[*vertex_idx].metadata;
+            SMutation_t & restore      = undo.emplace_back(SMutation_t {.type = EMutationType_t::add_vertex, .src = mutation.src, .props = read_property_set(metadata.property_id)});
+
+            for (uint16_t label_id = 0; label_id < m_vertex_labels.size(); label_id++)
+            {
+                if (metadata.label_mask[label_id])
+                    restore.labels.emplace_back(m_vertex_labels[label_id].label_s);
+            }
+        }
+
+        state = rm_vertex_entry(mutation.src);
+        break;
+    }
+    case EMutationType_t::rm_edge:
+    {
+        const std::optional<std::string_view> edge_label = mutation.edge_label.empty() ? std::nullopt : std::optional<std::string_view>(mutation.edge_label);
+        const std::optional<uint16_t> edge_label_id      = edge_label.has_value() ? check_if_edge_label_exists(*edge_label) : std::nullopt;
+        const auto src_idx                               = lookup_vertex(mutation.src);
+        const auto dst_idx                               = lookup_vertex(mutation.dst);
+
+        if (src_idx.has_value() && dst_idx.has_value() && (!edge_label.has_value() || edge_label_id.has_value()))
+        {
+            scan_out_edges(*src_idx,
+                           edge_label_id,
+                           [this, &undo, &dst_idx](const SEdge_t & edge) -> void
+                           {
+                               if (edge.dst == *dst_idx)
+                                   undo.emplace_back(make_edge_mutation(edge));
+                           });
+        }
+
+        state = rm_edge_entry(mutation.src, mutation.dst, edge_label);
+        break;
+    }
+    }
+
+    if (state != EActionState_t::valid)
+        undo.resize(undo_c);
+
+    return state;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::undo_mutations(std::vector<SMutation_t> & undo) noexcept
+{
+    for (auto it = undo.rbegin(); it != undo.rend(); ++it)
+    {
+        const SMutation_t & mutation = *it;
+
+        switch (mutation.type)
+        {
+        case EMutationType_t::add_vertex:
+        {
+            const std::vector<std::string_view> labels(mutation.labels.begin(), mutation.labels.end());
+            (void) add_vertex_entry(mutation.src, labels, mutation.props);
+            break;
+        }
+        case EMutationType_t::add_edge: (void) add_edge_entry(mutation.src, mutation.dst, mutation.edge_label, mutation.props, false); break;
+        case EMutationType_t::rm_vertex: (void) rm_vertex_entry(mutation.src); break;
+        case EMutationType_t::rm_edge:
+            (void) rm_edge_entry(mutation.src, mutation.dst, mutation.edge_label);
+
+            if (mutation.undirected)
+                (void) rm_edge_entry(mutation.dst, mutation.src, mutation.edge_label);
+            break;
+        }
+    }
+
+    undo.clear();
+}
+
+bool
+graphquery::database::storage::CMemoryModelHeapLPG::commit_transaction(STransaction_t & transaction)
+{
+    //~ Applied whilst holding the graph lock throughout, such that readers observe either none or all of the transaction.
+    std::unique_lock lock(m_graph_lock);
+    std::vector<SMutation_t> undo = {};
+
+    for (const SMutation_t & mutation : transaction.mutations)
+    {
+        if (apply_mutation(mutation, undo) == EActionState_t::valid)
+            continue;
+
+        m_log_system->warning(fmt::format("Issue applying mutation of vertex({}) within transaction, reverting it", mutation.src));
+        undo_mutations(undo);
+        transaction.mutations.clear();
+        return false;
+    }
+
+    if (!transaction.mutations.empty())
+        m_flush_needed = true;
+
+    transaction.mutations.clear();
+    return true;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::bulk_load(STransaction_t & batch, const bool deduplicated)
+{
+    std::unique_lock lock(m_graph_lock);
+    uint64_t failed_c = 0;
+
+    //~ Vertices precede the edges of the batch, which are applied in order of their source when deduplicated.
+    std::vector<uint32_t> edges = {};
+
+    for (uint32_t i = 0; i < batch.mutations.size(); i++)
+    {
+        const SMutation_t & mutation = batch.mutations[i];
+
+        if (mutation.type == EMutationType_t::add_edge)
+            edges.emplace_back(i);
+        else if (mutation.type == EMutationType_t::add_vertex)
+        {
+            const std::vector<std::string_view> labels(mutation.labels.begin(), mutation.labels.end());
+            failed_c += add_vertex_entry(mutation.src == std::numeric_limits<Id_t>::max() ? m_vertices_c : mutation.src, labels, mutation.props) != EActionState_t::valid;
+        }
+        else
+            failed_c++;
+    }
+
+    //~ Unless deduplicated, the order of the rows decides which duplicate is kept, therefore it is retained.
+    if (deduplicated)
+        std::ranges::stable_sort(edges, {}, [&batch](const uint32_t i) -> Id_t { return batch.mutations[i].src; });
+
+    for (const uint32_t i : edges)
+    {
+        const SMutation_t & mutation = batch.mutations[i];
+        failed_c += add_edge_entry(mutation.src, mutation.dst, mutation.edge_label, mutation.props, mutation.undirected, deduplicated) != EActionState_t::valid;
+    }
+
+    if (failed_c > 0)
+        m_log_system->warning(fmt::format("Bulk load skipped ({}) of ({}) rows", failed_c, batch.mutations.size()));
+
+    if (!batch.mutations.empty())
+        m_flush_needed = true;
+
+    batch.mutations.clear();
+}
+
+bool
+graphquery::database::storage::CMemoryModelHeapLPG::finish_bulk_load()
+{
+    std::unique_lock lock(m_graph_lock);
+    flush_edges();
+
+    //~ Without durability the graph is never recovered, therefore there is nothing further to make durable.
+    if (!m_durable || !m_flush_needed)
+        return true;
+
+    m_flush_needed = !store_snapshot(SNAPSHOT_FILE_NAME);
+    return !m_flush_needed;
+}
+
+std::optional<graphquery::database::storage::ILPGModel::SVertex_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_vertex(const Id_t id)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto vertex_idx = lookup_vertex(id);
+
+    if (!vertex_idx.has_value())
+        return std::nullopt;
+
+    return m_vertices[*vertex_idx].metadata;
+}
+
+std::optional<graphquery::database::storage::Id_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_vertex_idx(const Id_t id) noexcept
+{
+    std::shared_lock lock(m_graph_lock);
+    return lookup_vertex(id);
+}
+
+std::optional<graphquery::database::storage::Id_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_vertex_id(const Id_t idx) noexcept
+{
+    std::shared_lock lock(m_graph_lock);
+
+    if (!check_if_vertex_valid(idx))
+        return std::nullopt;
+
+    return m_vertices[idx].metadata.id;
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SVertex_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_vertices(const std::function<bool(const SVertex_t &)> & pred)
+{
+    std::shared_lock lock(m_graph_lock);
+
+    std::vector<SVertex_t> ret = {};
+    ret.reserve(m_vertices_c);
+
+    for (const auto & [metadata, valid] : m_vertices)
+    {
+        if (valid && pred(metadata))
+            ret.emplace_back(metadata);
+    }
+
+    return ret;
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SVertex_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_vertices_by_label(const std::string_view label)
+{
+    std::shared_lock lock(m_graph_lock);
+    const std::optional<uint16_t> exists = check_if_vertex_label_exists(label);
+
+    if (!exists.has_value())
+        return {};
+
+    std::vector<SVertex_t> ret = {};
+    ret.reserve(m_label_vertex[*exists].size());
+
+    for (const Id_t vertex_offset : m_label_vertex[*exists])
+        ret.emplace_back(m_vertices[vertex_offset].metadata);
+
+    return ret;
+}
+
+std::vector<graphquery::database::storage::Id_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_vertices_offset_by_label(const std::string_view label) const noexcept
+{
+    const std::optional<uint16_t> exists = check_if_vertex_label_exists(label);
+
+    if (!exists.has_value())
+        return {};
+
+    return m_label_vertex[*exists];
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_out_edges(const Id_t src_idx, const std::optional<uint16_t> edge_label_id, const std::function<bool(const SEdge_t &)> & pred) noexcept
+{
+    std::vector<SEdge_t> ret = {};
+
+    if (!check_if_vertex_valid(src_idx))
+        return ret;
+
+    scan_out_edges(src_idx,
+                   edge_label_id,
+                   [&ret, &pred](const SEdge_t & edge) -> void
+                   {
+                       if (pred(edge))
+                           ret.emplace_back(edge);
+                   });
+    return ret;
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_in_edges(const Id_t dst_idx, const std::optional<uint16_t> edge_label_id, const std::function<bool(const SEdge_t &)> & pred) noexcept
+{
+    std::vector<SEdge_t> ret = {};
+
+    if (!check_if_vertex_valid(dst_idx))
+        return ret;
+
+    scan_in_edges(dst_idx,
+                  edge_label_id,
+                  [&ret, &pred](const SEdge_t & edge) -> void
+                  {
+                      if (pred(edge))
+                          ret.emplace_back(edge);
+                  });
+    return ret;
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_label_edges(const std::string_view vertex_label,
+                                                                    const std::optional<uint16_t> edge_label_id,
+                                                                    const std::function<bool(const SEdge_t &)> & pred) noexcept
+{
+    const std::vector<Id_t> label_vertices = get_vertices_offset_by_label(vertex_label);
+    const size_t label_vertices_size       = label_vertices.size();
+
+    std::vector<SEdge_t> ret;
+    ret.reserve(label_vertices_size);
+
+#pragma omp declare reduction(insert : std::vector<SEdge_t> : omp_out.insert(omp_out.end(), omp_in.begin(), omp_in.end())) initializer(omp_priv = std::vector<SEdge_t>())
+#pragma omp parallel for default(none) shared(label_vertices, label_vertices_size, edge_label_id, pred) schedule(dynamic, 64) reduction(insert : ret)
+    for (size_t i = 0; i < label_vertices_size; i++)
+    {
+        const auto edges = get_out_edges(label_vertices[i], edge_label_id, pred);
+        ret.insert(ret.end(), edges.begin(), edges.end());
+    }
+
+    return ret;
+}
+
+std::optional<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edge(const Id_t src_vertex_id, const std::string_view edge_label, const int64_t dst_vertex_id)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto edge_label_id = check_if_edge_label_exists(edge_label);
+
+    if (!edge_label_id.has_value())
+        return std::nullopt;
+
+    const auto edges = get_out_edges(src_vertex_id, edge_label_id, [dst_vertex_id](const SEdge_t & edge) -> bool { return static_cast<Id_t>(dst_vertex_id) == edge.dst; });
+
+    if (edges.empty())
+        return std::nullopt;
+
+    return edges[0];
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edges(const std::function<bool(const SEdge_t &)> & pred)
+{
+    std::shared_lock lock(m_graph_lock);
+
+    const auto vertex_c      = static_cast<int64_t>(m_vertices.size());
+    std::vector<SEdge_t> ret = {};
+    ret.reserve(m_edges_c);
+
+#pragma omp declare reduction(merge : std::vector<SEdge_t> : omp_out.insert(omp_out.end(), omp_in.begin(), omp_in.end())) initializer(omp_priv = std::vector<SEdge_t>())
+#pragma omp parallel for default(none) shared(vertex_c, pred) schedule(dynamic, 1024) reduction(merge : ret)
+    for (int64_t i = 0; i < vertex_c; i++)
+    {
+        const auto edges = get_out_edges(i, std::nullopt, pred);
+        ret.insert(ret.end(), edges.begin(), edges.end());
+    }
+
+    return ret;
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edges(const Id_t src, const Id_t dst)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto src_idx = lookup_vertex(src);
+    const auto dst_idx = lookup_vertex(dst);
+
+    if (!(src_idx.has_value() && dst_idx.has_value()))
+        return {};
+
+    return get_out_edges(*src_idx, std::nullopt, [&dst_idx](const SEdge_t & edge) -> bool { return edge.dst == *dst_idx; });
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edges_by_label(const std::string_view label)
+{
+    std::optional<uint16_t> label_id = {};
+    {
+        std::shared_lock lock(m_graph_lock);
+        label_id = check_if_edge_label_exists(label);
+    }
+
+    if (!label_id.has_value())
+        return {};
+
+    return get_edges([&label_id](const SEdge_t & edge) -> bool { return edge.edge_label_id == *label_id; });
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edges(const std::string_view vertex_label, const std::string_view edge_label, const Id_t dst)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto dst_idx             = lookup_vertex(dst);
+    const auto edge_label_exists   = check_if_edge_label_exists(edge_label);
+    const auto vertex_label_exists = check_if_vertex_label_exists(vertex_label);
+
+    if (!(dst_idx.has_value() && edge_label_exists.has_value() && vertex_label_exists.has_value()))
+        return {};
+
+    //~ Walk the incoming adjacency of the destination, rather than every vertex of the source label.
+    const auto vertex_label_id = *vertex_label_exists;
+    return get_in_edges(*dst_idx, edge_label_exists, [this, vertex_label_id](const SEdge_t & edge) -> bool { return contains_vertex_label_id(edge.src, vertex_label_id); });
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edges_by_offset(const Id_t vertex_id, const std::string_view edge_label, const std::string_view vertex_label)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto edge_label_exists   = check_if_edge_label_exists(edge_label);
+    const auto vertex_label_exists = check_if_vertex_label_exists(vertex_label);
+
+    if (!(edge_label_exists.has_value() && vertex_label_exists.has_value()))
+        return {};
+
+    const auto vertex_label_id = *vertex_label_exists;
+    return get_out_edges(vertex_id, edge_label_exists, [this, vertex_label_id](const SEdge_t & edge) -> bool { return contains_vertex_label_id(edge.dst, vertex_label_id); });
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edges(const std::string_view vertex_label, const std::function<bool(const SEdge_t &)> & pred)
+{
+    std::shared_lock lock(m_graph_lock);
+    return get_label_edges(vertex_label, std::nullopt, pred);
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edges(const std::string_view vertex_label, const std::string_view edge_label, const std::function<bool(const SEdge_t &)> & pred)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto edge_label_id = check_if_edge_label_exists(edge_label);
+
+    if (!edge_label_id.has_value())
+        return {};
+
+    return get_label_edges(vertex_label, edge_label_id, pred);
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edges(const std::string_view vertex_label, const std::string_view edge_label)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto edge_label_id = check_if_edge_label_exists(edge_label);
+
+    if (!edge_label_id.has_value())
+        return {};
+
+    return get_label_edges(vertex_label, edge_label_id, [](const SEdge_t &) -> bool { return true; });
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edges(const std::string_view vertex_label, const std::string_view edge_label, const std::string_view dst_vertex_label)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto edge_label_id = check_if_edge_label_exists(edge_label);
+    const auto dst_v_exists  = check_if_vertex_label_exists(dst_vertex_label);
+
+    if (!(edge_label_id.has_value() && dst_v_exists.has_value()))
+        return {};
+
+    const auto dst_v_label_id = *dst_v_exists;
+    return get_label_edges(vertex_label, edge_label_id, [this, dst_v_label_id](const SEdge_t & edge) -> bool { return contains_vertex_label_id(edge.dst, dst_v_label_id); });
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edges(const Id_t src, const std::string_view edge_label, const std::string_view vertex_label)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto src_idx             = lookup_vertex(src);
+    const auto vertex_label_exists = check_if_vertex_label_exists(vertex_label);
+    const auto edge_label_exists   = check_if_edge_label_exists(edge_label);
+
+    if (!(src_idx.has_value() && vertex_label_exists.has_value() && edge_label_exists.has_value()))
+        return {};
+
+    const auto vertex_label_id = *vertex_label_exists;
+    return get_out_edges(*src_idx, edge_label_exists, [this, vertex_label_id](const SEdge_t & edge) -> bool { return contains_vertex_label_id(edge.dst, vertex_label_id); });
+}
+
+std::unordered_set<graphquery::database::storage::Id_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edge_dst_vertices(const Id_t src, const std::function<bool(const SEdge_t &)> & pred)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto src_idx = lookup_vertex(src);
+
+    if (!src_idx.has_value())
+        return {};
+
+    std::unordered_set<Id_t> ret = {};
+    ret.reserve(m_vertices[*src_idx].metadata.outdegree);
+
+    scan_out_edges(*src_idx,
+                   std::nullopt,
+                   [&ret, &pred](const SEdge_t & edge) -> void
+                   {
+                       if (pred(edge))
+                           ret.insert(edge.dst);
+                   });
+    return ret;
+}
+
+std::unordered_set<graphquery::database::storage::Id_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_edge_dst_vertices(const Id_t src, const std::string_view edge_label, const std::string_view vertex_label)
+{
+    std::unordered_set<Id_t> ret = {};
+
+    for (const auto & edge : get_edges(src, edge_label, vertex_label))
+        ret.insert(edge.dst);
+
+    return ret;
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_recursive_edges(const Id_t src, const std::vector<SProperty_t> edge_vertex_label_pairs)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto src_idx       = lookup_vertex(src);
+    std::vector<SEdge_t> ret = {};
+
+    if (!src_idx.has_value())
+        return ret;
+
+    std::unordered_set<Id_t> vertices_to_process = {*src_idx};
+
+    for (const auto & [edge_label, vertex_label] : edge_vertex_label_pairs)
+    {
+        ret.clear();
+        const auto edge_label_id   = check_if_edge_label_exists(edge_label);
+        const auto vertex_label_id = check_if_vertex_label_exists(vertex_label);
+
+        if (!(edge_label_id.has_value() && vertex_label_id.has_value()))
+            return ret;
+
+        for (const auto & i : vertices_to_process)
+        {
+            const auto edges = get_out_edges(i, edge_label_id, [this, &vertex_label_id](const SEdge_t & edge) -> bool { return contains_vertex_label_id(edge.dst, *vertex_label_id); });
+            ret.insert(ret.end(), edges.begin(), edges.end());
+        }
+        vertices_to_process.clear();
+
+        for (const auto & curr_result : ret)
+            vertices_to_process.insert(curr_result.dst);
+    }
+    return ret;
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SProperty_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_properties_by_vertex(const Id_t src)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto vertex_idx = lookup_vertex(src);
+
+    if (!vertex_idx.has_value())
+        return {};
+
+    return read_property_set(m_vertices[*vertex_idx].metadata.property_id);
+}
+
+std::unordered_map<std::string, std::string>
+graphquery::database::storage::CMemoryModelHeapLPG::get_properties_by_vertex_map(const Id_t src)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto vertex_idx = lookup_vertex(src);
+
+    if (!vertex_idx.has_value())
+        return {};
+
+    return read_property_set_map(m_vertices[*vertex_idx].metadata.property_id);
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SProperty_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_properties_by_id(const int64_t id)
+{
+    std::shared_lock lock(m_graph_lock);
+
+    if (!check_if_vertex_valid(id))
+        return {};
+
+    return read_property_set(m_vertices[id].metadata.property_id);
+}
+
+std::unordered_map<std::string, std::string>
+graphquery::database::storage::CMemoryModelHeapLPG::get_properties_by_id_map(const int64_t id)
+{
+    std::shared_lock lock(m_graph_lock);
+
+    if (!check_if_vertex_valid(id))
+        return {};
+
+    return read_property_set_map(m_vertices[id].metadata.property_id);
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SProperty_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_properties_by_property_id(const Id_t id)
+{
+    std::shared_lock lock(m_graph_lock);
+    return read_property_set(id);
+}
+
+std::unordered_map<std::string, std::string>
+graphquery::database::storage::CMemoryModelHeapLPG::get_properties_by_property_id_map(const Id_t id)
+{
+    std::shared_lock lock(m_graph_lock);
+    return read_property_set_map(id);
+}
+
+uint32_t
+graphquery::database::storage::CMemoryModelHeapLPG::out_degree(const Id_t id) noexcept
+{
+    assert(id < m_vertices.size());
+    return m_vertices[id].metadata.outdegree;
+}
+
+uint32_t
+graphquery::database::storage::CMemoryModelHeapLPG::in_degree(const Id_t id) noexcept
+{
+    assert(id < m_vertices.size());
+    return m_vertices[id].metadata.indegree;
+}
+
+uint32_t
+graphquery::database::storage::CMemoryModelHeapLPG::out_degree_by_id(const Id_t id) noexcept
+{
+    return get_vertex(id)->outdegree;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::calc_outdegree(uint32_t outdeg[]) noexcept
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto vertex_c = static_cast<int64_t>(m_vertices.size());
+
+#pragma omp parallel for default(none) shared(outdeg, vertex_c) schedule(static)
+    for (int64_t i = 0; i < vertex_c; i++)
+    {
+        if (likely(m_vertices[i].valid))
+            outdeg[i] = m_vertices[i].metadata.outdegree;
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::calc_indegree(uint32_t indeg[]) noexcept
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto vertex_c = static_cast<int64_t>(m_vertices.size());
+
+#pragma omp parallel for default(none) shared(indeg, vertex_c) schedule(static)
+    for (int64_t i = 0; i < vertex_c; i++)
+    {
+        if (likely(m_vertices[i].valid))
+            indeg[i] = m_vertices[i].metadata.indegree;
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::calc_vertex_sparse_map(Id_t arr[]) noexcept
+{
+    std::shared_lock lock(m_graph_lock);
+    int64_t vertex_i = 0;
+
+    for (Id_t i = 0; i < m_vertices.size(); i++)
+    {
+        if (m_vertices[i].valid)
+            arr[vertex_i++] = i;
+    }
+}
+
+double
+graphquery::database::storage::CMemoryModelHeapLPG::get_avg_out_degree() noexcept
+{
+    return static_cast<double>(get_num_edges()) / static_cast<double>(get_num_vertices());
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::edgemap(const std::unique_ptr<analytic::IRelax> & relax) noexcept
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto vertex_c = static_cast<int64_t>(m_vertices.size());
+
+#pragma omp parallel for default(none) shared(relax, vertex_c) schedule(dynamic, 1024)
+    for (int64_t i = 0; i < vertex_c; i++)
+    {
+        if (unlikely(!m_vertices[i].valid))
+            continue;
+
+        scan_out_edges(i, std::nullopt, [&relax](const SEdge_t & edge) -> void { relax->relax(edge.src, edge.dst); });
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::src_edgemap(const Id_t vertex_offset, const std::function<void(int64_t src, int64_t dst)> & relax)
+{
+    //~ Called per vertex within the loops of an analytic, which are not run alongside writes.
+    if (!check_if_vertex_valid(vertex_offset))
+        return;
+
+    scan_out_edges(vertex_offset, std::nullopt, [&relax](const SEdge_t & edge) -> void { relax(edge.src, edge.dst); });
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::dst_edgemap(const Id_t vertex_offset, const std::function<bool(int64_t src, int64_t dst)> & relax)
+{
+    if (!check_if_vertex_valid(vertex_offset))
+        return;
+
+    bool done = false;
+    scan_in_edges(vertex_offset,
+                  std::nullopt,
+                  [&relax, &done](const SEdge_t & edge) -> void
+                  {
+                      if (!done)
+                          done = relax(edge.src, edge.dst);
+                  });
+}
+
+std::unique_ptr<std::vector<std::vector<int64_t>>>
+graphquery::database::storage::CMemoryModelHeapLPG::make_inverse_graph() noexcept
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto vertex_c = static_cast<int64_t>(m_vertices.size());
+    auto inv_graph      = std::make_unique<std::vector<std::vector<int64_t>>>(vertex_c);
+
+#pragma omp parallel for default(none) shared(inv_graph, vertex_c) schedule(dynamic, 1024)
+    for (int64_t i = 0; i < vertex_c; i++)
+    {
+        if (unlikely(!m_vertices[i].valid))
+            continue;
+
+        auto & neighbours = (*inv_graph)[i];
+        neighbours.reserve(m_vertices[i].metadata.indegree);
+        scan_in_edges(i, std::nullopt, [&neighbours](const SEdge_t & edge) -> void { neighbours.emplace_back(edge.src); });
+    }
+
+    return inv_graph;
+}
+
+bool
+graphquery::database::storage::CMemoryModelHeapLPG::create_temporal_index(const std::string_view vertex_label,
+                                                                          const std::string_view edge_label,
+                                                                          const std::string_view property_key,
+                                                                          const bool incoming,
+                                                                          const bool edge_property)
+{
+    std::unique_lock lock(m_graph_lock);
+
+    if (get_temporal_index(vertex_label, edge_label, incoming).has_value() || m_temporal_indexes.size() >= TEMPORAL_INDEX_MAX_AMT)
+    {
+        m_log_system->warning(fmt::format("Temporal index on ({})-[{}] could not be created", vertex_label, edge_label));
+        return false;
+    }
+
+    STemporalIndex_t & index = m_temporal_indexes.emplace_back();
+    index.vertex_label       = vertex_label;
+    index.edge_label         = edge_label;
+    index.property_key       = property_key;
+    index.incoming           = incoming;
+    index.edge_property      = edge_property;
+
+    //~ Populate the index with the edges already stored.
+    if (const auto edge_label_id = check_if_edge_label_exists(edge_label); edge_label_id.has_value())
+    {
+        for (const auto & edge : get_label_edges(vertex_label, edge_label_id, [](const SEdge_t &) -> bool { return true; }))
+            store_temporal_entry(index, edge);
+    }
+
+    m_flush_needed = true;
+    return true;
+}
+
+std::optional<std::vector<graphquery::database::storage::ILPGModel::STemporalEdge_t>>
+graphquery::database::storage::CMemoryModelHeapLPG::get_recent_edges(const Id_t vertex_id,
+                                                                     const std::string_view vertex_label,
+                                                                     const std::string_view edge_label,
+                                                                     const bool incoming,
+                                                                     const size_t limit,
+                                                                     const int64_t max_timestamp)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto index_id = get_temporal_index(vertex_label, edge_label, incoming);
+
+    if (!index_id.has_value())
+        return std::nullopt;
+
+    const auto vertex_idx = lookup_vertex(vertex_id);
+    const auto & entries  = m_temporal_indexes[*index_id].entries;
+
+    std::vector<STemporalEdge_t> ret = {};
+    if (!vertex_idx.has_value())
+        return ret;
+
+    const auto entries_it = entries.find(*vertex_idx);
+    if (entries_it == entries.end())
+        return ret;
+
+    //~ Entries are held newest first, therefore skip to the first at or before the bound.
+    const auto & adjacency = entries_it->second;
+    auto entry_it          = std::ranges::partition_point(adjacency, [max_timestamp](const STemporalEdge_t & entry) -> bool { return entry.timestamp > max_timestamp; });
+
+    for (; entry_it != adjacency.end() && ret.size() < limit; ++entry_it)
+        ret.emplace_back(*entry_it);
+
+    return ret;
+}
+
+std::optional<uint8_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_temporal_index(const std::string_view vertex_label, const std::string_view edge_label, const bool incoming) const noexcept
+{
+    for (uint8_t i = 0; i < m_temporal_indexes.size(); i++)
+    {
+        const auto & index = m_temporal_indexes[i];
+
+        if (index.incoming == incoming && vertex_label == index.vertex_label && edge_label == index.edge_label)
+            return i;
+    }
+
+    return std::nullopt;
+}
+
+std::optional<int64_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_temporal_timestamp(const STemporalIndex_t & index, const SEdge_t & edge) const noexcept
+{
+    const Id_t property_id = index.edge_property ? edge.property_id : m_vertices[index.incoming ? edge.src : edge.dst].metadata.property_id;
+    const auto value       = get_property_value(property_id, index.property_key);
+
+    if (!value.has_value())
+        return std::nullopt;
+
+    //~ Values not wholly parsed as a date are rejected, leaving the edge unindexed rather than indexed by a prefix.
+    return utils::parse_date(*value);
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::store_temporal_entry(STemporalIndex_t & index, const SEdge_t & edge) noexcept
+{
+    const auto timestamp = get_temporal_timestamp(index, edge);
+
+    if (!timestamp.has_value())
+        return;
+
+    //~ Keep the adjacency newest first, placing equal timestamps after those already held.
+    auto & adjacency = index.entries[index.incoming ? edge.dst : edge.src];
+    const auto pos   = std::ranges::partition_point(adjacency, [&timestamp](const STemporalEdge_t & entry) -> bool { return entry.timestamp >= *timestamp; });
+    adjacency.insert(pos, {edge, *timestamp});
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::store_temporal_entries(const SEdge_t & edge) noexcept
+{
+    for (auto & index : m_temporal_indexes)
+    {
+        const auto edge_label_id   = check_if_edge_label_exists(index.edge_label);
+        const auto vertex_label_id = check_if_vertex_label_exists(index.vertex_label);
+
+        if (!(edge_label_id.has_value() && vertex_label_id.has_value()) || *edge_label_id != edge.edge_label_id || !contains_vertex_label_id(edge.src, *vertex_label_id))
+            continue;
+
+        store_temporal_entry(index, edge);
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::rm_temporal_entries(const SEdge_t & edge) noexcept
+{
+    for (auto & index : m_temporal_indexes)
+    {
+        const auto entries_it = index.entries.find(index.incoming ? edge.dst : edge.src);
+
+        if (entries_it == index.entries.end())
+            continue;
+
+        std::erase_if(entries_it->second,
+                      [&edge](const STemporalEdge_t & entry) -> bool
+                      { return entry.edge.src == edge.src && entry.edge.dst == edge.dst && entry.edge.edge_label_id == edge.edge_label_id; });
+
+        if (entries_it->second.empty())
+            index.entries.erase(entries_it);
+    }
+}
+
+bool
+graphquery::database::storage::CMemoryModelHeapLPG::create_property_column(const std::string_view vertex_label, const std::string_view property_key, const EColumnType_t type)
+{
+    std::unique_lock lock(m_graph_lock);
+
+    for (const auto & column : m_property_columns)
+    {
+        if (vertex_label == column.vertex_label && property_key == column.property_key)
+        {
+            m_log_system->warning(fmt::format("Property column on ({}).{} could not be created", vertex_label, property_key));
+            return false;
+        }
+    }
+
+    if (m_property_columns.size() >= PROPERTY_COLUMNS_MAX_AMT)
+    {
+        m_log_system->warning(fmt::format("Property column on ({}).{} could not be created", vertex_label, property_key));
+        return false;
+    }
+
+    SPropertyColumn_t & column = m_property_columns.emplace_back();
+    column.vertex_label        = vertex_label;
+    column.property_key        = property_key;
+    column.type                = type;
+    column.values.resize(m_vertices.size());
+    column.valid.resize(m_vertices.size());
+
+    //~ Populate the column with the vertices already stored.
+    for (const auto vertex_offset : get_vertices_offset_by_label(vertex_label))
+        store_column_entry(column, vertex_offset);
+
+    m_flush_needed = true;
+    return true;
+}
+
+std::optional<uint8_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_property_column(const std::string_view vertex_label, const std::string_view property_key)
+{
+    std::shared_lock lock(m_graph_lock);
+
+    for (uint8_t i = 0; i < m_property_columns.size(); i++)
+    {
+        if (vertex_label == m_property_columns[i].vertex_label && property_key == m_property_columns[i].property_key)
+            return i;
+    }
+
+    return std::nullopt;
+}
+
+std::optional<int64_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_column_value(const uint8_t column_id, const Id_t vertex_offset)
+{
+    std::shared_lock lock(m_graph_lock);
+
+    if (unlikely(column_id >= m_property_columns.size()))
+        return std::nullopt;
+
+    const auto & column = m_property_columns[column_id];
+    if (vertex_offset >= column.valid.size() || !column.valid[vertex_offset])
+        return std::nullopt;
+
+    return column.values[vertex_offset];
+}
+
+std::optional<std::string>
+graphquery::database::storage::CMemoryModelHeapLPG::get_column_string(const uint8_t column_id, const Id_t vertex_offset)
+{
+    std::shared_lock lock(m_graph_lock);
+
+    if (unlikely(column_id >= m_property_columns.size()))
+        return std::nullopt;
+
+    const auto & column = m_property_columns[column_id];
+    if (vertex_offset >= column.valid.size() || !column.valid[vertex_offset])
+        return std::nullopt;
+
+    const int64_t value = column.values[vertex_offset];
+    switch (column.type)
+    {
+    case EColumnType_t::int64:
+    case EColumnType_t::date: return std::to_string(value);
+    case EColumnType_t::float64: return fmt::format("{}", std::bit_cast<double>(value));
+    case EColumnType_t::string: return column.dictionary[value];
+    }
+
+    return std::nullopt;
+}
+
+bool
+graphquery::database::storage::CMemoryModelHeapLPG::scan_property_column(const uint8_t column_id,
+                                                                         const std::function<void(const int64_t * values, const uint8_t * valid, int64_t value_c)> & func)
+{
+    std::shared_lock lock(m_graph_lock);
+
+    if (unlikely(column_id >= m_property_columns.size()))
+        return false;
+
+    const auto & column = m_property_columns[column_id];
+    func(column.values.data(), column.valid.data(), static_cast<int64_t>(column.values.size()));
+    return true;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::store_column_entry(SPropertyColumn_t & column, const Id_t vertex_offset) noexcept
+{
+    if (vertex_offset >= column.values.size())
+    {
+        column.values.resize(m_vertices.size());
+        column.valid.resize(m_vertices.size());
+    }
+
+    const auto vertex_label_id   = check_if_vertex_label_exists(column.vertex_label);
+    std::optional<int64_t> value = std::nullopt;
+
+    if (vertex_label_id.has_value() && contains_vertex_label_id(vertex_offset, *vertex_label_id))
+    {
+        if (const auto prop = get_property_value(m_vertices[vertex_offset].metadata.property_id, column.property_key); prop.has_value())
+            value = encode_column_value(column, *prop);
+    }
+
+    column.values[vertex_offset] = value.value_or(0);
+    column.valid[vertex_offset]  = value.has_value();
+}
+
+std::optional<int64_t>
+graphquery::database::storage::CMemoryModelHeapLPG::encode_column_value(SPropertyColumn_t & column, const std::string_view value) noexcept
+{
+    if (column.type != EColumnType_t::string)
+    {
+        //~ Columns keep the raw bit pattern of a double, rather than the ordered one.
+        if (column.type == EColumnType_t::float64)
+        {
+            double real = {};
+            if (const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), real); ec != std::errc())
+                return std::nullopt;
+            return std::bit_cast<int64_t>(real);
+        }
+
+        return encode_ordered_value(column.type, value);
+    }
+
+    if (const auto it = column.dictionary_map.find(std::string(value)); it != column.dictionary_map.end())
+        return it->second;
+
+    const auto ret = static_cast<int64_t>(column.dictionary.size());
+    column.dictionary.emplace_back(value);
+    column.dictionary_map.emplace(value, ret);
+    return ret;
+}
+
+std::optional<int64_t>
+graphquery::database::storage::CMemoryModelHeapLPG::encode_ordered_value(const EColumnType_t type, const std::string_view value) noexcept
+{
+    int64_t ret = {};
+
+    switch (type)
+    {
+    case EColumnType_t::int64:
+        if (const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), ret); ec != std::errc())
+            return std::nullopt;
+        return ret;
+    case EColumnType_t::date: return utils::parse_date(value);
+    case EColumnType_t::float64:
+    {
+        double real = {};
+        if (const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), real); ec != std::errc())
+            return std::nullopt;
+
+        //~ Flip the magnitude of negative values, such that the bit patterns order as the doubles do.
+        ret = std::bit_cast<int64_t>(real);
+        return ret < 0 ? ret ^ std::numeric_limits<int64_t>::max() : ret;
+    }
+    case EColumnType_t::string: return std::nullopt;
+    }
+
+    return std::nullopt;
+}
+
+bool
+graphquery::database::storage::CMemoryModelHeapLPG::create_property_index(const std::string_view vertex_label,
+                                                                          const std::string_view property_key,
+                                                                          const EIndexType_t index_type,
+                                                                          const EColumnType_t value_type)
+{
+    std::unique_lock lock(m_graph_lock);
+
+    //~ Strings hold no order to parse them by, therefore they are solely hashed.
+    if (get_property_index(vertex_label, property_key).has_value() || m_property_indexes.size() >= PROPERTY_INDEX_MAX_AMT ||
+        (index_type == EIndexType_t::ordered && value_type == EColumnType_t::string))
+    {
+        m_log_system->warning(fmt::format("Property index on ({}).{} could not be created", vertex_label, property_key));
+        return false;
+    }
+
+    SPropertyIndex_t & index = m_property_indexes.emplace_back();
+    index.vertex_label       = vertex_label;
+    index.property_key       = property_key;
+    index.index_type         = index_type;
+    index.value_type         = value_type;
+
+    //~ Populate the index with the vertices already stored.
+    for (const auto vertex_offset : get_vertices_offset_by_label(vertex_label))
+        store_property_index_entry(index, vertex_offset);
+
+    m_flush_needed = true;
+    return true;
+}
+
+std::optional<std::vector<graphquery::database::storage::Id_t>>
+graphquery::database::storage::CMemoryModelHeapLPG::get_vertices_by_property(const std::string_view vertex_label, const std::string_view property_key, const std::string_view value)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto index_id = get_property_index(vertex_label, property_key);
+
+    if (!index_id.has_value())
+        return std::nullopt;
+
+    const auto & index    = m_property_indexes[*index_id];
+    std::vector<Id_t> ret = {};
+
+    //~ Values are hashed as stored, therefore no candidate needs verifying.
+    if (index.index_type == EIndexType_t::hash)
+    {
+        const auto [begin, end] = index.hashed.equal_range(std::string(value));
+
+        for (auto it = begin; it != end; ++it)
+            ret.emplace_back(it->second);
+        return ret;
+    }
+
+    if (const auto key = encode_ordered_value(index.value_type, value); key.has_value())
+    {
+        const auto [begin, end] = index.ordered.equal_range(*key);
+
+        for (auto it = begin; it != end; ++it)
+            ret.emplace_back(it->second);
+    }
+
+    return ret;
+}
+
+std::optional<std::vector<graphquery::database::storage::Id_t>>
+graphquery::database::storage::CMemoryModelHeapLPG::get_vertices_by_property_range(const std::string_view vertex_label,
+                                                                                   const std::string_view property_key,
+                                                                                   const std::string_view lower,
+                                                                                   const std::string_view upper)
+{
+    std::shared_lock lock(m_graph_lock);
+    const auto index_id = get_property_index(vertex_label, property_key);
+
+    if (!index_id.has_value() || m_property_indexes[*index_id].index_type != EIndexType_t::ordered)
+        return std::nullopt;
+
+    const auto & index    = m_property_indexes[*index_id];
+    const auto lower_key  = encode_ordered_value(index.value_type, lower);
+    const auto upper_key  = encode_ordered_value(index.value_type, upper);
+    std::vector<Id_t> ret = {};
+
+    if (!(lower_key.has_value() && upper_key.has_value()) || *lower_key > *upper_key)
+        return ret;
+
+    for (auto it = index.ordered.lower_bound(*lower_key); it != index.ordered.upper_bound(*upper_key); ++it)
+        ret.emplace_back(it->second);
+
+    return ret;
+}
+
+std::optional<uint8_t>
+graphquery::database::storage::CMemoryModelHeapLPG::get_property_index(const std::string_view vertex_label, const std::string_view property_key) const noexcept
+{
+    for (uint8_t i = 0; i < m_property_indexes.size(); i++)
+    {
+        if (vertex_label == m_property_indexes[i].vertex_label && property_key == m_property_indexes[i].property_key)
+            return i;
+    }
+
+    return std::nullopt;
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::store_property_index_entry(SPropertyIndex_t & index, const Id_t vertex_offset) noexcept
+{
+    const auto vertex_label_id = check_if_vertex_label_exists(index.vertex_label);
+
+    if (!vertex_label_id.has_value() || !contains_vertex_label_id(vertex_offset, *vertex_label_id))
+        return;
+
+    const auto value = get_property_value(m_vertices[vertex_offset].metadata.property_id, index.property_key);
+    if (!value.has_value())
+        return;
+
+    if (index.index_type == EIndexType_t::hash)
+        index.hashed.emplace(*value, vertex_offset);
+    else if (const auto key = encode_ordered_value(index.value_type, *value); key.has_value())
+        index.ordered.emplace(*key, vertex_offset);
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::store_vertex_index_entries(const Id_t vertex_offset) noexcept
+{
+    for (auto & column : m_property_columns)
+        store_column_entry(column, vertex_offset);
+
+    for (auto & index : m_property_indexes)
+        store_property_index_entry(index, vertex_offset);
+}
+
+void
+graphquery::database::storage::CMemoryModelHeapLPG::rm_vertex_index_entries(const Id_t vertex_offset) noexcept
+{
+    //~ Drop the values of the vertex from the columns, such that scans skip it.
+    for (auto & column : m_property_columns)
+    {
+        if (vertex_offset < column.valid.size())
+            column.valid[vertex_offset] = false;
+    }
+
+    for (auto & index : m_property_indexes)
+    {
+        const auto value = get_property_value(m_vertices[vertex_offset].metadata.property_id, index.property_key);
+
+        if (!value.has_value())
+            continue;
+
+        if (index.index_type == EIndexType_t::hash)
+        {
+            const auto [begin, end] = index.hashed.equal_range(std::string(*value));
+            const auto entry_it     = std::find_if(begin, end, [vertex_offset](const auto & entry) -> bool { return entry.second == vertex_offset; });
+
+            if (entry_it != end)
+                index.hashed.erase(entry_it);
+        }
+        else if (const auto key = encode_ordered_value(index.value_type, *value); key.has_value())
+        {
+            const auto [begin, end] = index.ordered.equal_range(*key);
+            const auto entry_it     = std::find_if(begin, end, [vertex_offset](const auto & entry) -> bool { return entry.second == vertex_offset; });
+
+            if (entry_it != end)
+                index.ordered.erase(entry_it);
+        }
+    }
+}
+
+int64_t
+graphquery::database::storage::CMemoryModelHeapLPG::get_num_edges()
+{
+    return m_edges_c;
+}
+
+int64_t
+graphquery::database::storage::CMemoryModelHeapLPG::get_num_vertices()
+{
+    return m_vertices_c;
+}
+
+int64_t
+graphquery::database::storage::CMemoryModelHeapLPG::get_total_num_vertices() noexcept
+{
+    return m_vertices.size();
+}
+
+uint16_t
+graphquery::database::storage::CMemoryModelHeapLPG::get_num_vertex_labels()
+{
+    return m_vertex_labels.size();
+}
+
+uint16_t
+graphquery::database::storage::CMemoryModelHeapLPG::get_num_edge_labels()
+{
+    return m_edge_labels.size();
+}
@@ -0,0 +1,354 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file lpg_heap.h
+ * \brief Base of the memory models holding the labelled property
+ *        graph on the heap. Vertices, labels, properties and the
+ *        secondary indexes are kept here, whereas the adjacency is
+ *        left to the derived model, such that each model solely
+ *        defines how its edges are laid out. The graph is persisted
+ *        as a binary snapshot, rather than by a log of transactions.
+ ************************************************************/
+
+#pragma once
+
+#if defined(_WIN32) || defined(_WIN64)
+#define LIB_EXPORT __declspec(dllexport)
+#else
+#define LIB_EXPORT
+#endif
+
+#include "db/storage/graph_model.h"
+#include "snapshot_file.hpp"
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace graphquery::database::storage
+{
+    class CMemoryModelHeapLPG : public ILPGModel
+    {
+      public:
+        /****************************************************************
+         * \enum EActionState_t
+         * \brief Declares the possible return states for this class.
+         *         Supplies a state wether correctness was attained or not.
+         *
+         *  \param valid   - valid state return (no issues found during compute)
+         *  \param invalid - invalid state return (issues were found during compute)
+         ***************************************************************/
+        enum class EActionState_t : int8_t
+        {
+            valid   = 0,
+            invalid = 1
+        };
+
+      protected:
+        /****************************************************************
+         * \struct SVertexEntry_t
+         * \brief Structure of a vertex entry to the vertex list, offsets of
+         *        removed vertices are reused by following vertices.
+         *
+         * \param metadata SVertex_t - metadata info of the vertex
+         * \param valid bool         - whether the offset holds a vertex
+         ***************************************************************/
+        struct SVertexEntry_t
+        {
+            SVertex_t metadata = {};
+            bool valid         = {};
+        };
+
+        /****************************************************************
+         * \struct SPropertyEntry_t
+         * \brief Structure of a property within a property set, referring
+         *        to its interned key.
+         *
+         * \param key_id uint16_t   - id of the property key within the key dictionary
+         * \param value std::string - value of the property
+         ***************************************************************/
+        struct SPropertyEntry_t
+        {
+            uint16_t key_id   = {};
+            std::string value = {};
+        };
+
+        /****************************************************************
+         * \struct SPlainEdge_t
+         * \brief Trivially copyable image of an edge, as written to a snapshot.
+         ***************************************************************/
+        struct SPlainEdge_t
+        {
+            Id_t src               = {};
+            Id_t dst               = {};
+            Id_t property_id       = {};
+            uint16_t edge_label_id = {};
+            uint8_t property_c     = {};
+        };
+
+        /****************************************************************
+         * \struct STemporalIndex_t
+         * \brief Temporal index, ordering the adjacency of a vertex newest
+         *        first by a timestamp property.
+         *
+         * \param vertex_label std::string - label of the source vertex of the indexed edges
+         * \param edge_label std::string   - label of the indexed edges
+         * \param property_key std::string - key of the timestamp property
+         * \param incoming bool            - whether the adjacency is kept for the destination
+         * \param edge_property bool       - whether the property belongs to the edge, else the neighbour
+         * \param entries std::unordered_map - adjacency of each vertex offset, newest first
+         ***************************************************************/
+        struct STemporalIndex_t
+        {
+            std::string vertex_label                                       = {};
+            std::string edge_label                                         = {};
+            std::string property_key                                       = {};
+            bool incoming                                                  = {};
+            bool edge_property                                             = {};
+            std::unordered_map<Id_t, std::vector<STemporalEdge_t>> entries = {};
+        };
+
+        /****************************************************************
+         * \struct SPropertyColumn_t
+         * \brief Column of one property of the vertices of a label, held
+         *        by vertex offset within 8 bytes per value.
+         *
+         * \param vertex_label std::string   - label of the vertices held by the column
+         * \param property_key std::string   - key of the property held by the column
+         * \param type EColumnType_t         - declared type of the values
+         * \param values std::vector         - encoded value of each vertex offset
+         * \param valid std::vector          - whether the vertex offset holds the property
+         * \param dictionary std::vector     - distinct strings of a string column, the index is the encoded value
+         * \param dictionary_map std::unordered_map - distinct strings to their encoded value
+         ***************************************************************/
+        struct SPropertyColumn_t
+        {
+            std::string vertex_label                                = {};
+            std::string property_key                                = {};
+            EColumnType_t type                                      = {};
+            std::vector<int64_t> values                             = {};
+            std::vector<uint8_t> valid                              = {};
+            std::vector<std::string> dictionary                     = {};
+            std::unordered_map<std::string, int64_t> dictionary_map = {};
+        };
+
+        /****************************************************************
+         * \struct SPropertyIndex_t
+         * \brief Secondary property index, mapping the values of a property
+         *        to the offsets of the vertices of a label.
+         *
+         * \param vertex_label std::string  - label of the vertices held by the index
+         * \param property_key std::string  - key of the indexed property
+         * \param index_type EIndexType_t   - hashed or ordered index
+         * \param value_type EColumnType_t  - type the values are parsed by for an ordered index
+         * \param hashed std::unordered_multimap - values as stored to their vertex offsets
+         * \param ordered std::multimap     - parsed values to their vertex offsets
+         ***************************************************************/
+        struct SPropertyIndex_t
+        {
+            std::string vertex_label                           = {};
+            std::string property_key                           = {};
+            EIndexType_t index_type                            = {};
+            EColumnType_t value_type                           = {};
+            std::unordered_multimap<std::string, Id_t> hashed  = {};
+            std::multimap<int64_t, Id_t> ordered               = {};
+        };
+
+      public:
+        explicit CMemoryModelHeapLPG(const std::shared_ptr<logger::CLogSystem> &, const bool & _sync_state_, bool durable);
+        ~CMemoryModelHeapLPG() override = default;
+
+        void close() noexcept override;
+        void create_rollback(std::string_view) noexcept override;
+        void rollback(uint8_t rollback_entry) noexcept override;
+        void sync_graph() noexcept override;
+        void rm_vertex(Id_t src) override;
+        void rm_edge(Id_t src, Id_t dst) override;
+        void rm_edge(Id_t src, Id_t dst, std::string_view edge_label) override;
+        uint32_t out_degree(Id_t id) noexcept override;
+        uint32_t in_degree(Id_t id) noexcept override;
+        void calc_outdegree(uint32_t[]) noexcept override;
+        void calc_indegree(uint32_t[]) noexcept override;
+        void calc_vertex_sparse_map(Id_t[]) noexcept override;
+        double get_avg_out_degree() noexcept override;
+        uint32_t out_degree_by_id(Id_t id) noexcept override;
+        void edgemap(const std::unique_ptr<analytic::IRelax> & relax) noexcept override;
+        [[nodiscard]] std::vector<std::string> fetch_rollback_table() const noexcept override;
+        std::unique_ptr<std::vector<std::vector<int64_t>>> make_inverse_graph() noexcept override;
+        void src_edgemap(Id_t vertex_offset, const std::function<void(int64_t src, int64_t dst)> &) override;
+        void dst_edgemap(Id_t vertex_offset, const std::function<bool(int64_t src, int64_t dst)> &) override;
+
+        [[nodiscard]] int64_t get_num_edges() override;
+        [[nodiscard]] int64_t get_num_vertices() override;
+        [[nodiscard]] int64_t get_total_num_vertices() noexcept override;
+        [[nodiscard]] uint16_t get_num_vertex_labels() override;
+        [[nodiscard]] uint16_t get_num_edge_labels() override;
+        [[nodiscard]] std::string_view get_name() noexcept override;
+        [[nodiscard]] std::optional<SVertex_t> get_vertex(Id_t id) override;
+        [[nodiscard]] std::optional<Id_t> get_vertex_idx(Id_t id) noexcept override;
+        [[nodiscard]] std::optional<Id_t> get_vertex_id(Id_t idx) noexcept override;
+        [[nodiscard]] std::vector<SEdge_t> get_edges_by_label(std::string_view label) override;
+        [[nodiscard]] std::vector<SVertex_t> get_vertices_by_label(std::string_view label) override;
+
+        [[nodiscard]] std::vector<SProperty_t> get_properties_by_id(int64_t id) override;
+        [[nodiscard]] std::vector<SProperty_t> get_properties_by_property_id(Id_t id) override;
+        [[nodiscard]] std::vector<SProperty_t> get_properties_by_vertex(Id_t src) override;
+        [[nodiscard]] std::unordered_map<std::string, std::string> get_properties_by_id_map(int64_t id) override;
+        [[nodiscard]] std::unordered_map<std::string, std::string> get_properties_by_property_id_map(Id_t id) override;
+        [[nodiscard]] std::unordered_map<std::string, std::string> get_properties_by_vertex_map(Id_t src) override;
+
+        [[nodiscard]] std::vector<SEdge_t> get_edges(Id_t src, Id_t dst) override;
+        [[nodiscard]] std::vector<SEdge_t> get_edges(Id_t src, std::string_view edge_label, std::string_view vertex_label) override;
+        [[nodiscard]] std::unordered_set<Id_t> get_edge_dst_vertices(Id_t src, std::string_view edge_label, std::string_view vertex_label) override;
+        [[nodiscard]] std::vector<SEdge_t> get_recursive_edges(Id_t src, std::vector<SProperty_t> edge_vertex_label_pairs) override;
+
+        [[nodiscard]] std::optional<SEdge_t> get_edge(Id_t src_vertex_id, std::string_view edge_label, int64_t dst_vertex_id) override;
+        [[nodiscard]] std::vector<SEdge_t> get_edges(const std::function<bool(const SEdge_t &)> & pred) override;
+        [[nodiscard]] std::vector<SVertex_t> get_vertices(const std::function<bool(const SVertex_t &)> & pred) override;
+        [[nodiscard]] std::vector<SEdge_t> get_edges(std::string_view vertex_label, std::string_view edge_label, Id_t dst) override;
+        [[nodiscard]] std::vector<SEdge_t> get_edges_by_offset(Id_t vertex_id, std::string_view edge_label, std::string_view vertex_label) override;
+        [[nodiscard]] std::vector<SEdge_t> get_edges(std::string_view vertex_label, const std::function<bool(const SEdge_t &)> & pred) override;
+        [[nodiscard]] std::unordered_set<Id_t> get_edge_dst_vertices(Id_t src, const std::function<bool(const SEdge_t &)> & pred) override;
+        [[nodiscard]] std::vector<SEdge_t> get_edges(std::string_view vertex_label, std::string_view edge_label, const std::function<bool(const SEdge_t &)> & pred) override;
+        [[nodiscard]] std::vector<SEdge_t> get_edges(std::string_view vertex_label, std::string_view edge_label) override;
+        [[nodiscard]] std::vector<SEdge_t> get_edges(std::string_view vertex_label, std::string_view edge_label, std::string_view dst_vertex_label) override;
+
+        bool create_temporal_index(std::string_view vertex_label, std::string_view edge_label, std::string_view property_key, bool incoming, bool edge_property) override;
+        [[nodiscard]] std::optional<std::vector<STemporalEdge_t>>
+        get_recent_edges(Id_t vertex_id, std::string_view vertex_label, std::string_view edge_label, bool incoming, size_t limit, int64_t max_timestamp) override;
+
+        bool create_property_column(std::string_view vertex_label, std::string_view property_key, EColumnType_t type) override;
+        [[nodiscard]] std::optional<uint8_t> get_property_column(std::string_view vertex_label, std::string_view property_key) override;
+        [[nodiscard]] std::optional<int64_t> get_column_value(uint8_t column_id, Id_t vertex_offset) override;
+        [[nodiscard]] std::optional<std::string> get_column_string(uint8_t column_id, Id_t vertex_offset) override;
+        bool scan_property_column(uint8_t column_id, const std::function<void(const int64_t * values, const uint8_t * valid, int64_t value_c)> & func) override;
+
+        bool create_property_index(std::string_view vertex_label, std::string_view property_key, EIndexType_t index_type, EColumnType_t value_type) override;
+        [[nodiscard]] std::optional<std::vector<Id_t>> get_vertices_by_property(std::string_view vertex_label, std::string_view property_key, std::string_view value) override;
+        [[nodiscard]] std::optional<std::vector<Id_t>>
+        get_vertices_by_property_range(std::string_view vertex_label, std::string_view property_key, std::string_view lower, std::string_view upper) override;
+
+        void load_graph(std::filesystem::path path, std::string_view graph) noexcept override;
+        void create_graph(std::filesystem::path path, std::string_view graph) noexcept override;
+        void add_vertex(const std::vector<std::string_view> & label, const std::vector<SProperty_t> & prop) override;
+        void add_vertex(Id_t src, const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & prop) override;
+        void add_edge(Id_t src, Id_t dst, std::string_view label, const std::vector<SProperty_t> & prop, bool undirected) override;
+        [[nodiscard]] bool commit_transaction(STransaction_t & transaction) override;
+        void bulk_load(STransaction_t & batch, bool deduplicated) override;
+        [[nodiscard]] bool finish_bulk_load() override;
+
+      protected:
+        //~ Property id of an entity without properties, as within the mmap model.
+        static constexpr Id_t END_INDEX = std::numeric_limits<Id_t>::max();
+
+        //~ Adjacency of the derived model, each is called whilst the graph lock is held.
+        virtual void store_edge(const SEdge_t & edge) noexcept = 0;
+        virtual void rm_edges(Id_t src_idx, Id_t dst_idx, std::optional<uint16_t> edge_label_id, std::vector<SEdge_t> & removed) noexcept = 0;
+        virtual void rm_vertex_edges(Id_t vertex_idx, std::vector<SEdge_t> & removed) noexcept = 0;
+        virtual void scan_out_edges(Id_t src_idx, std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept = 0;
+        virtual void scan_in_edges(Id_t dst_idx, std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept = 0;
+        virtual void reset_edges() noexcept = 0;
+        [[nodiscard]] virtual bool check_if_edge_exists(Id_t src_idx, Id_t dst_idx, uint16_t edge_label_id) noexcept = 0;
+
+        //~ Adjacency hooks with a default, which derived models may specialise.
+        virtual void store_edges(const std::vector<SEdge_t> & edges) noexcept;
+        virtual void reserve_vertices(Id_t vertex_c) noexcept;
+        virtual void flush_edges() noexcept;
+
+        [[nodiscard]] bool check_if_vertex_valid(Id_t vertex_offset) const noexcept;
+        bool store_snapshot(std::string_view file_name) noexcept;
+        [[nodiscard]] bool load_snapshot(std::string_view file_name) noexcept;
+
+        std::string m_graph_name;
+        std::filesystem::path m_graph_path;
+        std::vector<SVertexEntry_t> m_vertices;
+        mutable std::shared_mutex m_graph_lock;
+
+      private:
+        void reset_graph() noexcept;
+        void store_rollback_table() const noexcept;
+        void load_rollback_table() noexcept;
+
+        [[nodiscard]] EActionState_t add_vertex_entry(Id_t id, const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & props) noexcept;
+        [[nodiscard]] EActionState_t add_edge_entry(Id_t src, Id_t dst, std::string_view edge_label, const std::vector<SProperty_t> & props, bool undirected, bool deduplicated = false) noexcept;
+        [[nodiscard]] EActionState_t rm_vertex_entry(Id_t src) noexcept;
+        [[nodiscard]] EActionState_t rm_edge_entry(Id_t src, Id_t dst, std::optional<std::string_view> edge_label) noexcept;
+        void store_edge_entry(Id_t src_idx, Id_t dst_idx, uint16_t edge_label_id, const std::vector<SProperty_t> & props) noexcept;
+        void release_edges(const std::vector<SEdge_t> & edges) noexcept;
+        [[nodiscard]] EActionState_t apply_mutation(const SMutation_t & mutation, std::vector<SMutation_t> & undo) noexcept;
+        void undo_mutations(std::vector<SMutation_t> & undo) noexcept;
+        [[nodiscard]] SMutation_t make_edge_mutation(const SEdge_t & edge) const noexcept;
+
+        [[nodiscard]] Id_t store_property_set(const std::vector<SProperty_t> & props) noexcept;
+        void rm_property_set(Id_t property_id) noexcept;
+        [[nodiscard]] std::vector<SProperty_t> read_property_set(Id_t property_id) const noexcept;
+        [[nodiscard]] std::unordered_map<std::string, std::string> read_property_set_map(Id_t property_id) const noexcept;
+        [[nodiscard]] std::optional<std::string_view> get_property_value(Id_t property_id, std::string_view key) const noexcept;
+
+        [[nodiscard]] uint16_t create_vertex_label(std::string_view label) noexcept;
+        [[nodiscard]] uint16_t create_edge_label(std::string_view label) noexcept;
+        [[nodiscard]] uint16_t create_property_key(std::string_view key) noexcept;
+        [[nodiscard]] std::optional<uint16_t> check_if_vertex_label_exists(std::string_view label) const noexcept;
+        [[nodiscard]] std::optional<uint16_t> check_if_edge_label_exists(std::string_view label) const noexcept;
+        [[nodiscard]] std::optional<uint16_t> check_if_property_key_exists(std::string_view key) const noexcept;
+        [[nodiscard]] bool contains_vertex_label_id(Id_t vertex_offset, uint16_t label_id) const noexcept;
+
+        [[nodiscard]] std::optional<Id_t> lookup_vertex(Id_t id) const noexcept;
+        [[nodiscard]] std::vector<Id_t> get_vertices_offset_by_label(std::string_view label) const noexcept;
+        [[nodiscard]] std::vector<SEdge_t> get_out_edges(Id_t src_idx, std::optional<uint16_t> edge_label_id, const std::function<bool(const SEdge_t &)> & pred) noexcept;
+        [[nodiscard]] std::vector<SEdge_t> get_in_edges(Id_t dst_idx, std::optional<uint16_t> edge_label_id, const std::function<bool(const SEdge_t &)> & pred) noexcept;
+        [[nodiscard]] std::vector<SEdge_t> get_label_edges(std::string_view vertex_label, std::optional<uint16_t> edge_label_id, const std::function<bool(const SEdge_t &)> & pred) noexcept;
+
+        [[nodiscard]] std::optional<uint8_t> get_temporal_index(std::string_view vertex_label, std::string_view edge_label, bool incoming) const noexcept;
+        [[nodiscard]] std::optional<int64_t> get_temporal_timestamp(const STemporalIndex_t & index, const SEdge_t & edge) const noexcept;
+        void store_temporal_entry(STemporalIndex_t & index, const SEdge_t & edge) noexcept;
+        void store_temporal_entries(const SEdge_t & edge) noexcept;
+        void rm_temporal_entries(const SEdge_t & edge) noexcept;
+
+        [[nodiscard]] std::optional<uint8_t> get_property_index(std::string_view vertex_label, std::string_view property_key) const noexcept;
+        void store_column_entry(SPropertyColumn_t & column, Id_t vertex_offset) noexcept;
+        void store_property_index_entry(SPropertyIndex_t & index, Id_t vertex_offset) noexcept;
+        void store_vertex_index_entries(Id_t vertex_offset) noexcept;
+        void rm_vertex_index_entries(Id_t vertex_offset) noexcept;
+        [[nodiscard]] static std::optional<int64_t> encode_column_value(SPropertyColumn_t & column, std::string_view value) noexcept;
+        [[nodiscard]] static std::optional<int64_t> encode_ordered_value(EColumnType_t type, std::string_view value) noexcept;
+
+        const bool m_durable;
+        bool m_flush_needed = false;
+        Id_t m_vertices_c   = {};
+        Id_t m_edges_c      = {};
+
+        std::unordered_map<Id_t, Id_t> m_index;
+        std::vector<Id_t> m_free_vertices;
+        std::vector<std::vector<Id_t>> m_label_vertex;
+        std::vector<std::vector<SPropertyEntry_t>> m_property_sets;
+        std::vector<Id_t> m_free_property_sets;
+
+        std::vector<SLabel_t> m_vertex_labels;
+        std::vector<SLabel_t> m_edge_labels;
+        std::vector<std::string> m_property_keys;
+        std::unordered_map<std::string, uint16_t> m_v_label_map;
+        std::unordered_map<std::string, uint16_t> m_e_label_map;
+        std::unordered_map<std::string, uint16_t> m_p_key_map;
+
+        std::vector<STemporalIndex_t> m_temporal_indexes;
+        std::vector<SPropertyColumn_t> m_property_columns;
+        std::vector<SPropertyIndex_t> m_property_indexes;
+        std::vector<std::string> m_rollback_table;
+        uint8_t m_rollback_c = {};
+
+        static constexpr uint8_t VERTEX_LABELS_MAX_AMT    = CFG_LPG_VERTEX_LABELS_MAX_AMT;
+        static constexpr uint8_t TEMPORAL_INDEX_MAX_AMT   = 8;
+        static constexpr uint8_t PROPERTY_COLUMNS_MAX_AMT = 32;
+        static constexpr uint8_t PROPERTY_INDEX_MAX_AMT   = 32;
+        static constexpr uint8_t ROLLBACK_MAX_AMOUNT      = 5;
+
+        static constexpr const char * SNAPSHOT_FILE_NAME = "snapshot";
+        static constexpr const char * ROLLBACK_FILE_NAME = "rollback";
+    };
+} // namespace graphquery::database::storage
@@ -0,0 +1,160 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file snapshot_file.hpp
+ * \brief Snapshot file for sequentially storing and reading a
+ *        binary image of a graph held on the heap, such that the
+ *        graph can be restored once reopened. Helper class for
+ *        heap memory models.
+ ************************************************************/
+
+#pragma once
+
+#include "db/storage/diskdriver/diskdriver.h"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace graphquery::database::storage
+{
+    class CSnapshotFile
+    {
+      public:
+        /****************************************************************
+         * \struct SSnapshotHeader_t
+         * \brief Describes the header of a snapshot, used to validate the
+         *        image before it is read.
+         *
+         * \param magic uint32_t   - constant marking a written snapshot
+         * \param id_size uint8_t  - width in bytes of Id_t the snapshot was written with
+         * \param eof_addr int64_t - addr following the last written byte
+         ***************************************************************/
+        struct SSnapshotHeader_t
+        {
+            uint32_t magic   = {};
+            uint8_t id_size  = {};
+            int64_t eof_addr = {};
+        };
+
+        ~CSnapshotFile() = default;
+        CSnapshotFile()  = default;
+        CSnapshotFile(const CSnapshotFile &)                 = delete;
+        CSnapshotFile(CSnapshotFile &&) noexcept             = delete;
+        CSnapshotFile & operator=(const CSnapshotFile &)     = delete;
+        CSnapshotFile & operator=(CSnapshotFile &&) noexcept = delete;
+
+        [[nodiscard]] bool open(const std::filesystem::path & path, std::string_view file_name, bool create) noexcept;
+        void close() noexcept;
+        void begin_write() noexcept;
+        void end_write() noexcept;
+        [[nodiscard]] bool begin_read() noexcept;
+        void write_string(std::string_view value) noexcept;
+        [[nodiscard]] std::string read_string() noexcept;
+
+        template<typename T>
+            requires std::is_trivially_copyable_v<T>
+        void write(const T & value) noexcept;
+
+        template<typename T>
+            requires std::is_trivially_copyable_v<T>
+        [[nodiscard]] T read() noexcept;
+
+      private:
+        CDiskDriver m_file;
+
+        static constexpr uint32_t SNAPSHOT_MAGIC    = 0x47515348; //~ "GQSH"
+        static constexpr int64_t HEADER_START_ADDR  = 0x00000000;
+        static constexpr int64_t CONTENT_START_ADDR = 0x00000040;
+    };
+} // namespace graphquery::database::storage
+
+inline bool
+graphquery::database::storage::CSnapshotFile::open(const std::filesystem::path & path, const std::string_view file_name, const bool create) noexcept
+{
+    if (!CDiskDriver::check_if_file_exists(path.string(), file_name))
+    {
+        if (!create)
+            return false;
+
+        (void) CDiskDriver::create_file(path, file_name);
+    }
+
+    m_file.set_path(path);
+    m_file.open(file_name);
+    return true;
+}
+
+inline void
+graphquery::database::storage::CSnapshotFile::close() noexcept
+{
+    (void) m_file.close();
+}
+
+inline void
+graphquery::database::storage::CSnapshotFile::begin_write() noexcept
+{
+    //~ Invalidate the former image, such that a partially written snapshot is never read.
+    *m_file.ref<SSnapshotHeader_t, true>(HEADER_START_ADDR).ref = {};
+    (void) m_file.seek(CONTENT_START_ADDR);
+}
+
+inline void
+graphquery::database::storage::CSnapshotFile::end_write() noexcept
+{
+    const auto eof_addr = static_cast<int64_t>(m_file.get_seek_offset());
+    (void) m_file.sync();
+
+    *m_file.ref<SSnapshotHeader_t, true>(HEADER_START_ADDR).ref = {SNAPSHOT_MAGIC, sizeof(Id_t), eof_addr};
+    (void) m_file.sync();
+}
+
+inline bool
+graphquery::database::storage::CSnapshotFile::begin_read() noexcept
+{
+    const SSnapshotHeader_t header = *m_file.ref<SSnapshotHeader_t>(HEADER_START_ADDR).ref;
+
+    if (header.magic != SNAPSHOT_MAGIC || header.id_size != sizeof(Id_t))
+        return false;
+
+    (void) m_file.seek(CONTENT_START_ADDR);
+    return true;
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+void
+graphquery::database::storage::CSnapshotFile::write(const T & value) noexcept
+{
+    (void) m_file.write(&value, sizeof(T), 1);
+}
+
+template<typename T>
+    requires std::is_trivially_copyable_v<T>
+T
+graphquery::database::storage::CSnapshotFile::read() noexcept
+{
+    T ret = {};
+    (void) m_file.read(&ret, sizeof(T), 1);
+    return ret;
+}
+
+inline void
+graphquery::database::storage::CSnapshotFile::write_string(const std::string_view value) noexcept
+{
+    write(static_cast<uint32_t>(value.size()));
+
+    if (!value.empty())
+        (void) m_file.write(value.data(), sizeof(char), value.size());
+}
+
+inline std::string
+graphquery::database::storage::CSnapshotFile::read_string() noexcept
+{
+    std::string ret(read<uint32_t>(), '\0');
+
+    if (!ret.empty())
+        (void) m_file.read(ret.data(), sizeof(char), ret.size());
+    return ret;
+}
@@ -0,0 +1,164 @@
+#include "lpg_inmem.h"
+
+#include <algorithm>
+#include <cassert>
+
+graphquery::database::storage::CMemoryModelInMemLPG::CMemoryModelInMemLPG(const std::shared_ptr<logger::CLogSystem> & log_system, const bool & sync_state_):
+    CMemoryModelHeapLPG(log_system, sync_state_, false)
+{
+}
+
+graphquery::database::storage::CMemoryModelInMemLPG::~
+CMemoryModelInMemLPG()
+{
+    close();
+}
+
+void
+graphquery::database::storage::CMemoryModelInMemLPG::edgemap(const std::unique_ptr<analytic::IRelax> & relax) noexcept
+{
+    //~ Walk the adjacency directly, rather than through the scan callback of the base model.
+    std::shared_lock lock(m_graph_lock);
+    const auto vertex_c = static_cast<int64_t>(m_out_edges.size());
+
+#pragma omp parallel for default(none) shared(relax, vertex_c) schedule(dynamic, 1024)
+    for (int64_t i = 0; i < vertex_c; i++)
+    {
+        for (const auto & entry : m_out_edges[i])
+            relax->relax(i, entry.neighbour);
+    }
+}
+
+graphquery::database::storage::ILPGModel::SEdge_t
+graphquery::database::storage::CMemoryModelInMemLPG::make_edge(const Id_t src, const Id_t dst, const SAdjacency_t & entry) noexcept
+{
+    SEdge_t edge       = {};
+    edge.src           = src;
+    edge.dst           = dst;
+    edge.property_id   = entry.property_id;
+    edge.edge_label_id = entry.edge_label_id;
+    edge.property_c    = entry.property_c;
+    return edge;
+}
+
+bool
+graphquery::database::storage::CMemoryModelInMemLPG::erase_entry(Adjacency_t & adjacency, const Id_t neighbour, const uint16_t edge_label_id) noexcept
+{
+    for (uint32_t i = 0; i < adjacency.size(); i++)
+    {
+        if (adjacency[i].neighbour == neighbour && adjacency[i].edge_label_id == edge_label_id)
+        {
+            adjacency.erase(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void
+graphquery::database::storage::CMemoryModelInMemLPG::store_edge(const SEdge_t & edge) noexcept
+{
+    assert(edge.src < m_out_edges.size() && edge.dst < m_in_edges.size());
+
+    m_out_edges[edge.src].push_back({edge.dst, edge.property_id, edge.edge_label_id, edge.property_c});
+    m_in_edges[edge.dst].push_back({edge.src, edge.property_id, edge.edge_label_id, edge.property_c});
+}
+
+void
+graphquery::database::storage::CMemoryModelInMemLPG::rm_edges(const Id_t src_idx, const Id_t dst_idx, const std::optional<uint16_t> edge_label_id, std::vector<SEdge_t> & removed) noexcept
+{
+    auto & out_edges = m_out_edges[src_idx];
+
+    for (uint32_t i = 0; i < out_edges.size();)
+    {
+        const auto & entry = out_edges[i];
+
+        if (entry.neighbour != dst_idx || (edge_label_id.has_value() && entry.edge_label_id != *edge_label_id))
+        {
+            i++;
+            continue;
+        }
+
+        removed.emplace_back(make_edge(src_idx, dst_idx, entry));
+        [[maybe_unused]] const bool erased = erase_entry(m_in_edges[dst_idx], src_idx, entry.edge_label_id);
+        assert(erased);
+        out_edges.erase(i);
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelInMemLPG::rm_vertex_edges(const Id_t vertex_idx, std::vector<SEdge_t> & removed) noexcept
+{
+    for (const auto & entry : m_out_edges[vertex_idx])
+    {
+        removed.emplace_back(make_edge(vertex_idx, entry.neighbour, entry));
+        (void) erase_entry(m_in_edges[entry.neighbour], vertex_idx, entry.edge_label_id);
+    }
+
+    //~ Self loops were removed along with the outgoing entries, therefore each edge is returned once.
+    for (const auto & entry : m_in_edges[vertex_idx])
+    {
+        removed.emplace_back(make_edge(entry.neighbour, vertex_idx, entry));
+        (void) erase_entry(m_out_edges[entry.neighbour], vertex_idx, entry.edge_label_id);
+    }
+
+    m_out_edges[vertex_idx].clear();
+    m_in_edges[vertex_idx].clear();
+}
+
+void
+graphquery::database::storage::CMemoryModelInMemLPG::scan_out_edges(const Id_t src_idx, const std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept
+{
+    for (const auto & entry : m_out_edges[src_idx])
+    {
+        if (!edge_label_id.has_value() || entry.edge_label_id == *edge_label_id)
+            func(make_edge(src_idx, entry.neighbour, entry));
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelInMemLPG::scan_in_edges(const Id_t dst_idx, const std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept
+{
+    for (const auto & entry : m_in_edges[dst_idx])
+    {
+        if (!edge_label_id.has_value() || entry.edge_label_id == *edge_label_id)
+            func(make_edge(entry.neighbour, dst_idx, entry));
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelInMemLPG::reset_edges() noexcept
+{
+    m_out_edges.clear();
+    m_in_edges.clear();
+}
+
+void
+graphquery::database::storage::CMemoryModelInMemLPG::reserve_vertices(const Id_t vertex_c) noexcept
+{
+    if (vertex_c <= m_out_edges.size())
+        return;
+
+    m_out_edges.resize(vertex_c);
+    m_in_edges.resize(vertex_c);
+}
+
+bool
+graphquery::database::storage::CMemoryModelInMemLPG::check_if_edge_exists(const Id_t src_idx, const Id_t dst_idx, const uint16_t edge_label_id) noexcept
+{
+    //~ Search the shorter of the two adjacencies.
+    if (m_out_edges[src_idx].size() <= m_in_edges[dst_idx].size())
+        return std::ranges::any_of(m_out_edges[src_idx], [dst_idx, edge_label_id](const SAdjacency_t & entry) -> bool { return entry.neighbour == dst_idx && entry.edge_label_id == edge_label_id; });
+
+    return std::ranges::any_of(m_in_edges[dst_idx], [src_idx, edge_label_id](const SAdjacency_t & entry) -> bool { return entry.neighbour == src_idx && entry.edge_label_id == edge_label_id; });
+}
+
+extern "C"
+{
+    LIB_EXPORT void create_graph_model(graphquery::database::storage::ILPGModel ** graph_model, const std::shared_ptr<graphquery::logger::CLogSystem> & log_system, const bool & _sync_state_)
+    {
+        assert(log_system != nullptr);
+        *graph_model = new graphquery::database::storage::CMemoryModelInMemLPG(log_system, _sync_state_);
+    }
+}
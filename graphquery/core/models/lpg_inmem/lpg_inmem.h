@@ -0,0 +1,68 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file lpg_inmem.h
+ * \brief Dervied instance of a memory model, supporting
+ *        the labelled property graph functionality, held entirely
+ *        within volatile memory. The adjacency of each vertex is a
+ *        small vector, without a write-ahead log, such that updates
+ *        carry no disk cost. The graph only reaches disk through a
+ *        rollback snapshot taken on demand.
+ ************************************************************/
+
+#pragma once
+
+#include "models/lpg_heap/lpg_heap.h"
+#include "small_vector.hpp"
+
+namespace graphquery::database::storage
+{
+    class CMemoryModelInMemLPG final : public CMemoryModelHeapLPG
+    {
+      public:
+        explicit CMemoryModelInMemLPG(const std::shared_ptr<logger::CLogSystem> &, const bool & _sync_state_);
+        ~CMemoryModelInMemLPG() override;
+
+        void edgemap(const std::unique_ptr<analytic::IRelax> & relax) noexcept override;
+
+      protected:
+        void store_edge(const SEdge_t & edge) noexcept override;
+        void rm_edges(Id_t src_idx, Id_t dst_idx, std::optional<uint16_t> edge_label_id, std::vector<SEdge_t> & removed) noexcept override;
+        void rm_vertex_edges(Id_t vertex_idx, std::vector<SEdge_t> & removed) noexcept override;
+        void scan_out_edges(Id_t src_idx, std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept override;
+        void scan_in_edges(Id_t dst_idx, std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept override;
+        void reset_edges() noexcept override;
+        void reserve_vertices(Id_t vertex_c) noexcept override;
+        [[nodiscard]] bool check_if_edge_exists(Id_t src_idx, Id_t dst_idx, uint16_t edge_label_id) noexcept override;
+
+      private:
+        /****************************************************************
+         * \struct SAdjacency_t
+         * \brief Structure of an edge within the adjacency of a vertex,
+         *        the vertex owning the adjacency is implied.
+         *
+         * \param neighbour Id_t       - offset of the vertex on the other end
+         * \param property_id Id_t     - property set of the edge
+         * \param edge_label_id uint16_t - label id of the edge
+         * \param property_c uint8_t   - amount of properties
+         ***************************************************************/
+        struct SAdjacency_t
+        {
+            Id_t neighbour         = {};
+            Id_t property_id       = {};
+            uint16_t edge_label_id = {};
+            uint8_t property_c     = {};
+        };
+
+        //~ Edges held inline within each adjacency before it is allocated.
+        static constexpr uint32_t INLINE_EDGES_AMT = 2;
+
+        using Adjacency_t = CSmallVector<SAdjacency_t, INLINE_EDGES_AMT>;
+
+        [[nodiscard]] static inline SEdge_t make_edge(Id_t src, Id_t dst, const SAdjacency_t & entry) noexcept;
+        static bool erase_entry(Adjacency_t & adjacency, Id_t neighbour, uint16_t edge_label_id) noexcept;
+
+        std::vector<Adjacency_t> m_out_edges;
+        std::vector<Adjacency_t> m_in_edges;
+    };
+} // namespace graphquery::database::storage
@@ -0,0 +1,234 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file small_vector.hpp
+ * \brief Vector holding its first entries inline, spilling onto
+ *        the heap once they are exceeded. As most vertices hold few
+ *        neighbours, the adjacency of each is kept without an
+ *        allocation of its own. Helper class for lpg inmem memory
+ *        model.
+ ************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+namespace graphquery::database::storage
+{
+    template<typename T, uint32_t N>
+    class CSmallVector
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Entries are relocated by memcpy");
+        static_assert(N > 0, "Inline capacity must hold at least one entry");
+
+      public:
+        CSmallVector() = default;
+        ~CSmallVector();
+        CSmallVector(CSmallVector && other) noexcept;
+        CSmallVector & operator=(CSmallVector && other) noexcept;
+        CSmallVector(const CSmallVector &)             = delete;
+        CSmallVector & operator=(const CSmallVector &) = delete;
+
+        [[nodiscard]] inline T * data() noexcept;
+        [[nodiscard]] inline const T * data() const noexcept;
+        [[nodiscard]] inline T * begin() noexcept;
+        [[nodiscard]] inline T * end() noexcept;
+        [[nodiscard]] inline const T * begin() const noexcept;
+        [[nodiscard]] inline const T * end() const noexcept;
+        [[nodiscard]] inline T & operator[](uint32_t i) noexcept;
+        [[nodiscard]] inline const T & operator[](uint32_t i) const noexcept;
+        [[nodiscard]] inline uint32_t size() const noexcept;
+        [[nodiscard]] inline bool empty() const noexcept;
+        [[nodiscard]] inline bool is_inline() const noexcept;
+
+        void push_back(const T & entry) noexcept;
+        void erase(uint32_t i) noexcept;
+        void clear() noexcept;
+
+      private:
+        void grow() noexcept;
+
+        uint32_t m_size     = {};
+        uint32_t m_capacity = N;
+
+        union
+        {
+            alignas(T) std::byte m_inline[N * sizeof(T)];
+            T * m_heap;
+        };
+    };
+
+    template<typename T, uint32_t N>
+    graphquery::database::storage::CSmallVector<T, N>::~CSmallVector()
+    {
+        if (!is_inline())
+            std::free(m_heap);
+    }
+
+    template<typename T, uint32_t N>
+    graphquery::database::storage::CSmallVector<T, N>::CSmallVector(CSmallVector && other) noexcept: m_size(other.m_size), m_capacity(other.m_capacity)
+    {
+        if (other.is_inline())
+            std::memcpy(m_inline, other.m_inline, m_size * sizeof(T));
+        else
+            m_heap = other.m_heap;
+
+        other.m_size     = 0;
+        other.m_capacity = N;
+    }
+
+    template<typename T, uint32_t N>
+    graphquery::database::storage::CSmallVector<T, N> &
+    graphquery::database::storage::CSmallVector<T, N>::operator=(CSmallVector && other) noexcept
+    {
+        if (this == &other)
+            return *this;
+
+        if (!is_inline())
+            std::free(m_heap);
+
+        m_size     = other.m_size;
+        m_capacity = other.m_capacity;
+
+        if (other.is_inline())
+            std::memcpy(m_inline, other.m_inline, m_size * sizeof(T));
+        else
+            m_heap = other.m_heap;
+
+        other.m_size     = 0;
+        other.m_capacity = N;
+        return *this;
+    }
+
+    template<typename T, uint32_t N>
+    T *
+    graphquery::database::storage::CSmallVector<T, N>::data() noexcept
+    {
+        return is_inline() ? std::launder(reinterpret_cast<T *>(m_inline)) : m_heap;
+    }
+
+    template<typename T, uint32_t N>
+    const T *
+    graphquery::database::storage::CSmallVector<T, N>::data() const noexcept
+    {
+        return is_inline() ? std::launder(reinterpret_cast<const T *>(m_inline)) : m_heap;
+    }
+
+    template<typename T, uint32_t N>
+    T *
+    graphquery::database::storage::CSmallVector<T, N>::begin() noexcept
+    {
+        return data();
+    }
+
+    template<typename T, uint32_t N>
+    T *
+    graphquery::database::storage::CSmallVector<T, N>::end() noexcept
+    {
+        return data() + m_size;
+    }
+
+    template<typename T, uint32_t N>
+    const T *
+    graphquery::database::storage::CSmallVector<T, N>::begin() const noexcept
+    {
+        return data();
+    }
+
+    template<typename T, uint32_t N>
+    const T *
+    graphquery::database::storage::CSmallVector<T, N>::end() const noexcept
+    {
+        return data() + m_size;
+    }
+
+    template<typename T, uint32_t N>
+    T &
+    graphquery::database::storage::CSmallVector<T, N>::operator[](const uint32_t i) noexcept
+    {
+        return data()[i];
+    }
+
+    template<typename T, uint32_t N>
+    const T &
+    graphquery::database::storage::CSmallVector<T, N>::operator[](const uint32_t i) const noexcept
+    {
+        return data()[i];
+    }
+
+    template<typename T, uint32_t N>
+    uint32_t
+    graphquery::database::storage::CSmallVector<T, N>::size() const noexcept
+    {
+        return m_size;
+    }
+
+    template<typename T, uint32_t N>
+    bool
+    graphquery::database::storage::CSmallVector<T, N>::empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    template<typename T, uint32_t N>
+    bool
+    graphquery::database::storage::CSmallVector<T, N>::is_inline() const noexcept
+    {
+        return m_capacity == N;
+    }
+
+    template<typename T, uint32_t N>
+    void
+    graphquery::database::storage::CSmallVector<T, N>::push_back(const T & entry) noexcept
+    {
+        if (m_size == m_capacity)
+            grow();
+
+        data()[m_size++] = entry;
+    }
+
+    template<typename T, uint32_t N>
+    void
+    graphquery::database::storage::CSmallVector<T, N>::erase(const uint32_t i) noexcept
+    {
+        //~ Entries following are shifted down, keeping the order they were inserted in.
+        T * entries = data();
+        std::memmove(entries + i, entries + i + 1, (m_size - i - 1) * sizeof(T));
+        m_size--;
+    }
+
+    template<typename T, uint32_t N>
+    void
+    graphquery::database::storage::CSmallVector<T, N>::clear() noexcept
+    {
+        if (!is_inline())
+            std::free(m_heap);
+
+        m_size     = 0;
+        m_capacity = N;
+    }
+
+    template<typename T, uint32_t N>
+    void
+    graphquery::database::storage::CSmallVector<T, N>::grow() noexcept
+    {
+        const uint32_t capacity = std::max<uint32_t>(m_capacity * 2, 4);
+
+        if (is_inline())
+        {
+            auto * heap = static_cast<T *>(std::malloc(capacity * sizeof(T)));
+            std::memcpy(heap, m_inline, m_size * sizeof(T));
+            m_heap = heap;
+        }
+        else
+            m_heap = static_cast<T *>(std::realloc(m_heap, capacity * sizeof(T)));
+
+        m_capacity = capacity;
+    }
+} // namespace graphquery::database::storage
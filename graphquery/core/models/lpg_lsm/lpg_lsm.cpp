@@ -0,0 +1,112 @@
+#include "lpg_lsm.h"
+
+#include <cassert>
+
+graphquery::database::storage::CMemoryModelLSMLPG::CMemoryModelLSMLPG(const std::shared_ptr<logger::CLogSystem> & log_system, const bool & sync_state_):
+    CMemoryModelHeapLPG(log_system, sync_state_, true)
+{
+}
+
+graphquery::database::storage::CMemoryModelLSMLPG::~
+CMemoryModelLSMLPG()
+{
+    close();
+}
+
+void
+graphquery::database::storage::CMemoryModelLSMLPG::store_edge(const SEdge_t & edge) noexcept
+{
+    m_out_edges.insert(edge);
+    m_in_edges.insert(edge);
+}
+
+void
+graphquery::database::storage::CMemoryModelLSMLPG::store_edges(const std::vector<SEdge_t> & edges) noexcept
+{
+    m_out_edges.insert_batch(edges);
+    m_in_edges.insert_batch(edges);
+}
+
+void
+graphquery::database::storage::CMemoryModelLSMLPG::rm_edges(const Id_t src_idx, const Id_t dst_idx, const std::optional<uint16_t> edge_label_id, std::vector<SEdge_t> & removed) noexcept
+{
+    const size_t removed_c = removed.size();
+    m_out_edges.scan(src_idx,
+                     edge_label_id,
+                     [&removed, dst_idx](const SEdge_t & edge) -> void
+                     {
+                         if (edge.dst == dst_idx)
+                             removed.emplace_back(edge);
+                     });
+
+    for (size_t i = removed_c; i < removed.size(); i++)
+    {
+        m_out_edges.remove(src_idx, removed[i].edge_label_id, dst_idx);
+        m_in_edges.remove(dst_idx, removed[i].edge_label_id, src_idx);
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelLSMLPG::rm_vertex_edges(const Id_t vertex_idx, std::vector<SEdge_t> & removed) noexcept
+{
+    const size_t out_c = removed.size();
+    m_out_edges.scan(vertex_idx, std::nullopt, [&removed](const SEdge_t & edge) -> void { removed.emplace_back(edge); });
+
+    for (size_t i = out_c; i < removed.size(); i++)
+    {
+        m_out_edges.remove(vertex_idx, removed[i].edge_label_id, removed[i].dst);
+        m_in_edges.remove(removed[i].dst, removed[i].edge_label_id, vertex_idx);
+    }
+
+    //~ Self loops were tombstoned along with the outgoing entries, therefore each edge is returned once.
+    const size_t in_c = removed.size();
+    m_in_edges.scan(vertex_idx, std::nullopt, [&removed](const SEdge_t & edge) -> void { removed.emplace_back(edge); });
+
+    for (size_t i = in_c; i < removed.size(); i++)
+    {
+        m_in_edges.remove(vertex_idx, removed[i].edge_label_id, removed[i].src);
+        m_out_edges.remove(removed[i].src, removed[i].edge_label_id, vertex_idx);
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelLSMLPG::scan_out_edges(const Id_t src_idx, const std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept
+{
+    m_out_edges.scan(src_idx, edge_label_id, func);
+}
+
+void
+graphquery::database::storage::CMemoryModelLSMLPG::scan_in_edges(const Id_t dst_idx, const std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept
+{
+    m_in_edges.scan(dst_idx, edge_label_id, func);
+}
+
+void
+graphquery::database::storage::CMemoryModelLSMLPG::reset_edges() noexcept
+{
+    m_out_edges.clear();
+    m_in_edges.clear();
+}
+
+void
+graphquery::database::storage::CMemoryModelLSMLPG::flush_edges() noexcept
+{
+    //~ Freeze the memtables, such that reads of the synced graph merge solely immutable runs.
+    m_out_edges.flush();
+    m_in_edges.flush();
+}
+
+bool
+graphquery::database::storage::CMemoryModelLSMLPG::check_if_edge_exists(const Id_t src_idx, const Id_t dst_idx, const uint16_t edge_label_id) noexcept
+{
+    return m_out_edges.contains(src_idx, edge_label_id, dst_idx);
+}
+
+extern "C"
+{
+    LIB_EXPORT void create_graph_model(graphquery::database::storage::ILPGModel ** graph_model, const std::shared_ptr<graphquery::logger::CLogSystem> & log_system, const bool & _sync_state_)
+    {
+        assert(log_system != nullptr);
+        *graph_model = new graphquery::database::storage::CMemoryModelLSMLPG(log_system, _sync_state_);
+    }
+}
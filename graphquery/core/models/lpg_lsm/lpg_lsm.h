@@ -0,0 +1,42 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file lpg_lsm.h
+ * \brief Dervied instance of a memory model, supporting
+ *        the labelled property graph functionality, with the
+ *        adjacency held within log structured merge trees. Edge
+ *        updates are buffered within a sorted memtable and frozen
+ *        into immutable runs, sorted by vertex and label, which are
+ *        compacted in the background. Ingest therefore costs an
+ *        ordered insert into memory, rather than random writes.
+ ************************************************************/
+
+#pragma once
+
+#include "models/lpg_heap/lpg_heap.h"
+#include "lsm_tree.hpp"
+
+namespace graphquery::database::storage
+{
+    class CMemoryModelLSMLPG final : public CMemoryModelHeapLPG
+    {
+      public:
+        explicit CMemoryModelLSMLPG(const std::shared_ptr<logger::CLogSystem> &, const bool & _sync_state_);
+        ~CMemoryModelLSMLPG() override;
+
+      protected:
+        void store_edge(const SEdge_t & edge) noexcept override;
+        void store_edges(const std::vector<SEdge_t> & edges) noexcept override;
+        void rm_edges(Id_t src_idx, Id_t dst_idx, std::optional<uint16_t> edge_label_id, std::vector<SEdge_t> & removed) noexcept override;
+        void rm_vertex_edges(Id_t vertex_idx, std::vector<SEdge_t> & removed) noexcept override;
+        void scan_out_edges(Id_t src_idx, std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept override;
+        void scan_in_edges(Id_t dst_idx, std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept override;
+        void reset_edges() noexcept override;
+        void flush_edges() noexcept override;
+        [[nodiscard]] bool check_if_edge_exists(Id_t src_idx, Id_t dst_idx, uint16_t edge_label_id) noexcept override;
+
+      private:
+        CLsmTree<false> m_out_edges;
+        CLsmTree<true> m_in_edges;
+    };
+} // namespace graphquery::database::storage
@@ -0,0 +1,509 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file lsm_tree.hpp
+ * \brief Log structured merge tree of edges. Updates are buffered
+ *        within a sorted memtable, which once full is frozen into an
+ *        immutable sorted run. Runs of a similar size are merged in
+ *        the background, whilst reads merge the memtable and every
+ *        run, the newest entry of a key taking precedence. Removals
+ *        are written as tombstones, dropped once merged into the
+ *        oldest run. Helper class for lpg lsm memory model.
+ ************************************************************/
+
+#pragma once
+
+#include "db/storage/graph_model.h"
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <tuple>
+#include <vector>
+
+namespace graphquery::database::storage
+{
+    template<bool incoming>
+    class CLsmTree
+    {
+      public:
+        using SEdge_t = ILPGModel::SEdge_t;
+
+        CLsmTree();
+        ~CLsmTree();
+        CLsmTree(const CLsmTree &)                 = delete;
+        CLsmTree(CLsmTree &&) noexcept             = delete;
+        CLsmTree & operator=(const CLsmTree &)     = delete;
+        CLsmTree & operator=(CLsmTree &&) noexcept = delete;
+
+        void clear() noexcept;
+        void insert(const SEdge_t & edge) noexcept;
+        void insert_batch(const std::vector<SEdge_t> & edges) noexcept;
+        void remove(Id_t vertex, uint16_t edge_label_id, Id_t neighbour) noexcept;
+        void flush() noexcept;
+        [[nodiscard]] bool contains(Id_t vertex, uint16_t edge_label_id, Id_t neighbour) const noexcept;
+        void scan(Id_t vertex, std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) const noexcept;
+
+        [[nodiscard]] size_t get_run_count() const noexcept;
+
+      private:
+        using Key_t = std::tuple<Id_t, uint16_t, Id_t>;
+
+        /****************************************************************
+         * \struct SLsmEntry_t
+         * \brief Structure of an entry within the memtable or a run, keyed
+         *        by its vertex, label and neighbour.
+         *
+         * \param vertex Id_t            - vertex owning the entry
+         * \param neighbour Id_t         - vertex on the other end of the edge
+         * \param property_id Id_t       - property set of the edge
+         * \param edge_label_id uint16_t - label id of the edge
+         * \param property_c uint8_t     - amount of properties
+         * \param tombstone bool         - whether the entry removes the edge
+         ***************************************************************/
+        struct SLsmEntry_t
+        {
+            Id_t vertex            = {};
+            Id_t neighbour         = {};
+            Id_t property_id       = {};
+            uint16_t edge_label_id = {};
+            uint8_t property_c     = {};
+            bool tombstone         = {};
+        };
+
+        /****************************************************************
+         * \struct SRun_t
+         * \brief Immutable sorted run of entries, with a bloom filter of
+         *        its keys answering most point lookups without a search.
+         *
+         * \param entries std::vector - entries in key order
+         * \param bloom std::vector   - bits of the bloom filter
+         ***************************************************************/
+        struct SRun_t
+        {
+            std::vector<SLsmEntry_t> entries = {};
+            std::vector<uint64_t> bloom      = {};
+        };
+
+        using Runs_t = std::vector<std::shared_ptr<const SRun_t>>;
+
+        [[nodiscard]] static inline Key_t key(const SLsmEntry_t & entry) noexcept;
+        [[nodiscard]] static inline SLsmEntry_t make_entry(const SEdge_t & edge) noexcept;
+        [[nodiscard]] static inline SEdge_t make_edge(const SLsmEntry_t & entry) noexcept;
+        [[nodiscard]] static inline uint64_t hash(const Key_t & target) noexcept;
+        [[nodiscard]] static bool bloom_contains(const SRun_t & run, const Key_t & target) noexcept;
+        [[nodiscard]] static std::shared_ptr<const SRun_t> make_run(std::vector<SLsmEntry_t> && entries) noexcept;
+        [[nodiscard]] static std::vector<SLsmEntry_t> merge(const Runs_t & runs, bool drop_tombstones) noexcept;
+
+        [[nodiscard]] std::shared_ptr<const Runs_t> load_runs() const noexcept;
+        void put(const SLsmEntry_t & entry) noexcept;
+        void push_run(std::shared_ptr<const SRun_t> run) noexcept;
+        void schedule_compaction() noexcept;
+        void compact(Runs_t runs, bool drop_tombstones) noexcept;
+        void wait_compaction() noexcept;
+
+        //~ Written solely under the graph lock, whilst runs are swapped by the compaction.
+        std::map<Key_t, SLsmEntry_t> m_memtable;
+        std::shared_ptr<const Runs_t> m_runs;
+        mutable std::shared_mutex m_runs_lock;
+        std::future<void> m_compaction;
+
+        static constexpr size_t MEMTABLE_MAX_AMT      = 1 << 16;
+        static constexpr size_t RUN_MAX_AMT           = 4;
+        static constexpr size_t RUN_SIZE_RATIO        = 4; //~ Runs larger than this multiple of the newer runs are left unmerged.
+        static constexpr size_t BLOOM_BITS_PER_ENTRY  = 10;
+        static constexpr uint8_t BLOOM_HASH_AMT       = 3;
+    };
+} // namespace graphquery::database::storage
+
+template<bool incoming>
+graphquery::database::storage::CLsmTree<incoming>::CLsmTree(): m_runs(std::make_shared<const Runs_t>())
+{
+}
+
+template<bool incoming>
+graphquery::database::storage::CLsmTree<incoming>::~CLsmTree()
+{
+    wait_compaction();
+}
+
+template<bool incoming>
+typename graphquery::database::storage::CLsmTree<incoming>::Key_t
+graphquery::database::storage::CLsmTree<incoming>::key(const SLsmEntry_t & entry) noexcept
+{
+    return {entry.vertex, entry.edge_label_id, entry.neighbour};
+}
+
+template<bool incoming>
+typename graphquery::database::storage::CLsmTree<incoming>::SLsmEntry_t
+graphquery::database::storage::CLsmTree<incoming>::make_entry(const SEdge_t & edge) noexcept
+{
+    SLsmEntry_t entry   = {};
+    entry.vertex        = incoming ? edge.dst : edge.src;
+    entry.neighbour     = incoming ? edge.src : edge.dst;
+    entry.property_id   = edge.property_id;
+    entry.edge_label_id = edge.edge_label_id;
+    entry.property_c    = edge.property_c;
+    return entry;
+}
+
+template<bool incoming>
+graphquery::database::storage::ILPGModel::SEdge_t
+graphquery::database::storage::CLsmTree<incoming>::make_edge(const SLsmEntry_t & entry) noexcept
+{
+    SEdge_t edge       = {};
+    edge.src           = incoming ? entry.neighbour : entry.vertex;
+    edge.dst           = incoming ? entry.vertex : entry.neighbour;
+    edge.property_id   = entry.property_id;
+    edge.edge_label_id = entry.edge_label_id;
+    edge.property_c    = entry.property_c;
+    return edge;
+}
+
+template<bool incoming>
+uint64_t
+graphquery::database::storage::CLsmTree<incoming>::hash(const Key_t & target) noexcept
+{
+    //~ Splitmix finaliser over the packed key.
+    uint64_t h = std::get<0>(target) * 0x9E3779B97F4A7C15ULL ^ (std::get<2>(target) + (static_cast<uint64_t>(std::get<1>(target)) << 48));
+    h          = (h ^ (h >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    h          = (h ^ (h >> 27)) * 0x94D049BB133111EBULL;
+    return h ^ (h >> 31);
+}
+
+template<bool incoming>
+bool
+graphquery::database::storage::CLsmTree<incoming>::bloom_contains(const SRun_t & run, const Key_t & target) noexcept
+{
+    const uint64_t h    = hash(target);
+    const uint64_t step = (h >> 32) | 1;
+    const uint64_t bits = run.bloom.size() * 64;
+
+    for (uint8_t i = 0; i < BLOOM_HASH_AMT; i++)
+    {
+        const uint64_t bit = (h + i * step) % bits;
+        if (!(run.bloom[bit / 64] & (1ULL << (bit % 64))))
+            return false;
+    }
+
+    return true;
+}
+
+template<bool incoming>
+std::shared_ptr<const typename graphquery::database::storage::CLsmTree<incoming>::SRun_t>
+graphquery::database::storage::CLsmTree<incoming>::make_run(std::vector<SLsmEntry_t> && entries) noexcept
+{
+    auto run     = std::make_shared<SRun_t>();
+    run->entries = std::move(entries);
+    run->bloom.resize(std::max<size_t>(1, (run->entries.size() * BLOOM_BITS_PER_ENTRY + 63) / 64));
+
+    const uint64_t bits = run->bloom.size() * 64;
+    for (const auto & entry : run->entries)
+    {
+        const uint64_t h    = hash(key(entry));
+        const uint64_t step = (h >> 32) | 1;
+
+        for (uint8_t i = 0; i < BLOOM_HASH_AMT; i++)
+        {
+            const uint64_t bit = (h + i * step) % bits;
+            run->bloom[bit / 64] |= 1ULL << (bit % 64);
+        }
+    }
+
+    return run;
+}
+
+template<bool incoming>
+std::vector<typename graphquery::database::storage::CLsmTree<incoming>::SLsmEntry_t>
+graphquery::database::storage::CLsmTree<incoming>::merge(const Runs_t & runs, const bool drop_tombstones) noexcept
+{
+    //~ Runs are ordered newest first, therefore the first run holding a key supplies its entry.
+    std::vector<size_t> positions(runs.size(), 0);
+    std::vector<SLsmEntry_t> merged = {};
+
+    size_t entry_c = 0;
+    for (const auto & run : runs)
+        entry_c += run->entries.size();
+    merged.reserve(entry_c);
+
+    while (true)
+    {
+        std::optional<size_t> newest = std::nullopt;
+
+        for (size_t i = 0; i < runs.size(); i++)
+        {
+            if (positions[i] == runs[i]->entries.size())
+                continue;
+
+            if (!newest.has_value() || key(runs[i]->entries[positions[i]]) < key(runs[*newest]->entries[positions[*newest]]))
+                newest = i;
+        }
+
+        if (!newest.has_value())
+            break;
+
+        const SLsmEntry_t entry = runs[*newest]->entries[positions[*newest]];
+        const Key_t entry_key   = key(entry);
+
+        for (size_t i = 0; i < runs.size(); i++)
+        {
+            if (positions[i] < runs[i]->entries.size() && key(runs[i]->entries[positions[i]]) == entry_key)
+                positions[i]++;
+        }
+
+        if (!(entry.tombstone && drop_tombstones))
+            merged.emplace_back(entry);
+    }
+
+    return merged;
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CLsmTree<incoming>::clear() noexcept
+{
+    wait_compaction();
+    m_memtable.clear();
+
+    std::unique_lock lock(m_runs_lock);
+    m_runs = std::make_shared<const Runs_t>();
+}
+
+template<bool incoming>
+std::shared_ptr<const typename graphquery::database::storage::CLsmTree<incoming>::Runs_t>
+graphquery::database::storage::CLsmTree<incoming>::load_runs() const noexcept
+{
+    //~ Runs are immutable, therefore readers solely hold the lock whilst taking a reference to the set.
+    std::shared_lock lock(m_runs_lock);
+    return m_runs;
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CLsmTree<incoming>::insert(const SEdge_t & edge) noexcept
+{
+    put(make_entry(edge));
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CLsmTree<incoming>::remove(const Id_t vertex, const uint16_t edge_label_id, const Id_t neighbour) noexcept
+{
+    SLsmEntry_t entry   = {};
+    entry.vertex        = vertex;
+    entry.neighbour     = neighbour;
+    entry.edge_label_id = edge_label_id;
+    entry.tombstone     = true;
+    put(entry);
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CLsmTree<incoming>::put(const SLsmEntry_t & entry) noexcept
+{
+    m_memtable.insert_or_assign(key(entry), entry);
+
+    if (m_memtable.size() >= MEMTABLE_MAX_AMT)
+        flush();
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CLsmTree<incoming>::insert_batch(const std::vector<SEdge_t> & edges) noexcept
+{
+    //~ A batch is sorted into a run of its own, rather than passing through the memtable.
+    flush();
+
+    std::vector<SLsmEntry_t> entries = {};
+    entries.reserve(edges.size());
+
+    for (const auto & edge : edges)
+        entries.emplace_back(make_entry(edge));
+
+    std::ranges::sort(entries, [](const SLsmEntry_t & lhs, const SLsmEntry_t & rhs) -> bool { return key(lhs) < key(rhs); });
+    const auto [first, last] = std::ranges::unique(entries, [](const SLsmEntry_t & lhs, const SLsmEntry_t & rhs) -> bool { return key(lhs) == key(rhs); });
+    entries.erase(first, last);
+
+    if (!entries.empty())
+        push_run(make_run(std::move(entries)));
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CLsmTree<incoming>::flush() noexcept
+{
+    if (m_memtable.empty())
+        return;
+
+    std::vector<SLsmEntry_t> entries = {};
+    entries.reserve(m_memtable.size());
+
+    for (const auto & [entry_key, entry] : m_memtable)
+        entries.emplace_back(entry);
+
+    m_memtable.clear();
+    push_run(make_run(std::move(entries)));
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CLsmTree<incoming>::push_run(std::shared_ptr<const SRun_t> run) noexcept
+{
+    {
+        std::unique_lock lock(m_runs_lock);
+        auto new_runs = std::make_shared<Runs_t>();
+
+        new_runs->reserve(m_runs->size() + 1);
+        new_runs->emplace_back(std::move(run));
+        new_runs->insert(new_runs->end(), m_runs->begin(), m_runs->end());
+        m_runs = std::move(new_runs);
+    }
+
+    schedule_compaction();
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CLsmTree<incoming>::schedule_compaction() noexcept
+{
+    //~ A single compaction is in flight at a time, further runs are picked up by the following flush.
+    if (m_compaction.valid() && m_compaction.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return;
+
+    const auto runs = load_runs();
+    if (runs->size() <= RUN_MAX_AMT)
+        return;
+
+    //~ Merge the newest runs, growing the set whilst the following run is within the size ratio of those merged.
+    size_t merged_c = runs->at(0)->entries.size() + runs->at(1)->entries.size();
+    size_t run_c    = 2;
+
+    while (run_c < runs->size() && runs->at(run_c)->entries.size() <= merged_c * RUN_SIZE_RATIO)
+        merged_c += runs->at(run_c++)->entries.size();
+
+    //~ Tombstones shadow nothing once the oldest run is merged.
+    const bool drop_tombstones = run_c == runs->size();
+    m_compaction               = std::async(std::launch::async, &CLsmTree::compact, this, Runs_t(runs->begin(), runs->begin() + run_c), drop_tombstones);
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CLsmTree<incoming>::compact(Runs_t runs, const bool drop_tombstones) noexcept
+{
+    auto merged = make_run(merge(runs, drop_tombstones));
+
+    std::unique_lock lock(m_runs_lock);
+    auto new_runs = std::make_shared<Runs_t>();
+
+    //~ Runs flushed meanwhile are newer, and remain ahead of the merged set.
+    const auto first = std::ranges::find(*m_runs, runs.front());
+    assert(first != m_runs->end());
+
+    new_runs->insert(new_runs->end(), m_runs->begin(), first);
+    if (!merged->entries.empty())
+        new_runs->emplace_back(std::move(merged));
+    new_runs->insert(new_runs->end(), first + static_cast<int64_t>(runs.size()), m_runs->end());
+    m_runs = std::move(new_runs);
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CLsmTree<incoming>::wait_compaction() noexcept
+{
+    if (m_compaction.valid())
+        m_compaction.wait();
+}
+
+template<bool incoming>
+bool
+graphquery::database::storage::CLsmTree<incoming>::contains(const Id_t vertex, const uint16_t edge_label_id, const Id_t neighbour) const noexcept
+{
+    const Key_t target = {vertex, edge_label_id, neighbour};
+
+    if (const auto it = m_memtable.find(target); it != m_memtable.end())
+        return !it->second.tombstone;
+
+    const auto runs = load_runs();
+    for (const auto & run : *runs)
+    {
+        if (!bloom_contains(*run, target))
+            continue;
+
+        const auto it = std::ranges::lower_bound(run->entries, target, {}, [](const SLsmEntry_t & entry) -> Key_t { return key(entry); });
+        if (it != run->entries.end() && key(*it) == target)
+            return !it->tombstone;
+    }
+
+    return false;
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CLsmTree<incoming>::scan(const Id_t vertex, const std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) const noexcept
+{
+    constexpr Id_t max_neighbour = std::numeric_limits<Id_t>::max();
+    const Key_t lower            = {vertex, edge_label_id.value_or(0), 0};
+    const Key_t upper            = {vertex, edge_label_id.value_or(std::numeric_limits<uint16_t>::max()), max_neighbour};
+    const auto runs   = load_runs();
+    const auto proj   = [](const SLsmEntry_t & entry) -> Key_t { return key(entry); };
+
+    //~ Range of each run holding the vertex, the memtable is treated as the newest source.
+    std::vector<std::pair<const SLsmEntry_t *, const SLsmEntry_t *>> ranges = {};
+    ranges.reserve(runs->size());
+
+    for (const auto & run : *runs)
+    {
+        const auto begin = std::ranges::lower_bound(run->entries, lower, {}, proj);
+        const auto end   = std::ranges::upper_bound(begin, run->entries.end(), upper, {}, proj);
+        if (begin != end)
+            ranges.emplace_back(&*begin, &*begin + (end - begin));
+    }
+
+    auto mem_it        = m_memtable.lower_bound(lower);
+    const auto mem_end = m_memtable.upper_bound(upper);
+
+    while (true)
+    {
+        const SLsmEntry_t * newest = mem_it != mem_end ? &mem_it->second : nullptr;
+
+        for (const auto & [begin, end] : ranges)
+        {
+            if (begin != end && (newest == nullptr || key(*begin) < key(*newest)))
+                newest = begin;
+        }
+
+        if (newest == nullptr)
+            break;
+
+        const SLsmEntry_t entry = *newest;
+        const Key_t entry_key   = key(entry);
+
+        if (mem_it != mem_end && mem_it->first == entry_key)
+            ++mem_it;
+
+        for (auto & [begin, end] : ranges)
+        {
+            if (begin != end && key(*begin) == entry_key)
+                ++begin;
+        }
+
+        if (!entry.tombstone)
+            func(make_edge(entry));
+    }
+}
+
+template<bool incoming>
+size_t
+graphquery::database::storage::CLsmTree<incoming>::get_run_count() const noexcept
+{
+    return load_runs()->size();
+}
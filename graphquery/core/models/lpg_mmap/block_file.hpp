@@ -11,9 +11,15 @@
 #include "../../../external/libcsv-parser/include/internal/common.hpp"
 #include "db/storage/diskdriver/diskdriver.h"
 #include "db/utils/atomic_intrinsics.h"
+#include "db/utils/spinlock.h"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <bitset>
+#include <mutex>
+#include <optional>
 #include <utility>
 
 namespace graphquery::database::storage
@@ -36,8 +42,8 @@ namespace graphquery::database::storage
      * \brief Structure of a data block holding a generic payload,
      *        entry to a datablock file.
      *
-     * \param idx_state uint32_t - index of the data block
-     * \param next uint32_t      - state of the next linked block.
+     * \param idx_state Id_t     - index of the data block
+     * \param next Id_t          - state of the next linked block.
      * \param payload std::array<T, N> - stored payload contained in data block
      ***************************************************************/
     template<typename T, uint8_t N>
@@ -55,8 +61,8 @@ namespace graphquery::database::storage
      * \struct SDataBlock_t
      * \brief Specialization for N = 1.
      *
-     * \param idx_state uint32_t - index of the data block
-     * \param next uint32_t      - state of the next linked block.
+     * \param idx_state Id_t     - index of the data block
+     * \param next Id_t          - state of the next linked block.
      * \param payload T          - stored payload contained in data block
      ***************************************************************/
     template<typename T>
@@ -64,38 +70,64 @@ namespace graphquery::database::storage
     {
         Id_t idx         = END_INDEX;
         Id_t next        = END_INDEX;
-        uint32_t version = END_INDEX;
+        Id_t version     = END_INDEX;
         T payload        = {};
         uint8_t state    = {0};
     };
 
+    /****************************************************************
+     * \brief Slot of the calling thread, handed out in the order threads
+     *        first allocate a data block.
+     ***************************************************************/
+    inline uint32_t
+    get_thread_cache_slot() noexcept
+    {
+        static std::atomic<uint32_t> slot_c = 0;
+        thread_local const uint32_t slot    = slot_c.fetch_add(1, std::memory_order_relaxed);
+        return slot;
+    }
+
     template<typename T, uint8_t N = 1>
         requires(N > 0)
     class CDatablockFile
     {
       public:
+        //~ Runs of contiguous data blocks are sized 2^0 up to 2^(RUN_CLASS_C - 1) blocks.
+        static constexpr uint8_t RUN_CLASS_C = 6;
+        //~ Slots of reserved block ranges, with each range holding BLOCK_CACHE_RANGE blocks.
+        static constexpr uint32_t BLOCK_CACHE_C     = 16;
+        static constexpr Id_t BLOCK_CACHE_RANGE     = 64;
+
         /****************************************************************
          * \struct SBlockFileMetadata_t
          * \brief Describes the metadata for a generic data block file,
          *        holding neccessary information to access the index file
          *        correctly.
          *
-         * \param data_block_c uint32_t       - amount of currently stored data blocks
+         * \param data_block_c Id_t           - high-water mark of the data blocks handed out
+         * \param reserved_block_c Id_t       - end of the data blocks reserved by block caches and runs
          * \param data_blocks_offset uint32_t - start addr of data block entries
          * \param data_block_size uint32_t    - size of one data block
-         * \param free_list uint32_t          - linked list of free data blocks
+         * \param free_list uint64_t          - tagged head of the stack of free data blocks
+         * \param free_runs uint64_t[]        - tagged heads of the stacks of free runs, per power of two size class
          ***************************************************************/
         struct SBlockFileMetadata_t
         {
-            int64_t data_blocks_start_addr = {};
-            int64_t data_block_size        = {};
-            Id_t free_list                 = END_INDEX;
-            Id_t data_block_c              = {};
+            int64_t data_blocks_start_addr  = {};
+            int64_t data_block_size         = {};
+            uint64_t free_list              = {};
+            Id_t data_block_c               = {};
+            Id_t reserved_block_c           = {};
+            uint64_t free_runs[RUN_CLASS_C] = {};
         };
 
         using STypeDataBlock = SDataBlock_t<T, N>;
 
-        ~CDatablockFile() { (void) m_file.close(); }
+        ~CDatablockFile()
+        {
+            release_block_caches();
+            (void) m_file.close();
+        }
         CDatablockFile();
         CDatablockFile(const CDatablockFile &)                 = delete;
         CDatablockFile(CDatablockFile &&) noexcept             = delete;
@@ -103,32 +135,71 @@ namespace graphquery::database::storage
         CDatablockFile & operator=(CDatablockFile &&) noexcept = default;
 
         void reset() noexcept;
+        [[nodiscard]] bool save(const std::filesystem::path & folder_path) noexcept;
+        void restore(const std::filesystem::path & folder_path) noexcept;
         CDiskDriver & get_file() noexcept;
         inline void store_metadata() noexcept;
         inline SRef_t<SBlockFileMetadata_t> read_metadata() noexcept;
         void open(std::filesystem::path path, std::string_view file_name, bool create) noexcept;
+        void set_access_hint(CDiskDriver::EAccessHint_t hint, bool huge_pages = false) noexcept;
+        [[nodiscard]] CDiskDriver::SAccessScope_t scoped_scan() noexcept;
 
         template<bool write = false>
         inline SRef_t<SDataBlock_t<T, N>, write> read_entry(int64_t offset) noexcept;
 
-        uint32_t create_entry(uint32_t next_ref = END_INDEX) noexcept;
-        void append_free_data_block(uint32_t block_offset) noexcept;
+        Id_t create_entry(Id_t next_ref = END_INDEX) noexcept;
+        void append_free_data_block(Id_t block_offset) noexcept;
+        void append_free_data_block_run(Id_t block_offset, Id_t block_c) noexcept;
+        [[nodiscard]] Id_t attain_data_block_run(uint8_t run_class) noexcept;
         int64_t foreach_block(const std::function<void(SRef_t<SDataBlock_t<T, N>> &)> &);
         int64_t foreach_block(Id_t start_block, const std::function<void(SRef_t<SDataBlock_t<T, N>> &)> &);
-        [[nodiscard]] SRef_t<SDataBlock_t<T, N>, true> attain_data_block(uint32_t next_ref = END_INDEX) noexcept;
+        [[nodiscard]] SRef_t<SDataBlock_t<T, N>, true> attain_data_block(Id_t next_ref = END_INDEX) noexcept;
+        [[nodiscard]] SRef_t<SDataBlock_t<T, N>, true> attain_new_data_block(Id_t next_ref = END_INDEX) noexcept;
         [[nodiscard]] std::optional<SRef_t<SDataBlock_t<T, N>, true>> attain_free_data_block() noexcept;
+        void release_block_caches() noexcept;
 
       private:
+        /****************************************************************
+         * \struct SBlockCache_t
+         * \brief Range of data block indices reserved by the threads of a
+         *        slot, handed out without touching the file metadata.
+         *
+         * \param lock CSpinlock - guards the range, uncontended unless threads share the slot
+         * \param next Id_t      - next index to hand out
+         * \param end Id_t       - end of the reserved range
+         ***************************************************************/
+        struct alignas(64) SBlockCache_t
+        {
+            CSpinlock lock = {};
+            Id_t next      = {};
+            Id_t end       = {};
+        };
+
+        [[nodiscard]] static inline uint64_t pack_free_head(Id_t block_offset, uint64_t tag) noexcept;
+        [[nodiscard]] static inline Id_t unpack_free_head(uint64_t head) noexcept;
+        [[nodiscard]] Id_t pop_free_stack(volatile uint64_t * head_ptr) noexcept;
+        void push_free_stack(volatile uint64_t * head_ptr, Id_t block_offset) noexcept;
+        void push_free_data_block_run(Id_t block_offset, uint8_t run_class) noexcept;
+        [[nodiscard]] Id_t attain_cached_offset() noexcept;
+        void raise_high_water_mark(Id_t block_end) noexcept;
+
         CDiskDriver m_file;
-        uint8_t gbl_readlock                          = 0;
+        uint8_t gbl_readlock = 0;
+        std::array<SBlockCache_t, BLOCK_CACHE_C> m_block_caches;
+
         static constexpr uint32_t METADATA_START_ADDR = 0x00000000;
+        //~ Free heads pack the block index below a tag, bumped on every update so that a stale head fails its swap.
+        static constexpr uint8_t FREE_HEAD_TAG_SHIFT  = sizeof(Id_t) == sizeof(uint64_t) ? 48 : 32;
+        static constexpr uint64_t FREE_HEAD_IDX_MASK  = (static_cast<uint64_t>(1) << FREE_HEAD_TAG_SHIFT) - 1;
     };
 } // namespace graphquery::database::storage
 
 template<typename T, uint8_t N>
     requires(N > 0)
-graphquery::database::storage::CDatablockFile<T, N>::CDatablockFile(): m_file(LPG_MAP_MODE)
+graphquery::database::storage::CDatablockFile<T, N>::CDatablockFile(): m_file(LPG_MAP_MODE, O_RDWR, PROT_READ | PROT_WRITE, CFG_LPG_RESERVED_ADDRESS_SPACE)
 {
+    m_file.set_populate(CFG_LPG_POPULATE_ON_LOAD);
+    m_file.set_reserve_factor(CFG_LPG_RESERVED_ADDRESS_FACTOR);
 }
 
 template<typename T, uint8_t N>
@@ -138,9 +209,69 @@ graphquery::database::storage::CDatablockFile<T, N>::store_metadata() noexcept
 {
     auto metadata                    = read_metadata();
     metadata->data_block_c           = 0;
+    metadata->reserved_block_c       = 0;
     metadata->data_block_size        = sizeof(STypeDataBlock);
     metadata->data_blocks_start_addr = sizeof(SBlockFileMetadata_t);
-    metadata->free_list              = END_INDEX;
+    metadata->free_list              = pack_free_head(END_INDEX, 0);
+    std::fill_n(metadata->free_runs, RUN_CLASS_C, pack_free_head(END_INDEX, 0));
+}
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+uint64_t
+graphquery::database::storage::CDatablockFile<T, N>::pack_free_head(const Id_t block_offset, const uint64_t tag) noexcept
+{
+    const uint64_t idx = block_offset == END_INDEX ? FREE_HEAD_IDX_MASK : static_cast<uint64_t>(block_offset);
+    return tag << FREE_HEAD_TAG_SHIFT | idx;
+}
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+graphquery::database::storage::Id_t
+graphquery::database::storage::CDatablockFile<T, N>::unpack_free_head(const uint64_t head) noexcept
+{
+    const uint64_t idx = head & FREE_HEAD_IDX_MASK;
+    return idx == FREE_HEAD_IDX_MASK ? static_cast<Id_t>(END_INDEX) : static_cast<Id_t>(idx);
+}
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+graphquery::database::storage::Id_t
+graphquery::database::storage::CDatablockFile<T, N>::pop_free_stack(volatile uint64_t * head_ptr) noexcept
+{
+    //~ Treiber stack pop, a failed swap reloads the head into head.
+    uint64_t head = utils::atomic_load(head_ptr);
+
+    while (true)
+    {
+        const Id_t block_offset = unpack_free_head(head);
+        if (block_offset == END_INDEX)
+            return END_INDEX;
+
+        const Id_t next   = utils::atomic_load(&read_entry(block_offset)->next);
+        uint64_t new_head = pack_free_head(next, (head >> FREE_HEAD_TAG_SHIFT) + 1);
+
+        if (utils::atomic_fetch_cas(head_ptr, head, new_head, false))
+            return block_offset;
+    }
+}
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+void
+graphquery::database::storage::CDatablockFile<T, N>::push_free_stack(volatile uint64_t * head_ptr, const Id_t block_offset) noexcept
+{
+    uint64_t head        = utils::atomic_load(head_ptr);
+    auto data_block_ptr  = read_entry(block_offset);
+
+    while (true)
+    {
+        utils::atomic_store(&data_block_ptr->next, unpack_free_head(head));
+        uint64_t new_head = pack_free_head(block_offset, (head >> FREE_HEAD_TAG_SHIFT) + 1);
+
+        if (utils::atomic_fetch_cas(head_ptr, head, new_head, false))
+            return;
+    }
 }
 
 template<typename T, uint8_t N>
@@ -166,7 +297,7 @@ graphquery::database::storage::CDatablockFile<T, N>::read_entry(int64_t offset)
 template<typename T, uint8_t N>
     requires(N > 0)
 graphquery::database::storage::SRef_t<graphquery::database::storage::SDataBlock_t<T, N>, true>
-graphquery::database::storage::CDatablockFile<T, N>::attain_data_block(const uint32_t next_ref) noexcept
+graphquery::database::storage::CDatablockFile<T, N>::attain_data_block(const Id_t next_ref) noexcept
 {
     if (next_ref != END_INDEX)
     {
@@ -177,6 +308,14 @@ graphquery::database::storage::CDatablockFile<T, N>::attain_data_block(const uin
                 return data_block_ptr;
     }
 
+    return attain_new_data_block(next_ref);
+}
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+graphquery::database::storage::SRef_t<graphquery::database::storage::SDataBlock_t<T, N>, true>
+graphquery::database::storage::CDatablockFile<T, N>::attain_new_data_block(const Id_t next_ref) noexcept
+{
     auto head_free_block_opt = attain_free_data_block();
 
     if (!head_free_block_opt.has_value())
@@ -185,7 +324,10 @@ graphquery::database::storage::CDatablockFile<T, N>::attain_data_block(const uin
         return read_entry<true>(entry_offset);
     }
 
-    return std::move(head_free_block_opt.value());
+    //~ Link the reused block to the chain it is prepended to.
+    auto data_block_ptr  = std::move(head_free_block_opt.value());
+    data_block_ptr->next = next_ref;
+    return data_block_ptr;
 }
 
 template<typename T, uint8_t N>
@@ -193,54 +335,200 @@ template<typename T, uint8_t N>
 std::optional<graphquery::database::storage::SRef_t<graphquery::database::storage::SDataBlock_t<T, N>, true>>
 graphquery::database::storage::CDatablockFile<T, N>::attain_free_data_block() noexcept
 {
-    auto metadata   = read_metadata();
-    const auto head = utils::atomic_load(&metadata->free_list);
+    Id_t head = END_INDEX;
+    {
+        auto metadata = read_metadata();
+        head          = pop_free_stack(&metadata->free_list);
+    }
 
     if (head == END_INDEX)
         return std::nullopt;
 
-    auto data_block_ptr = read_entry(head);
+    auto data_block_ptr  = read_entry<true>(head);
+    data_block_ptr->next = END_INDEX;
+    return data_block_ptr;
+}
 
-    utils::atomic_store(&metadata->free_list, data_block_ptr->next);
-    utils::atomic_store(&data_block_ptr->next, static_cast<uint32_t>(END_INDEX));
+template<typename T, uint8_t N>
+    requires(N > 0)
+void
+graphquery::database::storage::CDatablockFile<T, N>::append_free_data_block(Id_t block_offset) noexcept
+{
+    {
+        SRef_t<STypeDataBlock> data_block_ptr = read_entry(block_offset);
+        data_block_ptr->idx                   = block_offset;
+        data_block_ptr->state                 = {};
+        data_block_ptr->payload               = {};
 
-    metadata.~SRef_t();
-    data_block_ptr.~SRef_t();
+        if constexpr (N > 1)
+            data_block_ptr->payload_amt = 0;
+    }
 
-    return std::move(read_entry<true>(head));
+    //~ The block is cleared before it is published at the head of the stack.
+    auto metadata = read_metadata();
+    push_free_stack(&metadata->free_list, block_offset);
+}
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+graphquery::database::storage::Id_t
+graphquery::database::storage::CDatablockFile<T, N>::attain_data_block_run(const uint8_t run_class) noexcept
+{
+    const Id_t block_c = static_cast<Id_t>(1) << run_class;
+    Id_t block_offset  = END_INDEX;
+    uint8_t c          = run_class;
+
+    //~ Take the smallest free run that fits, splitting off the upper halves of larger ones.
+    {
+        auto metadata = read_metadata();
+
+        for (; c < RUN_CLASS_C && block_offset == END_INDEX; c++)
+            block_offset = pop_free_stack(&metadata->free_runs[c]);
+    }
+
+    if (block_offset != END_INDEX)
+    {
+        for (c--; c > run_class; c--)
+            push_free_data_block_run(block_offset + (static_cast<Id_t>(1) << (c - 1)), c - 1);
+    }
+    else
+    {
+        block_offset = utils::atomic_fetch_add(&read_metadata()->reserved_block_c, block_c);
+        //~ Grow the file once for the whole run, rather than per block.
+        (void) read_entry<true>(block_offset + block_c - 1);
+    }
+
+    for (Id_t i = block_offset; i < block_offset + block_c; i++)
+    {
+        auto data_block_ptr   = read_entry<true>(i);
+        data_block_ptr->idx   = i;
+        data_block_ptr->state = {};
+        data_block_ptr->next  = END_INDEX;
+
+        if constexpr (N > 1)
+            data_block_ptr->payload_amt = 0;
+    }
+
+    raise_high_water_mark(block_offset + block_c);
+    return block_offset;
+}
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+void
+graphquery::database::storage::CDatablockFile<T, N>::append_free_data_block_run(const Id_t block_offset, const Id_t block_c) noexcept
+{
+    //~ Break the run down into its power of two parts, with single blocks joining the free list.
+    Id_t curr = block_offset;
+
+    for (uint8_t c = RUN_CLASS_C; c-- > 0;)
+    {
+        const Id_t part_c = static_cast<Id_t>(1) << c;
+
+        for (; curr + part_c <= block_offset + block_c; curr += part_c)
+        {
+            if (c == 0)
+                append_free_data_block(curr);
+            else
+                push_free_data_block_run(curr, c);
+        }
+    }
+}
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+void
+graphquery::database::storage::CDatablockFile<T, N>::push_free_data_block_run(const Id_t block_offset, const uint8_t run_class) noexcept
+{
+    {
+        SRef_t<STypeDataBlock> data_block_ptr = read_entry(block_offset);
+        data_block_ptr->idx                   = block_offset;
+        data_block_ptr->state                 = {};
+    }
+
+    auto metadata = read_metadata();
+    push_free_stack(&metadata->free_runs[run_class], block_offset);
+}
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+graphquery::database::storage::Id_t
+graphquery::database::storage::CDatablockFile<T, N>::attain_cached_offset() noexcept
+{
+    auto & cache = m_block_caches[get_thread_cache_slot() % BLOCK_CACHE_C];
+    std::lock_guard lock(cache.lock);
+
+    //~ Reserve a fresh range once the slot runs dry, growing the file once for the whole of it.
+    if (cache.next == cache.end)
+    {
+        cache.next = utils::atomic_fetch_add(&read_metadata()->reserved_block_c, BLOCK_CACHE_RANGE);
+        cache.end  = cache.next + BLOCK_CACHE_RANGE;
+        (void) read_entry<true>(cache.end - 1);
+    }
+
+    return cache.next++;
+}
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+void
+graphquery::database::storage::CDatablockFile<T, N>::raise_high_water_mark(const Id_t block_end) noexcept
+{
+    //~ Scans stop at the high-water mark, therefore it only covers blocks handed out, not those merely reserved.
+    auto metadata = read_metadata();
+    Id_t curr     = utils::atomic_load(&metadata->data_block_c);
+
+    while (curr < block_end)
+    {
+        Id_t new_end = block_end;
+        if (utils::atomic_fetch_cas(&metadata->data_block_c, curr, new_end, false))
+            return;
+    }
 }
 
 template<typename T, uint8_t N>
     requires(N > 0)
 void
-graphquery::database::storage::CDatablockFile<T, N>::append_free_data_block(uint32_t block_offset) noexcept
+graphquery::database::storage::CDatablockFile<T, N>::release_block_caches() noexcept
 {
-    auto metadata   = read_metadata();
-    const auto head = utils::atomic_load(&metadata->free_list);
-    utils::atomic_store(&metadata->free_list, block_offset);
-    metadata.~SRef_t();
-
-    SRef_t<STypeDataBlock> data_block_ptr = read_entry(block_offset);
-    data_block_ptr->idx                   = block_offset;
-    data_block_ptr->state                 = {};
-    data_block_ptr->next                  = head;
-    data_block_ptr->payload               = {};
-
-    if constexpr (N > 1)
-        data_block_ptr->payload_amt = 0;
+    //~ Blocks reserved but not handed out below the high-water mark are returned to the free list rather than
+    //~ left as holes, pushed in reverse such that they are handed out again in order. Those above it are given
+    //~ back to the reserved range, which ends at the high-water mark once every slot is released.
+    if (!m_file.check_if_initialised())
+        return;
+
+    const Id_t block_c = utils::atomic_load(&read_metadata()->data_block_c);
+
+    for (auto & cache : m_block_caches)
+    {
+        std::lock_guard lock(cache.lock);
+
+        while (cache.end != cache.next)
+            if (--cache.end < block_c)
+                append_free_data_block(cache.end);
+
+        cache.next = 0;
+        cache.end  = 0;
+    }
+
+    utils::atomic_store(&read_metadata()->reserved_block_c, block_c);
 }
 
 template<typename T, uint8_t N>
     requires(N > 0)
-uint32_t
-graphquery::database::storage::CDatablockFile<T, N>::create_entry(uint32_t next_ref) noexcept
+graphquery::database::storage::Id_t
+graphquery::database::storage::CDatablockFile<T, N>::create_entry(Id_t next_ref) noexcept
 {
-    const uint32_t entry_offset = utils::atomic_fetch_inc(&read_metadata()->data_block_c);
-    auto data_block_ptr         = read_entry<true>(entry_offset);
+    const Id_t entry_offset = attain_cached_offset();
+
+    {
+        auto data_block_ptr   = read_entry<true>(entry_offset);
+        data_block_ptr->idx   = entry_offset;
+        data_block_ptr->state = {};
+        data_block_ptr->next  = next_ref;
+    }
 
-    data_block_ptr->idx     = entry_offset;
-    data_block_ptr->state   = {};
-    data_block_ptr->next    = next_ref;
+    raise_high_water_mark(entry_offset + 1);
 
     return entry_offset;
 }
@@ -259,11 +547,11 @@ graphquery::database::storage::CDatablockFile<T, N>::foreach_block(const Id_t st
     while (block_next != END_INDEX)
     {
         auto block_ptr = read_entry(block_next);
+        block_next     = block_ptr->next;
 
         if (unlikely(!block_ptr->state.any()))
             continue;
 
-        block_next = block_ptr->next;
         apply(block_ptr);
         c++;
     }
@@ -275,11 +563,11 @@ template<typename T, uint8_t N>
 int64_t
 graphquery::database::storage::CDatablockFile<T, N>::foreach_block(const std::function<void(SRef_t<SDataBlock_t<T, N>> &)> & apply)
 {
-    int64_t c                  = 0;
-    const uint32_t datablock_c = read_metadata()->data_block_c;
-    auto block_ptr             = read_entry(0);
+    int64_t c              = 0;
+    const Id_t datablock_c = read_metadata()->data_block_c;
+    auto block_ptr         = read_entry(0);
 
-    for (uint32_t i = 0; i < datablock_c; i++, ++block_ptr)
+    for (Id_t i = 0; i < datablock_c; i++, ++block_ptr)
     {
         if (unlikely(block_ptr->state.any()))
             continue;
@@ -302,6 +590,24 @@ graphquery::database::storage::CDatablockFile<T, N>::open(std::filesystem::path
     m_file.open(file_name);
 }
 
+template<typename T, uint8_t N>
+    requires(N > 0)
+void
+graphquery::database::storage::CDatablockFile<T, N>::set_access_hint(const CDiskDriver::EAccessHint_t hint, const bool huge_pages) noexcept
+{
+    //~ Huge page alignment is decided when the file is mapped, therefore set prior to opening.
+    m_file.set_huge_pages(huge_pages);
+    m_file.set_access_hint(hint);
+}
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+graphquery::database::storage::CDiskDriver::SAccessScope_t
+graphquery::database::storage::CDatablockFile<T, N>::scoped_scan() noexcept
+{
+    return m_file.scoped_access(CDiskDriver::EAccessHint_t::sequential);
+}
+
 template<typename T, uint8_t N>
     requires(N > 0)
 graphquery::database::storage::CDiskDriver &
@@ -315,8 +621,42 @@ template<typename T, uint8_t N>
 void
 graphquery::database::storage::CDatablockFile<T, N>::reset() noexcept
 {
+    //~ Reserved ranges refer to the cleared contents, therefore are dropped rather than released.
+    for (auto & cache : m_block_caches)
+    {
+        std::lock_guard lock(cache.lock);
+        cache.next = 0;
+        cache.end  = 0;
+    }
+
     m_file.resize_override(CDiskDriver::DEFAULT_FILE_SIZE);
     m_file.clear_contents();
     store_metadata();
     (void) m_file.sync();
 }
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+bool
+graphquery::database::storage::CDatablockFile<T, N>::save(const std::filesystem::path & folder_path) noexcept
+{
+    //~ Reserved ranges are returned to the free list, such that the saved file accounts for every block.
+    release_block_caches();
+    return m_file.save_to(folder_path) == CDiskDriver::SRet_t::VALID;
+}
+
+template<typename T, uint8_t N>
+    requires(N > 0)
+void
+graphquery::database::storage::CDatablockFile<T, N>::restore(const std::filesystem::path & folder_path) noexcept
+{
+    //~ Reserved ranges refer to the replaced contents, therefore are dropped rather than released.
+    for (auto & cache : m_block_caches)
+    {
+        std::lock_guard lock(cache.lock);
+        cache.next = 0;
+        cache.end  = 0;
+    }
+
+    (void) m_file.restore_from(folder_path);
+}
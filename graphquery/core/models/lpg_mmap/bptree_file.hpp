@@ -0,0 +1,379 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file bptree_file.hpp
+ * \brief B+-tree of integer keys paired with their payload
+ *        offset, persisted within a memory mapped file, such
+ *        that the offsets of a key range are read in order from
+ *        the linked leaves. Helper class for lpg mmap memory model.
+ ************************************************************/
+
+#pragma once
+
+#include "db/storage/diskdriver/diskdriver.h"
+#include "db/utils/atomic_intrinsics.h"
+#include "db/storage/graph_model.h"
+#include "block_file.hpp"
+
+#include <algorithm>
+#include <array>
+#include <compare>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+
+#define BPTREE_NODE_ORDER 64 // ~ Maximum amount of keys of a B+-tree node.
+
+namespace graphquery::database::storage
+{
+    class CBPTreeFile
+    {
+      public:
+        /****************************************************************
+         * \struct SBPTreeKey_t
+         * \brief Key of the tree, the offset is part of the key such that
+         *        equal values of several payloads remain distinct.
+         *
+         * \param value int64_t - ordered value of the key
+         * \param offset Id_t   - respective offset for the payload
+         ***************************************************************/
+        struct SBPTreeKey_t
+        {
+            int64_t value = {};
+            Id_t offset   = {};
+
+            auto operator<=>(const SBPTreeKey_t &) const = default;
+        };
+
+        /****************************************************************
+         * \struct SBPTreeNode_t
+         * \brief Structure of a node of the tree, holding a slot beyond
+         *        the order such that a node overflows prior to its split.
+         *
+         * \param keys SBPTreeKey_t[]   - ordered keys of the node
+         * \param children Id_t[]       - child nodes of an inner node
+         * \param next Id_t             - following leaf of a leaf node
+         * \param key_c uint16_t        - amount of keys held
+         * \param leaf uint8_t          - whether the node is a leaf
+         ***************************************************************/
+        struct SBPTreeNode_t
+        {
+            std::array<SBPTreeKey_t, BPTREE_NODE_ORDER + 1> keys = {};
+            std::array<Id_t, BPTREE_NODE_ORDER + 2> children     = {};
+            Id_t next                                            = END_INDEX;
+            uint16_t key_c                                       = {};
+            uint8_t leaf                                         = {};
+        };
+
+        /****************************************************************
+         * \struct SBPTreeMetadata_t
+         * \brief Describes the metadata for the tree, holding neccessary
+         *        information to access the nodes correctly.
+         *
+         * \param nodes_start_addr int64_t - start addr of the first node
+         * \param entry_c int64_t          - amount of keys stored
+         * \param root Id_t                - offset of the root node
+         * \param node_c Id_t              - amount of nodes allocated
+         * \param height uint32_t          - amount of levels of the tree
+         ***************************************************************/
+        struct SBPTreeMetadata_t
+        {
+            int64_t nodes_start_addr = {};
+            int64_t entry_c          = {};
+            Id_t root                = END_INDEX;
+            Id_t node_c              = {};
+            uint32_t height          = {};
+        };
+
+        ~CBPTreeFile();
+        CBPTreeFile();
+        CBPTreeFile(const CBPTreeFile &)                 = delete;
+        CBPTreeFile(CBPTreeFile &&) noexcept             = delete;
+        CBPTreeFile & operator=(const CBPTreeFile &)     = delete;
+        CBPTreeFile & operator=(CBPTreeFile &&) noexcept = delete;
+
+        void reset() noexcept;
+        [[nodiscard]] bool save(const std::filesystem::path & folder_path) noexcept;
+        void restore(const std::filesystem::path & folder_path) noexcept;
+        inline void store_metadata() noexcept;
+        void open(std::filesystem::path path, std::string_view file_name, bool create) noexcept;
+        void insert(int64_t value, Id_t offset) noexcept;
+        bool remove(int64_t value, Id_t offset) noexcept;
+        [[nodiscard]] int64_t size() noexcept;
+
+        template<typename Func>
+        void range(int64_t lower, int64_t upper, Func && func) noexcept;
+
+        template<bool write = false>
+        inline SRef_t<SBPTreeMetadata_t, write> read_metadata() noexcept;
+
+      private:
+        [[nodiscard]] static inline Id_t allocate_node(SBPTreeMetadata_t * metadata, SBPTreeNode_t * nodes, bool leaf) noexcept;
+        [[nodiscard]] static inline SBPTreeKey_t split_node(SBPTreeNode_t & node, SBPTreeNode_t & sibling, Id_t sibling_offset) noexcept;
+        [[nodiscard]] static inline Id_t find_leaf(const SBPTreeNode_t * nodes, Id_t root, const SBPTreeKey_t & key, Id_t * path, uint32_t & depth) noexcept;
+
+        CDiskDriver m_file;
+        //~ Writers restructure several nodes at once, therefore the tree is guarded as a whole.
+        std::shared_mutex m_lock;
+
+        static constexpr uint32_t MAX_HEIGHT         = 32;
+        static constexpr int64_t METADATA_START_ADDR = 0x00000000;
+        static constexpr int64_t NODES_START_ADDR    = 0x00000040;
+    };
+} // namespace graphquery::database::storage
+
+inline graphquery::database::storage::CBPTreeFile::CBPTreeFile(): m_file(LPG_MAP_MODE)
+{
+}
+
+inline graphquery::database::storage::CBPTreeFile::~CBPTreeFile()
+{
+    (void) m_file.close();
+}
+
+inline void
+graphquery::database::storage::CBPTreeFile::store_metadata() noexcept
+{
+    auto metadata              = read_metadata();
+    metadata->nodes_start_addr = NODES_START_ADDR;
+    metadata->entry_c          = 0;
+    metadata->root             = END_INDEX;
+    metadata->node_c           = 0;
+    metadata->height           = 0;
+}
+
+template<bool write>
+inline graphquery::database::storage::SRef_t<graphquery::database::storage::CBPTreeFile::SBPTreeMetadata_t, write>
+graphquery::database::storage::CBPTreeFile::read_metadata() noexcept
+{
+    return m_file.ref<SBPTreeMetadata_t, write>(METADATA_START_ADDR);
+}
+
+inline graphquery::database::storage::Id_t
+graphquery::database::storage::CBPTreeFile::allocate_node(SBPTreeMetadata_t * metadata, SBPTreeNode_t * nodes, const bool leaf) noexcept
+{
+    const Id_t offset  = metadata->node_c++;
+    nodes[offset]      = {};
+    nodes[offset].leaf = leaf;
+    return offset;
+}
+
+inline graphquery::database::storage::CBPTreeFile::SBPTreeKey_t
+graphquery::database::storage::CBPTreeFile::split_node(SBPTreeNode_t & node, SBPTreeNode_t & sibling, const Id_t sibling_offset) noexcept
+{
+    const uint16_t mid = node.key_c / 2;
+
+    //~ Leaves copy the separator into the sibling and stay linked, inner nodes move it up to the parent.
+    if (node.leaf)
+    {
+        sibling.key_c = node.key_c - mid;
+        std::copy_n(node.keys.begin() + mid, sibling.key_c, sibling.keys.begin());
+        sibling.next = node.next;
+        node.next    = sibling_offset;
+        node.key_c   = mid;
+        return sibling.keys[0];
+    }
+
+    sibling.key_c = node.key_c - mid - 1;
+    std::copy_n(node.keys.begin() + mid + 1, sibling.key_c, sibling.keys.begin());
+    std::copy_n(node.children.begin() + mid + 1, sibling.key_c + 1, sibling.children.begin());
+    node.key_c = mid;
+    return node.keys[mid];
+}
+
+inline graphquery::database::storage::Id_t
+graphquery::database::storage::CBPTreeFile::find_leaf(const SBPTreeNode_t * nodes, const Id_t root, const SBPTreeKey_t & key, Id_t * path, uint32_t & depth) noexcept
+{
+    Id_t curr = root;
+    depth     = 0;
+
+    while (!nodes[curr].leaf)
+    {
+        //~ Keys equal to a separator reside within the right subtree.
+        const auto & node = nodes[curr];
+        const auto slot   = std::upper_bound(node.keys.begin(), node.keys.begin() + node.key_c, key) - node.keys.begin();
+
+        if (path != nullptr)
+            path[depth] = curr;
+
+        depth++;
+        curr = node.children[slot];
+    }
+
+    return curr;
+}
+
+inline void
+graphquery::database::storage::CBPTreeFile::insert(const int64_t value, const Id_t offset) noexcept
+{
+    std::unique_lock lock(m_lock);
+    const SBPTreeKey_t key = {value, offset};
+
+    //~ A split per level and a new root at most, grow for them before the nodes are referenced.
+    {
+        int64_t required_size = {};
+        {
+            auto metadata = read_metadata();
+            required_size = NODES_START_ADDR + static_cast<int64_t>(sizeof(SBPTreeNode_t) * (metadata->node_c + metadata->height + 2));
+        }
+
+        if (static_cast<int64_t>(m_file.get_filesize()) < required_size)
+            m_file.resize(required_size * 2);
+    }
+
+    auto metadata  = read_metadata();
+    auto nodes_ptr = m_file.ref<SBPTreeNode_t>(NODES_START_ADDR);
+    auto * nodes   = nodes_ptr.ref;
+
+    if (metadata->root == END_INDEX)
+    {
+        metadata->root   = allocate_node(metadata.ref, nodes, true);
+        metadata->height = 1;
+    }
+
+    std::array<Id_t, MAX_HEIGHT> path = {};
+    uint32_t depth                    = 0;
+    Id_t curr                         = find_leaf(nodes, metadata->root, key, path.data(), depth);
+
+    {
+        auto & leaf    = nodes[curr];
+        const auto pos = std::lower_bound(leaf.keys.begin(), leaf.keys.begin() + leaf.key_c, key) - leaf.keys.begin();
+
+        if (pos < leaf.key_c && leaf.keys[pos] == key)
+            return;
+
+        std::copy_backward(leaf.keys.begin() + pos, leaf.keys.begin() + leaf.key_c, leaf.keys.begin() + leaf.key_c + 1);
+        leaf.keys[pos] = key;
+        leaf.key_c++;
+        metadata->entry_c++;
+    }
+
+    //~ Split overflowing nodes towards the root.
+    while (nodes[curr].key_c > BPTREE_NODE_ORDER)
+    {
+        const Id_t sibling_offset    = allocate_node(metadata.ref, nodes, nodes[curr].leaf);
+        const SBPTreeKey_t separator = split_node(nodes[curr], nodes[sibling_offset], sibling_offset);
+
+        if (depth == 0)
+        {
+            const Id_t root_offset         = allocate_node(metadata.ref, nodes, false);
+            nodes[root_offset].keys[0]     = separator;
+            nodes[root_offset].children[0] = curr;
+            nodes[root_offset].children[1] = sibling_offset;
+            nodes[root_offset].key_c       = 1;
+            metadata->root                 = root_offset;
+            metadata->height++;
+            break;
+        }
+
+        auto & parent  = nodes[path[--depth]];
+        const auto pos = std::upper_bound(parent.keys.begin(), parent.keys.begin() + parent.key_c, separator) - parent.keys.begin();
+
+        std::copy_backward(parent.keys.begin() + pos, parent.keys.begin() + parent.key_c, parent.keys.begin() + parent.key_c + 1);
+        std::copy_backward(parent.children.begin() + pos + 1, parent.children.begin() + parent.key_c + 1, parent.children.begin() + parent.key_c + 2);
+        parent.keys[pos]         = separator;
+        parent.children[pos + 1] = sibling_offset;
+        parent.key_c++;
+        curr = path[depth];
+    }
+}
+
+inline bool
+graphquery::database::storage::CBPTreeFile::remove(const int64_t value, const Id_t offset) noexcept
+{
+    std::unique_lock lock(m_lock);
+    const SBPTreeKey_t key = {value, offset};
+
+    auto metadata = read_metadata();
+    if (metadata->root == END_INDEX)
+        return false;
+
+    //~ Leaves are not merged once underfull, an emptied leaf is skipped by range reads.
+    auto nodes_ptr = m_file.ref<SBPTreeNode_t>(NODES_START_ADDR);
+    uint32_t depth = 0;
+    auto & leaf    = nodes_ptr.ref[find_leaf(nodes_ptr.ref, metadata->root, key, nullptr, depth)];
+    const auto pos = std::lower_bound(leaf.keys.begin(), leaf.keys.begin() + leaf.key_c, key) - leaf.keys.begin();
+
+    if (pos == leaf.key_c || leaf.keys[pos] != key)
+        return false;
+
+    std::copy(leaf.keys.begin() + pos + 1, leaf.keys.begin() + leaf.key_c, leaf.keys.begin() + pos);
+    leaf.key_c--;
+    metadata->entry_c--;
+    return true;
+}
+
+template<typename Func>
+void
+graphquery::database::storage::CBPTreeFile::range(const int64_t lower, const int64_t upper, Func && func) noexcept
+{
+    std::shared_lock lock(m_lock);
+
+    auto metadata = read_metadata();
+    if (metadata->root == END_INDEX || lower > upper)
+        return;
+
+    const auto nodes_ptr   = m_file.ref<SBPTreeNode_t>(NODES_START_ADDR);
+    const SBPTreeKey_t key = {lower, 0};
+    uint32_t depth         = 0;
+    Id_t curr              = find_leaf(nodes_ptr.ref, metadata->root, key, nullptr, depth);
+    const auto & first     = nodes_ptr.ref[curr];
+    auto pos               = std::lower_bound(first.keys.begin(), first.keys.begin() + first.key_c, key) - first.keys.begin();
+
+    while (curr != END_INDEX)
+    {
+        const auto & leaf = nodes_ptr.ref[curr];
+
+        for (; pos < leaf.key_c; pos++)
+        {
+            if (leaf.keys[pos].value > upper)
+                return;
+
+            func(leaf.keys[pos].value, leaf.keys[pos].offset);
+        }
+
+        curr = leaf.next;
+        pos  = 0;
+    }
+}
+
+inline int64_t
+graphquery::database::storage::CBPTreeFile::size() noexcept
+{
+    std::shared_lock lock(m_lock);
+    return read_metadata()->entry_c;
+}
+
+inline void
+graphquery::database::storage::CBPTreeFile::open(std::filesystem::path path, const std::string_view file_name, const bool create) noexcept
+{
+    if (create)
+        CDiskDriver::create_file(path, file_name);
+
+    m_file.set_path(std::move(path));
+    m_file.open(file_name);
+}
+
+inline void
+graphquery::database::storage::CBPTreeFile::reset() noexcept
+{
+    std::unique_lock lock(m_lock);
+    m_file.resize_override(CDiskDriver::DEFAULT_FILE_SIZE);
+    m_file.clear_contents();
+    store_metadata();
+    (void) m_file.sync();
+}
+
+inline bool
+graphquery::database::storage::CBPTreeFile::save(const std::filesystem::path & folder_path) noexcept
+{
+    std::shared_lock lock(m_lock);
+    return m_file.save_to(folder_path) == CDiskDriver::SRet_t::VALID;
+}
+
+inline void
+graphquery::database::storage::CBPTreeFile::restore(const std::filesystem::path & folder_path) noexcept
+{
+    std::unique_lock lock(m_lock);
+    (void) m_file.restore_from(folder_path);
+}
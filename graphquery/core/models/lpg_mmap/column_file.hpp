@@ -0,0 +1,295 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file column_file.hpp
+ * \brief Column of a typed property for a vertex label, indexed
+ *        by vertex offset, such that one property is scanned
+ *        sequentially without visiting the property chains. Helper
+ *        class for lpg mmap memory model.
+ ************************************************************/
+
+#pragma once
+
+#include "db/storage/diskdriver/diskdriver.h"
+#include "db/utils/atomic_intrinsics.h"
+#include "db/utils/lib.h"
+#include "db/storage/graph_model.h"
+#include "heap_file.hpp"
+
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace graphquery::database::storage
+{
+    class CColumnFile
+    {
+      public:
+        using EColumnType_t = ILPGModel::EColumnType_t;
+
+        /****************************************************************
+         * \struct SColumnMetadata_t
+         * \brief Describes the metadata for the column, holding neccessary
+         *        information to access the values correctly.
+         *
+         * \param values_start_addr int64_t - start addr of the value of the first vertex offset
+         * \param value_c int64_t           - amount of vertex offsets covered by the column
+         * \param type EColumnType_t        - declared type of the values
+         ***************************************************************/
+        struct SColumnMetadata_t
+        {
+            int64_t values_start_addr = {};
+            int64_t value_c           = {};
+            EColumnType_t type        = {};
+        };
+
+        ~CColumnFile() = default;
+        CColumnFile();
+        CColumnFile(const CColumnFile &)                 = delete;
+        CColumnFile(CColumnFile &&) noexcept             = delete;
+        CColumnFile & operator=(const CColumnFile &)     = delete;
+        CColumnFile & operator=(CColumnFile &&) noexcept = delete;
+
+        void reset() noexcept;
+        [[nodiscard]] bool save(const std::filesystem::path & folder_path) noexcept;
+        void restore(const std::filesystem::path & folder_path) noexcept;
+        inline void store_metadata(EColumnType_t type) noexcept;
+        void open(const std::filesystem::path & path, std::string_view file_name, bool create) noexcept;
+        void store(Id_t vertex_offset, std::optional<int64_t> value) noexcept;
+        [[nodiscard]] std::optional<int64_t> load(Id_t vertex_offset) noexcept;
+        [[nodiscard]] std::optional<int64_t> encode(std::string_view value) noexcept;
+        [[nodiscard]] std::string decode(int64_t value) noexcept;
+        [[nodiscard]] EColumnType_t get_type() noexcept;
+
+        template<typename Func>
+        void scan(Func && func) noexcept;
+
+        template<bool write = false>
+        inline SRef_t<SColumnMetadata_t, write> read_metadata() noexcept;
+
+      private:
+        void define_dictionary() noexcept;
+
+        //~ Values are held as 8 bytes, doubles by their bit pattern and strings by their dictionary addr.
+        CDiskDriver m_values;
+        //~ One byte per vertex offset, marking whether the vertex holds the property.
+        CDiskDriver m_valid;
+        //~ Distinct strings of a string column, their addr within the heap is the encoded value.
+        CHeapFile m_dictionary;
+        std::mutex m_dictionary_lock;
+        std::unordered_map<std::string, int64_t> m_dictionary_map;
+
+        static constexpr int64_t METADATA_START_ADDR = 0x00000000;
+        static constexpr int64_t VALUES_START_ADDR   = 0x00000040; //~ Values start on a cache line for vectorised scans.
+
+        static constexpr const char * VALID_FILE_SUFFIX      = "_valid";
+        static constexpr const char * DICTIONARY_FILE_SUFFIX = "_dict";
+    };
+} // namespace graphquery::database::storage
+
+inline graphquery::database::storage::CColumnFile::CColumnFile(): m_values(LPG_MAP_MODE), m_valid(LPG_MAP_MODE)
+{
+}
+
+inline void
+graphquery::database::storage::CColumnFile::store_metadata(const EColumnType_t type) noexcept
+{
+    auto metadata               = read_metadata();
+    metadata->values_start_addr = VALUES_START_ADDR;
+    metadata->value_c           = 0;
+    metadata->type              = type;
+}
+
+template<bool write>
+inline graphquery::database::storage::SRef_t<graphquery::database::storage::CColumnFile::SColumnMetadata_t, write>
+graphquery::database::storage::CColumnFile::read_metadata() noexcept
+{
+    return m_values.ref<SColumnMetadata_t, write>(METADATA_START_ADDR);
+}
+
+inline void
+graphquery::database::storage::CColumnFile::open(const std::filesystem::path & path, const std::string_view file_name, const bool create) noexcept
+{
+    const std::string valid_file_name = std::string(file_name) + VALID_FILE_SUFFIX;
+
+    if (create)
+    {
+        CDiskDriver::create_file(path, file_name);
+        CDiskDriver::create_file(path, valid_file_name);
+    }
+
+    m_values.set_path(path);
+    m_values.open(file_name);
+    m_valid.set_path(path);
+    m_valid.open(valid_file_name);
+    m_dictionary.open(path, std::string(file_name) + DICTIONARY_FILE_SUFFIX, create);
+
+    if (create)
+        m_dictionary.store_metadata();
+    else
+        define_dictionary();
+}
+
+inline void
+graphquery::database::storage::CColumnFile::reset() noexcept
+{
+    //~ The declared type outlives a reset.
+    const auto type = get_type();
+
+    m_values.resize_override(CDiskDriver::DEFAULT_FILE_SIZE);
+    m_values.clear_contents();
+    store_metadata(type);
+    (void) m_values.sync();
+
+    m_valid.resize_override(CDiskDriver::DEFAULT_FILE_SIZE);
+    m_valid.clear_contents();
+    (void) m_valid.sync();
+
+    m_dictionary.reset();
+    m_dictionary_map.clear();
+}
+
+inline bool
+graphquery::database::storage::CColumnFile::save(const std::filesystem::path & folder_path) noexcept
+{
+    return m_values.save_to(folder_path) == CDiskDriver::SRet_t::VALID && m_valid.save_to(folder_path) == CDiskDriver::SRet_t::VALID && m_dictionary.save(folder_path);
+}
+
+inline void
+graphquery::database::storage::CColumnFile::restore(const std::filesystem::path & folder_path) noexcept
+{
+    (void) m_values.restore_from(folder_path);
+    (void) m_valid.restore_from(folder_path);
+    m_dictionary.restore(folder_path);
+
+    //~ Encoded strings are resolved through the map, therefore it is rebuilt from the restored dictionary.
+    std::lock_guard lock(m_dictionary_lock);
+    define_dictionary();
+}
+
+inline graphquery::database::storage::CColumnFile::EColumnType_t
+graphquery::database::storage::CColumnFile::get_type() noexcept
+{
+    return read_metadata()->type;
+}
+
+inline void
+graphquery::database::storage::CColumnFile::store(const Id_t vertex_offset, const std::optional<int64_t> value) noexcept
+{
+    //~ Both references auto-grow their file, therefore neither is held while taking the metadata below.
+    *m_values.ref<int64_t>(VALUES_START_ADDR + static_cast<int64_t>(sizeof(int64_t) * vertex_offset)).ref = value.value_or(0);
+    utils::atomic_store(m_valid.ref<uint8_t>(vertex_offset).ref, static_cast<uint8_t>(value.has_value()));
+
+    auto metadata      = read_metadata();
+    int64_t value_c    = utils::atomic_load(&metadata->value_c);
+    int64_t expected_c = static_cast<int64_t>(vertex_offset) + 1;
+
+    while (value_c < expected_c && !utils::atomic_fetch_cas(&metadata->value_c, value_c, expected_c, true))
+    {
+    }
+}
+
+inline std::optional<int64_t>
+graphquery::database::storage::CColumnFile::load(const Id_t vertex_offset) noexcept
+{
+    if (static_cast<int64_t>(vertex_offset) >= utils::atomic_load(&read_metadata()->value_c))
+        return std::nullopt;
+
+    if (!utils::atomic_load(m_valid.ref<uint8_t>(vertex_offset).ref))
+        return std::nullopt;
+
+    return *m_values.ref<int64_t>(VALUES_START_ADDR + static_cast<int64_t>(sizeof(int64_t) * vertex_offset)).ref;
+}
+
+template<typename Func>
+void
+graphquery::database::storage::CColumnFile::scan(Func && func) noexcept
+{
+    const auto value_c = utils::atomic_load(&read_metadata()->value_c);
+
+    if (value_c == 0)
+        return;
+
+    //~ Shared references keep both mappings in place for the duration of the scan.
+    auto values_ptr = m_values.ref<int64_t>(VALUES_START_ADDR);
+    auto valid_ptr  = m_valid.ref<uint8_t>(0);
+    func(const_cast<const int64_t *>(values_ptr.ref), const_cast<const uint8_t *>(valid_ptr.ref), value_c);
+}
+
+inline std::optional<int64_t>
+graphquery::database::storage::CColumnFile::encode(const std::string_view value) noexcept
+{
+    int64_t ret = {};
+
+    switch (get_type())
+    {
+    case EColumnType_t::int64:
+        if (const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), ret); ec != std::errc())
+            return std::nullopt;
+        return ret;
+    case EColumnType_t::date: return utils::parse_date(value);
+    case EColumnType_t::float64:
+    {
+        double real = {};
+        if (const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), real); ec != std::errc())
+            return std::nullopt;
+        return std::bit_cast<int64_t>(real);
+    }
+    case EColumnType_t::string:
+    {
+        std::lock_guard lock(m_dictionary_lock);
+        if (const auto it = m_dictionary_map.find(std::string(value)); it != m_dictionary_map.end())
+            return it->second;
+
+        ret = m_dictionary.append(value);
+        m_dictionary_map.emplace(value, ret);
+        return ret;
+    }
+    }
+
+    return std::nullopt;
+}
+
+inline std::string
+graphquery::database::storage::CColumnFile::decode(const int64_t value) noexcept
+{
+    switch (get_type())
+    {
+    case EColumnType_t::int64:
+    case EColumnType_t::date: return std::to_string(value);
+    case EColumnType_t::float64: return fmt::format("{}", std::bit_cast<double>(value));
+    case EColumnType_t::string: return m_dictionary.read(value);
+    }
+
+    return {};
+}
+
+inline void
+graphquery::database::storage::CColumnFile::define_dictionary() noexcept
+{
+    m_dictionary_map.clear();
+
+    if (get_type() != EColumnType_t::string)
+        return;
+
+    int64_t addr     = {};
+    int64_t eof_addr = {};
+    {
+        auto metadata = m_dictionary.read_metadata();
+        addr          = metadata->heap_start_addr;
+        eof_addr      = utils::atomic_load(&metadata->eof_addr);
+    }
+
+    while (addr < eof_addr)
+    {
+        auto value         = m_dictionary.read(addr);
+        const int64_t size = _align_(static_cast<int64_t>(sizeof(uint32_t) + value.size()));
+        m_dictionary_map.emplace(std::move(value), addr);
+        addr += size;
+    }
+}
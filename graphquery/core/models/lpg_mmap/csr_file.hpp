@@ -0,0 +1,255 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file csr_file.hpp
+ * \brief Compacted CSR/CSC snapshot of the edge chains, stored
+ *        as dense offset and neighbour arrays within its own
+ *        mapped file. Helper class for lpg mmap memory model.
+ ************************************************************/
+
+#pragma once
+
+#include "db/storage/diskdriver/diskdriver.h"
+#include "db/utils/atomic_intrinsics.h"
+
+#include <cstdint>
+
+namespace graphquery::database::storage
+{
+    class CCSRFile
+    {
+      public:
+        /****************************************************************
+         * \struct SCSRMetadata_t
+         * \brief Describes the metadata for the csr snapshot, holding the
+         *        start addresses of each of the dense arrays.
+         *
+         * \param vertex_c int64_t         - amount of vertex offsets covered by the snapshot
+         * \param edge_c int64_t           - amount of edges stored within the snapshot
+         * \param out_offsets_addr int64_t - start addr of the outgoing offsets (vertex_c + 1)
+         * \param out_dst_addr int64_t     - start addr of the outgoing neighbours
+         * \param out_attr_addr int64_t    - start addr of the outgoing edge attributes
+         * \param in_offsets_addr int64_t  - start addr of the incoming offsets (vertex_c + 1)
+         * \param in_src_addr int64_t      - start addr of the incoming neighbours
+         * \param version uint64_t         - edge version of the graph when the snapshot was built
+         * \param built uint8_t            - whether the snapshot has been published
+         ***************************************************************/
+        struct SCSRMetadata_t
+        {
+            int64_t vertex_c         = {};
+            int64_t edge_c           = {};
+            int64_t out_offsets_addr = {};
+            int64_t out_dst_addr     = {};
+            int64_t out_attr_addr    = {};
+            int64_t in_offsets_addr  = {};
+            int64_t in_src_addr      = {};
+            uint64_t version         = {};
+            uint8_t built            = {};
+        };
+
+        /****************************************************************
+         * \struct SCSREdgeAttr_t
+         * \brief Column of the outgoing edge attributes, aligned with
+         *        the outgoing neighbour array.
+         *
+         * \param property_id Id_t      - head of the edge property chain
+         * \param edge_label_id uint16_t - label id of the edge
+         * \param property_c uint8_t     - amount of properties of the edge
+         ***************************************************************/
+        struct SCSREdgeAttr_t
+        {
+            Id_t property_id       = {};
+            uint16_t edge_label_id = {};
+            uint8_t property_c     = {};
+        };
+
+        ~CCSRFile();
+        CCSRFile();
+        CCSRFile(const CCSRFile &)                 = delete;
+        CCSRFile(CCSRFile &&) noexcept             = delete;
+        CCSRFile & operator=(const CCSRFile &)     = delete;
+        CCSRFile & operator=(CCSRFile &&) noexcept = delete;
+
+        void reset() noexcept;
+        [[nodiscard]] bool save(const std::filesystem::path & folder_path) noexcept;
+        void restore(const std::filesystem::path & folder_path) noexcept;
+        CDiskDriver & get_file() noexcept;
+        inline void store_metadata() noexcept;
+        void open(std::filesystem::path path, std::string_view file_name, bool create) noexcept;
+        void allocate(int64_t vertex_c, int64_t edge_c) noexcept;
+        void publish(uint64_t version) noexcept;
+        [[nodiscard]] bool is_valid(uint64_t version) noexcept;
+        [[nodiscard]] uint64_t get_delta(uint64_t version) noexcept;
+
+        template<bool write = false>
+        inline SRef_t<SCSRMetadata_t, write> read_metadata() noexcept;
+
+        inline SRef_t<int64_t> read_out_offsets() noexcept;
+        inline SRef_t<Id_t> read_out_dst() noexcept;
+        inline SRef_t<SCSREdgeAttr_t> read_out_attr() noexcept;
+        inline SRef_t<int64_t> read_in_offsets() noexcept;
+        inline SRef_t<Id_t> read_in_src() noexcept;
+
+      private:
+        static inline int64_t align_addr(int64_t addr) noexcept;
+
+        CDiskDriver m_file;
+        static constexpr int64_t METADATA_START_ADDR = 0x00000000;
+    };
+} // namespace graphquery::database::storage
+
+inline graphquery::database::storage::CCSRFile::CCSRFile(): m_file(LPG_MAP_MODE)
+{
+}
+
+inline
+graphquery::database::storage::CCSRFile::~
+CCSRFile()
+{
+    (void) m_file.close();
+}
+
+inline void
+graphquery::database::storage::CCSRFile::store_metadata() noexcept
+{
+    auto metadata              = read_metadata();
+    metadata->vertex_c         = 0;
+    metadata->edge_c           = 0;
+    metadata->out_offsets_addr = align_addr(sizeof(SCSRMetadata_t));
+    metadata->out_dst_addr     = metadata->out_offsets_addr;
+    metadata->out_attr_addr    = metadata->out_offsets_addr;
+    metadata->in_offsets_addr  = metadata->out_offsets_addr;
+    metadata->in_src_addr      = metadata->out_offsets_addr;
+    metadata->version          = 0;
+    metadata->built            = 0;
+}
+
+inline void
+graphquery::database::storage::CCSRFile::allocate(const int64_t vertex_c, const int64_t edge_c) noexcept
+{
+    const int64_t out_offsets_addr = align_addr(sizeof(SCSRMetadata_t));
+    const int64_t out_dst_addr     = align_addr(out_offsets_addr + (vertex_c + 1) * static_cast<int64_t>(sizeof(int64_t)));
+    const int64_t out_attr_addr    = align_addr(out_dst_addr + edge_c * static_cast<int64_t>(sizeof(Id_t)));
+    const int64_t in_offsets_addr  = align_addr(out_attr_addr + edge_c * static_cast<int64_t>(sizeof(SCSREdgeAttr_t)));
+    const int64_t in_src_addr      = align_addr(in_offsets_addr + (vertex_c + 1) * static_cast<int64_t>(sizeof(int64_t)));
+    const int64_t eof_addr         = in_src_addr + edge_c * static_cast<int64_t>(sizeof(Id_t));
+
+    //~ Size the file before any reference is taken, as a resize requires the writer lock.
+    m_file.resize(eof_addr + 1);
+
+    auto metadata = read_metadata();
+    utils::atomic_store(&metadata->built, static_cast<uint8_t>(0));
+    metadata->vertex_c         = vertex_c;
+    metadata->edge_c           = edge_c;
+    metadata->out_offsets_addr = out_offsets_addr;
+    metadata->out_dst_addr     = out_dst_addr;
+    metadata->out_attr_addr    = out_attr_addr;
+    metadata->in_offsets_addr  = in_offsets_addr;
+    metadata->in_src_addr      = in_src_addr;
+}
+
+inline void
+graphquery::database::storage::CCSRFile::publish(const uint64_t version) noexcept
+{
+    auto metadata = read_metadata();
+    utils::atomic_store(&metadata->version, version);
+    utils::atomic_store(&metadata->built, static_cast<uint8_t>(1));
+}
+
+inline bool
+graphquery::database::storage::CCSRFile::is_valid(const uint64_t version) noexcept
+{
+    auto metadata = read_metadata();
+    return utils::atomic_load(&metadata->built) && utils::atomic_load(&metadata->version) == version;
+}
+
+inline uint64_t
+graphquery::database::storage::CCSRFile::get_delta(const uint64_t version) noexcept
+{
+    auto metadata = read_metadata();
+
+    if (!utils::atomic_load(&metadata->built))
+        return version;
+
+    return version - utils::atomic_load(&metadata->version);
+}
+
+template<bool write>
+inline graphquery::database::storage::SRef_t<graphquery::database::storage::CCSRFile::SCSRMetadata_t, write>
+graphquery::database::storage::CCSRFile::read_metadata() noexcept
+{
+    return m_file.ref<SCSRMetadata_t, write>(METADATA_START_ADDR);
+}
+
+inline graphquery::database::storage::SRef_t<int64_t>
+graphquery::database::storage::CCSRFile::read_out_offsets() noexcept
+{
+    return m_file.ref<int64_t>(utils::atomic_load(&read_metadata()->out_offsets_addr));
+}
+
+inline graphquery::database::storage::SRef_t<graphquery::database::storage::Id_t>
+graphquery::database::storage::CCSRFile::read_out_dst() noexcept
+{
+    return m_file.ref<Id_t>(utils::atomic_load(&read_metadata()->out_dst_addr));
+}
+
+inline graphquery::database::storage::SRef_t<graphquery::database::storage::CCSRFile::SCSREdgeAttr_t>
+graphquery::database::storage::CCSRFile::read_out_attr() noexcept
+{
+    return m_file.ref<SCSREdgeAttr_t>(utils::atomic_load(&read_metadata()->out_attr_addr));
+}
+
+inline graphquery::database::storage::SRef_t<int64_t>
+graphquery::database::storage::CCSRFile::read_in_offsets() noexcept
+{
+    return m_file.ref<int64_t>(utils::atomic_load(&read_metadata()->in_offsets_addr));
+}
+
+inline graphquery::database::storage::SRef_t<graphquery::database::storage::Id_t>
+graphquery::database::storage::CCSRFile::read_in_src() noexcept
+{
+    return m_file.ref<Id_t>(utils::atomic_load(&read_metadata()->in_src_addr));
+}
+
+inline int64_t
+graphquery::database::storage::CCSRFile::align_addr(const int64_t addr) noexcept
+{
+    return (addr + 8 - 1) & ~(8 - 1);
+}
+
+inline void
+graphquery::database::storage::CCSRFile::open(std::filesystem::path path, const std::string_view file_name, const bool create) noexcept
+{
+    if (create)
+        CDiskDriver::create_file(path, file_name);
+
+    m_file.set_path(std::move(path));
+    m_file.open(file_name);
+}
+
+inline graphquery::database::storage::CDiskDriver &
+graphquery::database::storage::CCSRFile::get_file() noexcept
+{
+    return m_file;
+}
+
+inline void
+graphquery::database::storage::CCSRFile::reset() noexcept
+{
+    m_file.resize_override(CDiskDriver::DEFAULT_FILE_SIZE);
+    m_file.clear_contents();
+    store_metadata();
+    (void) m_file.sync();
+}
+
+inline bool
+graphquery::database::storage::CCSRFile::save(const std::filesystem::path & folder_path) noexcept
+{
+    return m_file.save_to(folder_path) == CDiskDriver::SRet_t::VALID;
+}
+
+inline void
+graphquery::database::storage::CCSRFile::restore(const std::filesystem::path & folder_path) noexcept
+{
+    (void) m_file.restore_from(folder_path);
+}
@@ -0,0 +1,188 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file group_commit.hpp
+ * \brief Group commit of the transaction log, committing threads
+ *        take a ticket and wait, while a dedicated writer flushes
+ *        every ticket taken meanwhile with a single sync. Helper
+ *        class for lpg mmap memory model.
+ ************************************************************/
+
+#pragma once
+
+#include "db/storage/diskdriver/diskdriver.h"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+namespace graphquery::database::storage
+{
+    class CGroupCommit
+    {
+      public:
+        CGroupCommit(CDiskDriver & file, std::chrono::microseconds max_delay, uint64_t max_batch) noexcept;
+        ~CGroupCommit();
+        CGroupCommit(const CGroupCommit &)             = delete;
+        CGroupCommit & operator=(const CGroupCommit &) = delete;
+
+        void start() noexcept;
+        void stop() noexcept;
+        [[nodiscard]] bool commit() noexcept;
+        [[nodiscard]] uint64_t get_sync_count() const noexcept;
+        [[nodiscard]] uint64_t get_enqueued_count() const noexcept;
+        [[nodiscard]] uint64_t get_durable_count() const noexcept;
+
+      private:
+        void write_batches(const std::stop_token & stop) noexcept;
+        void sync_batch(uint64_t batch_start) noexcept;
+
+        CDiskDriver & m_file;
+        const std::chrono::microseconds m_max_delay; //~ Longest a batch is held open for further commits.
+        const uint64_t m_max_batch;                  //~ Commits closing a batch before its delay passes.
+
+        std::atomic<bool> m_running        = {}; //~ Whether commits are handed to the writer.
+        std::atomic<bool> m_writer_idle    = {}; //~ Whether the writer awaits a notification of the next commit.
+        std::atomic<uint64_t> m_enqueued_c = {}; //~ Tickets taken, each commit marks its writes prior to taking one.
+        std::atomic<uint64_t> m_durable_c  = {}; //~ Tickets flushed, waiters below are durable.
+        std::atomic<uint64_t> m_failed_c   = std::numeric_limits<uint64_t>::max(); //~ First ticket of a batch whose sync failed, tickets from it on are not durable.
+        std::atomic<uint64_t> m_sync_c     = {}; //~ Syncs issued, concurrent commits share one.
+        std::mutex m_writer_lock           = {};
+        std::condition_variable_any m_writer_cv;
+        std::jthread m_writer;
+    };
+} // namespace graphquery::database::storage
+
+inline graphquery::database::storage::CGroupCommit::CGroupCommit(CDiskDriver & file, const std::chrono::microseconds max_delay, const uint64_t max_batch) noexcept:
+    m_file(file), m_max_delay(max_delay), m_max_batch(max_batch)
+{
+}
+
+inline graphquery::database::storage::CGroupCommit::~
+CGroupCommit()
+{
+    stop();
+}
+
+inline void
+graphquery::database::storage::CGroupCommit::start() noexcept
+{
+    if (m_running.exchange(true))
+        return;
+
+    m_enqueued_c.store(0);
+    m_durable_c.store(0);
+    m_failed_c.store(std::numeric_limits<uint64_t>::max());
+    m_writer = std::jthread([this](const std::stop_token & stop) -> void { write_batches(stop); });
+}
+
+inline void
+graphquery::database::storage::CGroupCommit::stop() noexcept
+{
+    if (!m_running.exchange(false))
+        return;
+
+    m_writer.request_stop();
+    m_writer.join();
+
+    //~ Commits racing the stop marked their writes beforehand, therefore a last sync releases them.
+    sync_batch(m_durable_c.load() + 1);
+    m_durable_c.store(std::numeric_limits<uint64_t>::max(), std::memory_order_release);
+    m_durable_c.notify_all();
+}
+
+inline void
+graphquery::database::storage::CGroupCommit::sync_batch(const uint64_t batch_start) noexcept
+{
+    m_sync_c.fetch_add(1, std::memory_order_relaxed);
+
+    //~ A failed sync leaves the log on disk unknown, therefore the batch and every later ticket is failed.
+    if (m_file.sync() != CDiskDriver::SRet_t::VALID && batch_start < m_failed_c.load())
+        m_failed_c.store(batch_start);
+}
+
+inline bool
+graphquery::database::storage::CGroupCommit::commit() noexcept
+{
+    if (!m_running.load())
+    {
+        m_sync_c.fetch_add(1, std::memory_order_relaxed);
+        return m_file.sync() == CDiskDriver::SRet_t::VALID;
+    }
+
+    const uint64_t ticket = m_enqueued_c.fetch_add(1) + 1;
+
+    //~ The writer is solely notified when asleep or once the batch fills, such that commits rarely touch the lock.
+    if (m_writer_idle.load() || ticket - m_durable_c.load(std::memory_order_relaxed) >= m_max_batch)
+    {
+        {
+            std::lock_guard lock(m_writer_lock);
+        }
+        m_writer_cv.notify_one();
+    }
+
+    uint64_t durable_c = m_durable_c.load(std::memory_order_acquire);
+    while (durable_c < ticket)
+    {
+        m_durable_c.wait(durable_c, std::memory_order_acquire);
+        durable_c = m_durable_c.load(std::memory_order_acquire);
+    }
+
+    return ticket < m_failed_c.load(std::memory_order_acquire);
+}
+
+inline uint64_t
+graphquery::database::storage::CGroupCommit::get_sync_count() const noexcept
+{
+    return m_sync_c.load(std::memory_order_relaxed);
+}
+
+inline uint64_t
+graphquery::database::storage::CGroupCommit::get_enqueued_count() const noexcept
+{
+    return m_enqueued_c.load();
+}
+
+inline uint64_t
+graphquery::database::storage::CGroupCommit::get_durable_count() const noexcept
+{
+    return m_durable_c.load(std::memory_order_acquire);
+}
+
+inline void
+graphquery::database::storage::CGroupCommit::write_batches(const std::stop_token & stop) noexcept
+{
+    std::unique_lock lock(m_writer_lock);
+
+    while (!stop.stop_requested())
+    {
+        const uint64_t durable_c = m_durable_c.load(std::memory_order_relaxed);
+
+        //~ Declared idle prior to checking, pairing with commits that take a ticket prior to checking the writer.
+        m_writer_idle.store(true);
+        if (!m_writer_cv.wait(lock, stop, [this, durable_c]() -> bool { return m_enqueued_c.load() > durable_c; }))
+            break;
+        m_writer_idle.store(false);
+
+        //~ Hold the batch open for further commits, unless it fills beforehand.
+        if (m_max_delay.count() > 0)
+            m_writer_cv.wait_for(lock, stop, m_max_delay, [this, durable_c]() -> bool { return m_enqueued_c.load() - durable_c >= m_max_batch; });
+
+        //~ Every ticket taken so far has marked its writes, therefore a single sync makes all of them durable.
+        const uint64_t batch_end = m_enqueued_c.load();
+        lock.unlock();
+
+        sync_batch(durable_c + 1);
+        m_durable_c.store(batch_end, std::memory_order_release);
+        m_durable_c.notify_all();
+
+        lock.lock();
+    }
+
+    m_writer_idle.store(false);
+}
@@ -0,0 +1,475 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file hash_index_file.hpp
+ * \brief Open addressing hash table mapping sparse external
+ *        identifiers to their payload offset, persisted within
+ *        a memory mapped file. Keys are either unique or may map
+ *        to several offsets. Helper class for lpg mmap memory
+ *        model.
+ ************************************************************/
+
+#pragma once
+
+#include "db/storage/diskdriver/diskdriver.h"
+#include "db/utils/atomic_intrinsics.h"
+#include "db/storage/graph_model.h"
+#include "block_file.hpp"
+
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace graphquery::database::storage
+{
+    class CHashIndexFile
+    {
+      public:
+        /****************************************************************
+         * \enum EHashEntryState_t
+         * \brief Declares the possible states of a hash table slot.
+         *
+         * \param EMPTY     - slot has never been claimed, terminates a probe
+         * \param SET       - slot holds a valid key and offset
+         * \param TOMBSTONE - slot held a removed key, probing continues
+         * \param BUSY      - slot is claimed by a writer storing the entry
+         ***************************************************************/
+        enum EHashEntryState_t : uint8_t
+        {
+            EMPTY     = 0,
+            SET       = 1,
+            TOMBSTONE = 2,
+            BUSY      = 3
+        };
+
+        /****************************************************************
+         * \struct SHashIndexMetadata_t
+         * \brief Describes the metadata for the hash table, holding two
+         *        table descriptors such that a resize is published by
+         *        flipping the active descriptor once the new table is
+         *        persisted.
+         *
+         * \param table_addr int64_t[2]  - start addr of each table
+         * \param capacity uint64_t[2]   - amount of slots of each table (power of two)
+         * \param entry_c uint64_t       - amount of set slots within the active table
+         * \param used_c uint64_t        - amount of set and tombstone slots within the active table
+         * \param active uint8_t         - descriptor of the table currently in use
+         ***************************************************************/
+        struct SHashIndexMetadata_t
+        {
+            int64_t table_addr[2] = {};
+            uint64_t capacity[2]  = {};
+            uint64_t entry_c      = {};
+            uint64_t used_c       = {};
+            uint8_t active        = {};
+        };
+
+        /****************************************************************
+         * \struct SHashEntry_t
+         * \brief Structure of a slot within the hash table.
+         *
+         * \param key uint64_t    - external identifier of the payload
+         * \param offset Id_t     - respective offset for the payload
+         * \param state uint8_t   - EHashEntryState_t of the slot
+         ***************************************************************/
+        struct SHashEntry_t
+        {
+            uint64_t key  = {};
+            Id_t offset   = END_INDEX;
+            uint8_t state = EMPTY;
+        };
+
+        using SHashKeyValue_t = std::pair<uint64_t, Id_t>;
+
+        ~CHashIndexFile();
+        CHashIndexFile();
+        CHashIndexFile(const CHashIndexFile &)                 = delete;
+        CHashIndexFile(CHashIndexFile &&) noexcept             = delete;
+        CHashIndexFile & operator=(const CHashIndexFile &)     = delete;
+        CHashIndexFile & operator=(CHashIndexFile &&) noexcept = delete;
+
+        void reset() noexcept;
+        [[nodiscard]] bool save(const std::filesystem::path & folder_path) noexcept;
+        void restore(const std::filesystem::path & folder_path) noexcept;
+        CDiskDriver & get_file() noexcept;
+        inline void store_metadata() noexcept;
+        void open(std::filesystem::path path, std::string_view file_name, bool create) noexcept;
+        bool store_entry(uint64_t key, Id_t offset) noexcept;
+        bool store_multi_entry(uint64_t key, Id_t offset) noexcept;
+        size_t store_entries(std::span<const SHashKeyValue_t> entries) noexcept;
+        bool remove(uint64_t key, std::optional<Id_t> offset = std::nullopt) noexcept;
+        [[nodiscard]] std::optional<Id_t> lookup(uint64_t key) noexcept;
+        [[nodiscard]] std::vector<Id_t> lookup_all(uint64_t key) noexcept;
+        [[nodiscard]] uint64_t size() noexcept;
+
+        template<bool write = false>
+        inline SRef_t<SHashIndexMetadata_t, write> read_metadata() noexcept;
+
+      private:
+        enum class EInsertState_t : uint8_t
+        {
+            stored,
+            exists,
+            full
+        };
+
+        [[nodiscard]] static inline uint64_t hash(uint64_t key) noexcept;
+        [[nodiscard]] static inline SHashEntry_t * read_table(SHashIndexMetadata_t * metadata) noexcept;
+        [[nodiscard]] static inline EInsertState_t insert(SHashIndexMetadata_t * metadata, uint64_t key, Id_t offset, bool unique = true) noexcept;
+        void reserve(uint64_t entry_c) noexcept;
+
+        CDiskDriver m_file;
+        static constexpr int64_t METADATA_START_ADDR  = 0x00000000;
+        static constexpr int64_t TABLE_ALIGNMENT      = CDiskDriver::PAGE_SIZE;
+        static constexpr uint64_t INITIAL_CAPACITY    = 1 << 10;
+        static constexpr uint64_t LOAD_FACTOR_DIVISOR = 2; // ~ Resize once half of the slots are used.
+    };
+} // namespace graphquery::database::storage
+
+inline graphquery::database::storage::CHashIndexFile::CHashIndexFile(): m_file(LPG_MAP_MODE)
+{
+}
+
+inline graphquery::database::storage::CHashIndexFile::~CHashIndexFile()
+{
+    (void) m_file.close();
+}
+
+inline void
+graphquery::database::storage::CHashIndexFile::store_metadata() noexcept
+{
+    const auto table_addr = static_cast<int64_t>((sizeof(SHashIndexMetadata_t) + TABLE_ALIGNMENT - 1) / TABLE_ALIGNMENT * TABLE_ALIGNMENT);
+    m_file.resize(table_addr + static_cast<int64_t>(INITIAL_CAPACITY * sizeof(SHashEntry_t)));
+
+    auto metadata           = read_metadata();
+    metadata->table_addr[0] = table_addr;
+    metadata->capacity[0]   = INITIAL_CAPACITY;
+    metadata->table_addr[1] = {};
+    metadata->capacity[1]   = {};
+    metadata->entry_c       = 0;
+    metadata->used_c        = 0;
+    metadata->active        = 0;
+}
+
+template<bool write>
+inline graphquery::database::storage::SRef_t<graphquery::database::storage::CHashIndexFile::SHashIndexMetadata_t, write>
+graphquery::database::storage::CHashIndexFile::read_metadata() noexcept
+{
+    return m_file.ref<SHashIndexMetadata_t, write>(METADATA_START_ADDR);
+}
+
+inline uint64_t
+graphquery::database::storage::CHashIndexFile::hash(uint64_t key) noexcept
+{
+    //~ Finaliser of splitmix64, spreading sequential identifiers across the table.
+    key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+    return key ^ (key >> 31);
+}
+
+inline graphquery::database::storage::CHashIndexFile::SHashEntry_t *
+graphquery::database::storage::CHashIndexFile::read_table(SHashIndexMetadata_t * metadata) noexcept
+{
+    //~ Metadata resides at the start of the mapping, therefore the table is addressed relative to it.
+    const auto active = utils::atomic_load(&metadata->active);
+    return reinterpret_cast<SHashEntry_t *>(reinterpret_cast<char *>(metadata) + metadata->table_addr[active]);
+}
+
+inline graphquery::database::storage::CHashIndexFile::EInsertState_t
+graphquery::database::storage::CHashIndexFile::insert(SHashIndexMetadata_t * metadata, const uint64_t key, const Id_t offset, const bool unique) noexcept
+{
+    SHashEntry_t * table    = read_table(metadata);
+    const uint64_t capacity = metadata->capacity[metadata->active];
+    const uint64_t mask     = capacity - 1;
+    uint64_t slot           = hash(key) & mask;
+
+    for (uint64_t i = 0; i < capacity; i++, slot = (slot + 1) & mask)
+    {
+        SHashEntry_t * entry = table + slot;
+        uint8_t state        = utils::atomic_load(&entry->state);
+
+        if (state == EMPTY)
+        {
+            uint8_t expected = EMPTY;
+            uint8_t busy     = BUSY;
+
+            if (utils::atomic_fetch_cas(&entry->state, expected, busy, false))
+            {
+                utils::atomic_store(&entry->key, key);
+                utils::atomic_store(&entry->offset, offset);
+                utils::atomic_store(&entry->state, static_cast<uint8_t>(SET));
+                utils::atomic_fetch_inc(&metadata->entry_c);
+                utils::atomic_fetch_inc(&metadata->used_c);
+                return EInsertState_t::stored;
+            }
+            state = expected;
+        }
+
+        //~ A concurrent writer may be storing the same key, wait for it to publish.
+        while (state == BUSY)
+            state = utils::atomic_load(&entry->state);
+
+        //~ Keys mapping to several offsets solely reject a repeated pair.
+        if (state == SET && utils::atomic_load(&entry->key) == key && (unique || utils::atomic_load(&entry->offset) == offset))
+            return EInsertState_t::exists;
+    }
+
+    return EInsertState_t::full;
+}
+
+inline void
+graphquery::database::storage::CHashIndexFile::reserve(const uint64_t entry_c) noexcept
+{
+    while (true)
+    {
+        uint64_t capacity     = 0;
+        int64_t new_addr      = 0;
+        {
+            auto metadata       = read_metadata();
+            const auto active   = utils::atomic_load(&metadata->active);
+            const auto used_c   = utils::atomic_load(&metadata->used_c);
+            const auto live_c   = utils::atomic_load(&metadata->entry_c);
+            const auto curr_cap = metadata->capacity[active];
+
+            if ((used_c + entry_c) * LOAD_FACTOR_DIVISOR <= curr_cap)
+                return;
+
+            capacity = std::bit_ceil(std::max(INITIAL_CAPACITY, (live_c + entry_c) * LOAD_FACTOR_DIVISOR * 2));
+            new_addr = metadata->table_addr[active] + static_cast<int64_t>(curr_cap * sizeof(SHashEntry_t));
+            new_addr = (new_addr + TABLE_ALIGNMENT - 1) / TABLE_ALIGNMENT * TABLE_ALIGNMENT;
+        }
+
+        //~ Grow the file before the table is locked, as growing requires the file to be unreferenced.
+        const int64_t new_end = new_addr + static_cast<int64_t>(capacity * sizeof(SHashEntry_t));
+        m_file.resize(new_end);
+
+        auto metadata     = read_metadata<true>();
+        const auto active = metadata->active;
+
+        //~ Another writer resized the table meanwhile, therefore re-evaluate against its layout.
+        if (metadata->table_addr[active] + static_cast<int64_t>(metadata->capacity[active] * sizeof(SHashEntry_t)) > new_addr ||
+            static_cast<int64_t>(m_file.get_filesize()) < new_end)
+            continue;
+
+        const SHashEntry_t * old_table = read_table(metadata.ref);
+        const uint64_t old_capacity    = metadata->capacity[active];
+        auto * new_table               = reinterpret_cast<SHashEntry_t *>(reinterpret_cast<char *>(metadata.ref) + new_addr);
+        const uint64_t mask            = capacity - 1;
+        uint64_t entry_count           = 0;
+
+        std::memset(static_cast<void *>(new_table), 0, capacity * sizeof(SHashEntry_t));
+
+        //~ Exclusive access to the file, therefore the rehash requires no atomics and drops tombstones.
+        for (uint64_t i = 0; i < old_capacity; i++)
+        {
+            if (old_table[i].state != SET)
+                continue;
+
+            uint64_t slot = hash(old_table[i].key) & mask;
+            while (new_table[slot].state != EMPTY)
+                slot = (slot + 1) & mask;
+
+            new_table[slot] = old_table[i];
+            entry_count++;
+        }
+
+        //~ Persist the new table and its descriptor prior to publishing, a crash beforehand retains the former table.
+        const uint8_t inactive          = active ^ 1;
+        metadata->table_addr[inactive] = new_addr;
+        metadata->capacity[inactive]   = capacity;
+        (void) m_file.sync();
+
+        metadata->active  = inactive;
+        metadata->entry_c = entry_count;
+        metadata->used_c  = entry_count;
+        (void) m_file.sync();
+        return;
+    }
+}
+
+inline bool
+graphquery::database::storage::CHashIndexFile::store_entry(const uint64_t key, const Id_t offset) noexcept
+{
+    //~ An unopened index holds no table to store into, checked ahead of sizing the table.
+    if (!m_file.check_if_initialised())
+        return false;
+
+    while (true)
+    {
+        reserve(1);
+
+        auto metadata     = read_metadata();
+        const auto result = insert(metadata.ref, key, offset);
+
+        if (result != EInsertState_t::full)
+            return result == EInsertState_t::stored;
+    }
+}
+
+inline bool
+graphquery::database::storage::CHashIndexFile::store_multi_entry(const uint64_t key, const Id_t offset) noexcept
+{
+    while (true)
+    {
+        reserve(1);
+
+        auto metadata     = read_metadata();
+        const auto result = insert(metadata.ref, key, offset, false);
+
+        if (result != EInsertState_t::full)
+            return result == EInsertState_t::stored;
+    }
+}
+
+inline size_t
+graphquery::database::storage::CHashIndexFile::store_entries(const std::span<const SHashKeyValue_t> entries) noexcept
+{
+    //~ Size the table once for the entire batch, such that no resize is triggered whilst inserting.
+    reserve(entries.size());
+
+    size_t stored_c = 0;
+    {
+        auto metadata = read_metadata();
+
+#pragma omp parallel for reduction(+ : stored_c)
+        for (size_t i = 0; i < entries.size(); i++)
+            stored_c += insert(metadata.ref, entries[i].first, entries[i].second) == EInsertState_t::stored;
+    }
+
+    return stored_c;
+}
+
+inline std::optional<graphquery::database::storage::Id_t>
+graphquery::database::storage::CHashIndexFile::lookup(const uint64_t key) noexcept
+{
+    auto metadata              = read_metadata();
+    const SHashEntry_t * table = read_table(metadata.ref);
+    const uint64_t capacity    = metadata->capacity[metadata->active];
+    const uint64_t mask        = capacity - 1;
+    uint64_t slot              = hash(key) & mask;
+
+    for (uint64_t i = 0; i < capacity; i++, slot = (slot + 1) & mask)
+    {
+        uint8_t state = utils::atomic_load(&table[slot].state);
+
+        while (state == BUSY)
+            state = utils::atomic_load(&table[slot].state);
+
+        if (state == EMPTY)
+            break;
+
+        if (state == SET && table[slot].key == key)
+            return table[slot].offset;
+    }
+
+    return std::nullopt;
+}
+
+inline std::vector<graphquery::database::storage::Id_t>
+graphquery::database::storage::CHashIndexFile::lookup_all(const uint64_t key) noexcept
+{
+    std::vector<Id_t> ret      = {};
+    auto metadata              = read_metadata();
+    const SHashEntry_t * table = read_table(metadata.ref);
+    const uint64_t capacity    = metadata->capacity[metadata->active];
+    const uint64_t mask        = capacity - 1;
+    uint64_t slot              = hash(key) & mask;
+
+    for (uint64_t i = 0; i < capacity; i++, slot = (slot + 1) & mask)
+    {
+        uint8_t state = utils::atomic_load(&table[slot].state);
+
+        while (state == BUSY)
+            state = utils::atomic_load(&table[slot].state);
+
+        if (state == EMPTY)
+            break;
+
+        if (state == SET && table[slot].key == key)
+            ret.emplace_back(table[slot].offset);
+    }
+
+    return ret;
+}
+
+inline bool
+graphquery::database::storage::CHashIndexFile::remove(const uint64_t key, const std::optional<Id_t> offset) noexcept
+{
+    auto metadata           = read_metadata();
+    SHashEntry_t * table    = read_table(metadata.ref);
+    const uint64_t capacity = metadata->capacity[metadata->active];
+    const uint64_t mask     = capacity - 1;
+    uint64_t slot           = hash(key) & mask;
+
+    for (uint64_t i = 0; i < capacity; i++, slot = (slot + 1) & mask)
+    {
+        uint8_t state = utils::atomic_load(&table[slot].state);
+
+        while (state == BUSY)
+            state = utils::atomic_load(&table[slot].state);
+
+        if (state == EMPTY)
+            break;
+
+        if (state == SET && table[slot].key == key && (!offset.has_value() || table[slot].offset == *offset))
+        {
+            uint8_t expected  = SET;
+            uint8_t tombstone = TOMBSTONE;
+
+            if (!utils::atomic_fetch_cas(&table[slot].state, expected, tombstone, false))
+                return false;
+
+            utils::atomic_fetch_dec(&metadata->entry_c);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+inline uint64_t
+graphquery::database::storage::CHashIndexFile::size() noexcept
+{
+    return utils::atomic_load(&read_metadata()->entry_c);
+}
+
+inline void
+graphquery::database::storage::CHashIndexFile::open(std::filesystem::path path, const std::string_view file_name, const bool create) noexcept
+{
+    if (create)
+        CDiskDriver::create_file(path, file_name);
+
+    m_file.set_path(std::move(path));
+    m_file.open(file_name);
+}
+
+inline graphquery::database::storage::CDiskDriver &
+graphquery::database::storage::CHashIndexFile::get_file() noexcept
+{
+    return m_file;
+}
+
+inline void
+graphquery::database::storage::CHashIndexFile::reset() noexcept
+{
+    m_file.resize_override(CDiskDriver::DEFAULT_FILE_SIZE);
+    m_file.clear_contents();
+    store_metadata();
+    (void) m_file.sync();
+}
+
+inline bool
+graphquery::database::storage::CHashIndexFile::save(const std::filesystem::path & folder_path) noexcept
+{
+    return m_file.save_to(folder_path) == CDiskDriver::SRet_t::VALID;
+}
+
+inline void
+graphquery::database::storage::CHashIndexFile::restore(const std::filesystem::path & folder_path) noexcept
+{
+    (void) m_file.restore_from(folder_path);
+}
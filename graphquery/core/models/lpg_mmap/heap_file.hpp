@@ -0,0 +1,157 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file heap_file.hpp
+ * \brief Heap file for storing variable length values prefixed
+ *        by their length, appending towards end of file. Helper
+ *        class for lpg mmap memory model.
+ ************************************************************/
+
+#pragma once
+
+#include "db/storage/diskdriver/diskdriver.h"
+#include "db/utils/atomic_intrinsics.h"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+namespace graphquery::database::storage
+{
+    class CHeapFile
+    {
+      public:
+        /****************************************************************
+         * \struct SHeapMetadata_t
+         * \brief Describes the metadata for the heap file, holding neccessary
+         *        information to append and access values correctly.
+         *
+         * \param heap_start_addr int64_t - start addr of the first value
+         * \param eof_addr int64_t        - addr following the last appended value
+         * \param value_c int64_t         - amount of values appended
+         ***************************************************************/
+        struct SHeapMetadata_t
+        {
+            int64_t heap_start_addr = {};
+            int64_t eof_addr        = {};
+            int64_t value_c         = {};
+        };
+
+        ~CHeapFile();
+        CHeapFile();
+        CHeapFile(const CHeapFile &)                 = delete;
+        CHeapFile(CHeapFile &&) noexcept             = delete;
+        CHeapFile & operator=(const CHeapFile &)     = delete;
+        CHeapFile & operator=(CHeapFile &&) noexcept = delete;
+
+        void reset() noexcept;
+        [[nodiscard]] bool save(const std::filesystem::path & folder_path) noexcept;
+        void restore(const std::filesystem::path & folder_path) noexcept;
+        CDiskDriver & get_file() noexcept;
+        inline void store_metadata() noexcept;
+        void open(std::filesystem::path path, std::string_view file_name, bool create) noexcept;
+        [[nodiscard]] int64_t append(std::string_view value) noexcept;
+        [[nodiscard]] std::string read(int64_t addr) noexcept;
+
+        template<bool write = false>
+        inline SRef_t<SHeapMetadata_t, write> read_metadata() noexcept;
+
+      private:
+        CDiskDriver m_file;
+        static constexpr int64_t METADATA_START_ADDR = 0x00000000;
+    };
+} // namespace graphquery::database::storage
+
+inline graphquery::database::storage::CHeapFile::CHeapFile(): m_file(LPG_MAP_MODE)
+{
+}
+
+inline graphquery::database::storage::CHeapFile::~CHeapFile()
+{
+    (void) m_file.close();
+}
+
+inline void
+graphquery::database::storage::CHeapFile::store_metadata() noexcept
+{
+    auto metadata             = read_metadata();
+    metadata->heap_start_addr = sizeof(SHeapMetadata_t);
+    metadata->eof_addr        = sizeof(SHeapMetadata_t);
+    metadata->value_c         = 0;
+}
+
+template<bool write>
+inline graphquery::database::storage::SRef_t<graphquery::database::storage::CHeapFile::SHeapMetadata_t, write>
+graphquery::database::storage::CHeapFile::read_metadata() noexcept
+{
+    return m_file.ref<SHeapMetadata_t, write>(METADATA_START_ADDR);
+}
+
+inline int64_t
+graphquery::database::storage::CHeapFile::append(const std::string_view value) noexcept
+{
+    const auto length  = static_cast<uint32_t>(value.size());
+    const int64_t size = _align_(static_cast<int64_t>(sizeof(uint32_t) + length));
+    int64_t addr       = {};
+    {
+        auto metadata = read_metadata();
+        addr          = utils::atomic_fetch_add(&metadata->eof_addr, size);
+        utils::atomic_fetch_inc(&metadata->value_c);
+    }
+
+    //~ Grow the file beforehand, as the value spans beyond the length prefix the reference covers.
+    if (static_cast<int64_t>(m_file.get_filesize()) <= addr + size)
+        m_file.resize((addr + size) * 2);
+
+    //~ The range is solely owned by this writer once reserved, therefore a shared reference suffices.
+    auto length_ptr = m_file.ref<uint32_t>(addr);
+    *length_ptr.ref = length;
+    std::memcpy(length_ptr.ref + 1, value.data(), length);
+
+    return addr;
+}
+
+inline std::string
+graphquery::database::storage::CHeapFile::read(const int64_t addr) noexcept
+{
+    auto length_ptr = m_file.ref<uint32_t>(addr);
+    return {reinterpret_cast<const char *>(length_ptr.ref + 1), *length_ptr.ref};
+}
+
+inline void
+graphquery::database::storage::CHeapFile::open(std::filesystem::path path, const std::string_view file_name, const bool create) noexcept
+{
+    if (create)
+        CDiskDriver::create_file(path, file_name);
+
+    m_file.set_path(std::move(path));
+    m_file.open(file_name);
+}
+
+inline graphquery::database::storage::CDiskDriver &
+graphquery::database::storage::CHeapFile::get_file() noexcept
+{
+    return m_file;
+}
+
+inline void
+graphquery::database::storage::CHeapFile::reset() noexcept
+{
+    m_file.resize_override(CDiskDriver::DEFAULT_FILE_SIZE);
+    m_file.clear_contents();
+    store_metadata();
+    (void) m_file.sync();
+}
+
+inline bool
+graphquery::database::storage::CHeapFile::save(const std::filesystem::path & folder_path) noexcept
+{
+    return m_file.save_to(folder_path) == CDiskDriver::SRet_t::VALID;
+}
+
+inline void
+graphquery::database::storage::CHeapFile::restore(const std::filesystem::path & folder_path) noexcept
+{
+    (void) m_file.restore_from(folder_path);
+}
@@ -57,6 +57,8 @@ namespace graphquery::database::storage
         CIndexFile & operator=(CIndexFile &&) noexcept = delete;
 
         void reset() noexcept;
+        [[nodiscard]] bool save(const std::filesystem::path & folder_path) noexcept;
+        void restore(const std::filesystem::path & folder_path) noexcept;
         CDiskDriver & get_file() noexcept;
         inline void store_metadata() noexcept;
         void open(std::filesystem::path path, std::string_view file_name, bool create) noexcept;
@@ -152,4 +154,16 @@ graphquery::database::storage::CIndexFile::reset() noexcept
     m_file.clear_contents();
     store_metadata();
     (void) m_file.sync();
+}
+
+inline bool
+graphquery::database::storage::CIndexFile::save(const std::filesystem::path & folder_path) noexcept
+{
+    return m_file.save_to(folder_path) == CDiskDriver::SRet_t::VALID;
+}
+
+inline void
+graphquery::database::storage::CIndexFile::restore(const std::filesystem::path & folder_path) noexcept
+{
+    (void) m_file.restore_from(folder_path);
 }
\ No newline at end of file
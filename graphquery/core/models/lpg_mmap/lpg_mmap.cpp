@@ -2,9 +2,14 @@
 
 #include "db/utils/lib.h"
 
+#include <algorithm>
+#include <array>
 #include <cassert>
+#include <charconv>
 #include <string_view>
 #include <optional>
+#include <set>
+#include <tuple>
 #include <vector>
 
 graphquery::database::storage::CMemoryModelMMAPLPG::CMemoryModelMMAPLPG(const std::shared_ptr<logger::CLogSystem> & log_system, const bool & sync_state_):
@@ -23,8 +28,18 @@ CMemoryModelMMAPLPG()
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::close() noexcept
 {
+    if (!m_loaded)
+        return;
+
     m_transactions->close();
     m_master_file.close();
+    m_loaded = false;
+}
+
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::check_if_loaded() const noexcept
+{
+    return m_loaded;
 }
 
 std::string_view
@@ -42,26 +57,53 @@ graphquery::database::storage::CMemoryModelMMAPLPG::create_rollback(const std::s
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::rollback(const uint8_t rollback_entry) noexcept
 {
-    // ~ Reset graph to initial state.
-    reset_graph();
+    uint64_t rollback_lsn     = 0;
+    std::string rollback_name = {};
+
+    //~ Copied out, such that the log is not referenced whilst replayed.
+    {
+        auto r_ptr    = m_transactions->read_rollback_entry(rollback_entry);
+        rollback_lsn  = r_ptr->eor_lsn;
+        rollback_name = r_ptr->name;
+    }
+
+    //~ The records prior to the last checkpoint are no longer held, therefore a point preceding it cannot be rolled back to.
+    if (rollback_lsn < utils::atomic_load(&read_graph_metadata()->checkpoint_lsn))
+    {
+        m_log_system->warning(fmt::format("Rollback ({}) precedes the last checkpoint", rollback_name));
+        return;
+    }
+
+    // ~ Restore graph to the last checkpoint.
+    const uint64_t checkpoint_lsn = restore_graph();
     // ~ Rollback graph based on the entry index.
-    auto r_ptr              = m_transactions->read_rollback_entry(rollback_entry);
-    const auto rollback_eor = r_ptr->eor_addr;
+    const auto rollback_eor = static_cast<uint64_t>(m_transactions->get_lsn_addr(rollback_lsn));
 
-    m_log_system->info(fmt::format("Starting db rollback ({})", r_ptr->name));
-    const auto & [elapsed] = utils::measure(&CTransaction::rollback, m_transactions, rollback_eor, m_transactions->get_transaction_start_addr());
+    m_log_system->info(fmt::format("Starting db rollback ({})", rollback_name));
+    const auto & [elapsed] = utils::measure(&CTransaction::rollback, m_transactions, rollback_eor, m_transactions->get_lsn_addr(checkpoint_lsn));
     m_log_system->info(fmt::format("Rollback has completed within {}s", elapsed.count()));
 }
 
 void
-graphquery::database::storage::CMemoryModelMMAPLPG::rollback() noexcept
+graphquery::database::storage::CMemoryModelMMAPLPG::undo_transaction(CTransactionUndoLog & undo_log) noexcept
 {
-    // ~ Reset graph to initial state.
-    reset_graph();
-
-    // ~ Rollback graph based on the end valid address.
-    const auto rollback_eor = m_transactions->get_valid_eor_addr();
-    m_transactions->rollback(rollback_eor, m_transactions->get_transaction_start_addr());
+    //~ Solely the changes of the aborted transaction are reverted, the graph is not rebuilt from the log.
+    undo_log.rewind(
+        [this](const SUndoRecord_t & record) -> void
+        {
+            switch (record.action)
+            {
+            case EUndoAction_t::free_vertex_block: m_vertices_file.append_free_data_block(record.offset); break;
+            case EUndoAction_t::restore_vertices_c:
+            {
+                //~ Restored solely whilst no later id was drawn, as lowering the counter past it would hand that id out twice.
+                Id_t expected_c = record.id + 1;
+                Id_t restored_c = record.id;
+                (void) utils::atomic_fetch_cas(&read_graph_metadata()->vertices_c, expected_c, restored_c, false);
+                break;
+            }
+            }
+        });
 }
 
 std::vector<std::string>
@@ -73,17 +115,30 @@ graphquery::database::storage::CMemoryModelMMAPLPG::fetch_rollback_table() const
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::sync_graph() noexcept
 {
+    if (!m_loaded)
+        return;
+
     if (read_graph_metadata()->flush_needed)
     {
+        //~ Pruned whilst no transaction applies, as reverting one restores the edges it found.
         if (read_graph_metadata()->prune_needed)
         {
+            std::unique_lock transaction_lock(m_transaction_lock);
             persist_graph_changes();
             utils::atomic_store(&read_graph_metadata()->prune_needed, false);
         }
 
+        //~ Rebuild the csr snapshot once enough edge mutations have accumulated.
+        if (m_csr_file.get_delta(utils::atomic_load(&read_graph_metadata()->edge_version)) >= CSR_REBUILD_DELTA)
+            build_csr_snapshot();
+
         utils::atomic_store(&read_graph_metadata()->flush_needed, false);
         m_log_system->debug("Graph has been synced");
     }
+
+    //~ Checkpoint once the log outgrows its bound, such that recovery replays solely the records since.
+    if (m_transactions->get_log_size() >= CFG_LPG_CHECKPOINT_LOG_SIZE)
+        (void) checkpoint();
 }
 
 void
@@ -95,6 +150,8 @@ graphquery::database::storage::CMemoryModelMMAPLPG::create_graph(std::filesystem
     //~ Create initial model files
     (void) CDiskDriver::create_file(path, MASTER_FILE_NAME);
 
+    m_master_file.set_path(path);
+    m_master_file.open(MASTER_FILE_NAME);
     setup_files(path, true);
 
     //~ Initialise graph memory.
@@ -104,8 +161,13 @@ graphquery::database::storage::CMemoryModelMMAPLPG::create_graph(std::filesystem
     m_index_file.store_metadata();
     m_vertices_file.store_metadata();
     m_edges_file.store_metadata();
+    m_in_edges_file.store_metadata();
     m_properties_file.store_metadata();
+    m_heap_file.store_metadata();
     m_label_ref_file.store_metadata();
+    m_label_dir_file.store_metadata();
+    m_csr_file.store_metadata();
+    m_loaded = true;
 }
 
 void
@@ -114,49 +176,347 @@ graphquery::database::storage::CMemoryModelMMAPLPG::load_graph(const std::filesy
     this->m_graph_name = graph;
     this->m_graph_path = path;
 
+    m_master_file.set_path(path);
+    m_master_file.open(MASTER_FILE_NAME);
+
+    //~ Graphs created prior to the configurable width hold no size, and were 32-bit. Checked prior to opening the remaining files.
+    const auto id_size = utils::atomic_load(&read_graph_metadata()->id_size);
+    if (unlikely((id_size == 0 ? sizeof(uint32_t) : id_size) != sizeof(Id_t)))
+    {
+        m_log_system->error(fmt::format("Graph ({}) was created with {}-bit ids, although this build uses {}-bit ids", graph, (id_size == 0 ? sizeof(uint32_t) : id_size) * 8, sizeof(Id_t) * 8));
+        (void) m_master_file.close();
+        return;
+    }
+
     setup_files(path, false);
 
     //~ Load graph memory.
     m_transactions->init();
     m_transactions->update_graph_state();
     read_index_list();
+    m_loaded = true;
 }
 
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::reset_graph() noexcept
 {
+    //~ Temporal index, column and property index declarations outlive a reset, their contents are rebuilt during the replay.
+    std::vector<STemporalIndex_t> temporal_indexes(m_temporal_files.size());
+    for (uint8_t i = 0; i < temporal_indexes.size(); i++)
+        temporal_indexes[i] = *read_temporal_index_entry(i);
+
+    std::vector<SPropertyColumn_t> property_columns(m_column_files.size());
+    for (uint8_t i = 0; i < property_columns.size(); i++)
+        property_columns[i] = *read_property_column_entry(i);
+
+    std::vector<SPropertyIndex_t> property_indexes(m_property_index_files.size());
+    for (uint8_t i = 0; i < property_indexes.size(); i++)
+        property_indexes[i] = *read_property_index_entry(i);
+
     // ~ Reset master file
     m_master_file.resize_override(CDiskDriver::DEFAULT_FILE_SIZE);
     m_master_file.clear_contents();
     store_graph_metadata();
 
+    for (uint8_t i = 0; i < temporal_indexes.size(); i++)
+        *read_temporal_index_entry<true>(i).ref = temporal_indexes[i];
+    utils::atomic_store(&read_graph_metadata()->temporal_index_c, static_cast<uint8_t>(temporal_indexes.size()));
+
+    for (uint8_t i = 0; i < property_columns.size(); i++)
+        *read_property_column_entry<true>(i).ref = property_columns[i];
+    utils::atomic_store(&read_graph_metadata()->property_column_c, static_cast<uint8_t>(property_columns.size()));
+
+    for (uint8_t i = 0; i < property_indexes.size(); i++)
+        *read_property_index_entry<true>(i).ref = property_indexes[i];
+    utils::atomic_store(&read_graph_metadata()->property_index_c, static_cast<uint8_t>(property_indexes.size()));
+
     // ~ Reset graph data
     m_vertices_file.reset();
     m_edges_file.reset();
+    m_in_edges_file.reset();
     m_index_file.reset();
     m_properties_file.reset();
+    m_heap_file.reset();
     m_label_ref_file.reset();
+    m_label_dir_file.reset();
+    m_csr_file.reset();
+
+    for (const auto & temporal_file : m_temporal_files)
+        temporal_file->reset();
+
+    for (const auto & column_file : m_column_files)
+        column_file->reset();
+
+    for (const auto & property_index_file : m_property_index_files)
+        property_index_file->reset();
 
     // ~ Reset running in-memory data
     m_label_vertex.clear();
     m_v_label_map.clear();
     m_e_label_map.clear();
+    m_p_key_map.clear();
+}
+
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::checkpoint() noexcept
+{
+    //~ Records are replayed logically rather than idempotently, therefore the image is taken once the running mutations drain.
+    std::unique_lock lock(m_checkpoint_lock);
+
+    const uint64_t checkpoint_id  = utils::atomic_load(&read_graph_metadata()->checkpoint_id) + 1;
+    const uint64_t checkpoint_lsn = m_transactions->get_eof_lsn();
+
+    const std::filesystem::path checkpoint_path = std::filesystem::path(m_graph_path) / fmt::format("{}_{}", CHECKPOINT_NAME, checkpoint_id);
+    const std::filesystem::path staging_path    = checkpoint_path.string() + STAGING_SUFFIX;
+
+    std::error_code ec;
+    std::filesystem::remove_all(staging_path, ec);
+
+    //~ The image is stamped with the checkpoint it holds, whereas the graph is stamped solely once the image is published.
+    if (!std::filesystem::create_directory(staging_path, ec) || !save_model_files(staging_path) || !stamp_checkpoint(staging_path, checkpoint_id, checkpoint_lsn) ||
+        CDiskDriver::sync_folder(staging_path) == CDiskDriver::SRet_t::ERROR)
+    {
+        m_log_system->warning(fmt::format("Checkpoint ({}) could not be taken", checkpoint_id));
+        std::filesystem::remove_all(staging_path, ec);
+        return false;
+    }
+
+    //~ Published by renaming once complete, such that recovery never restores a partial image.
+    std::filesystem::rename(staging_path, checkpoint_path, ec);
+    if (ec || CDiskDriver::sync_folder(m_graph_path) == CDiskDriver::SRet_t::ERROR)
+    {
+        m_log_system->warning(fmt::format("Checkpoint ({}) could not be published", checkpoint_id));
+        return false;
+    }
+
+    utils::atomic_store(&read_graph_metadata()->checkpoint_id, checkpoint_id);
+    utils::atomic_store(&read_graph_metadata()->checkpoint_lsn, checkpoint_lsn);
+    (void) m_master_file.sync();
+    m_transactions->truncate(checkpoint_lsn);
+
+    //~ Prior checkpoints are superseded, as the log no longer holds the records following them.
+    std::vector<std::filesystem::path> superseded = {};
+    for (const auto & entry : std::filesystem::directory_iterator(m_graph_path, ec))
+    {
+        if (entry.path() != checkpoint_path && entry.path().filename().string().starts_with(CHECKPOINT_NAME))
+            superseded.emplace_back(entry.path());
+    }
+
+    for (const auto & path : superseded)
+        std::filesystem::remove_all(path, ec);
+
+    m_log_system->info(fmt::format("Checkpoint ({}) has been taken at lsn ({})", checkpoint_id, checkpoint_lsn));
+    return true;
+}
+
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::stamp_checkpoint(const std::filesystem::path & path, const uint64_t checkpoint_id, const uint64_t checkpoint_lsn) const noexcept
+{
+    CDiskDriver master_image;
+    master_image.set_path(path);
+
+    if (master_image.open(MASTER_FILE_NAME) == CDiskDriver::SRet_t::ERROR)
+        return false;
+
+    {
+        auto metadata = master_image.ref<SGraphMetaData_t, true>(METADATA_START_ADDR);
+        utils::atomic_store(&metadata->checkpoint_id, checkpoint_id);
+        utils::atomic_store(&metadata->checkpoint_lsn, checkpoint_lsn);
+    }
+
+    const bool stamped = master_image.sync() == CDiskDriver::SRet_t::VALID;
+    (void) master_image.close();
+    return stamped;
+}
+
+uint64_t
+graphquery::database::storage::CMemoryModelMMAPLPG::restore_graph() noexcept
+{
+    const auto checkpoint_path = get_checkpoint_path();
+
+    //~ Without a checkpoint, the entire log is replayed onto an empty graph.
+    if (!checkpoint_path.has_value())
+    {
+        reset_graph();
+        return 0;
+    }
+
+    restore_model_files(*checkpoint_path);
+
+    // ~ Rebuild running in-memory data from the restored files
+    m_v_label_map.clear();
+    m_e_label_map.clear();
+    m_p_key_map.clear();
+    read_index_list();
+
+    m_log_system->info(fmt::format("Graph has been restored to {}", checkpoint_path->filename().string()));
+    return utils::atomic_load(&read_graph_metadata()->checkpoint_lsn);
+}
+
+std::optional<std::filesystem::path>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_checkpoint_path() const noexcept
+{
+    std::optional<std::filesystem::path> checkpoint_path = std::nullopt;
+    uint64_t checkpoint_id                               = 0;
+    const std::string prefix                             = fmt::format("{}_", CHECKPOINT_NAME);
+
+    //~ Published checkpoints are named by their id alone, those still staged were interrupted while taken.
+    std::error_code ec;
+    for (const auto & entry : std::filesystem::directory_iterator(m_graph_path, ec))
+    {
+        const std::string name = entry.path().filename().string();
+        uint64_t id            = 0;
+
+        if (!name.starts_with(prefix))
+            continue;
+
+        const char * last = name.data() + name.size();
+        if (const auto [ptr, err] = std::from_chars(name.data() + prefix.size(), last, id); err != std::errc() || ptr != last)
+            continue;
+
+        if (!checkpoint_path.has_value() || id > checkpoint_id)
+        {
+            checkpoint_id   = id;
+            checkpoint_path = entry.path();
+        }
+    }
+
+    return checkpoint_path;
+}
+
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::save_model_files(const std::filesystem::path & path) noexcept
+{
+    bool saved = m_master_file.save_to(path) == CDiskDriver::SRet_t::VALID;
+    saved &= m_index_file.save(path);
+    saved &= m_vertices_file.save(path);
+    saved &= m_edges_file.save(path);
+    saved &= m_in_edges_file.save(path);
+    saved &= m_properties_file.save(path);
+    saved &= m_heap_file.save(path);
+    saved &= m_label_ref_file.save(path);
+    saved &= m_label_dir_file.save(path);
+    saved &= m_csr_file.save(path);
+
+    for (const auto & temporal_file : m_temporal_files)
+        saved &= temporal_file->save(path);
+
+    for (const auto & column_file : m_column_files)
+        saved &= column_file->save(path);
+
+    for (const auto & property_index_file : m_property_index_files)
+        saved &= property_index_file->save(path);
+
+    return saved;
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::restore_model_files(const std::filesystem::path & path) noexcept
+{
+    //~ Declarations checkpoint the graph once taken, therefore the image holds a file for each declared index and column.
+    (void) m_master_file.restore_from(path);
+    m_index_file.restore(path);
+    m_vertices_file.restore(path);
+    m_edges_file.restore(path);
+    m_in_edges_file.restore(path);
+    m_properties_file.restore(path);
+    m_heap_file.restore(path);
+    m_label_ref_file.restore(path);
+    m_label_dir_file.restore(path);
+    m_csr_file.restore(path);
+
+    for (const auto & temporal_file : m_temporal_files)
+        temporal_file->restore(path);
+
+    for (const auto & column_file : m_column_files)
+        column_file->restore(path);
+
+    for (const auto & property_index_file : m_property_index_files)
+        property_index_file->restore(path);
 }
 
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::setup_files(const std::filesystem::path & path, const bool initialise) noexcept
 {
-    //~ Set path for master file and initialise transactions
-    m_master_file.set_path(path);
-    m_master_file.open(MASTER_FILE_NAME);
+    //~ Initialise transactions, the master file is opened beforehand
     m_transactions = std::make_shared<CTransaction>(path, this, m_log_system, _sync_state_);
 
+    //~ Point lookups resolve through the index into the vertices, while the larger vertex and edge files favour huge pages.
+    m_index_file.get_file().set_access_hint(CDiskDriver::EAccessHint_t::random);
+    m_vertices_file.set_access_hint(CDiskDriver::EAccessHint_t::random, CFG_LPG_HUGE_PAGES);
+    m_edges_file.set_access_hint(CDiskDriver::EAccessHint_t::normal, CFG_LPG_HUGE_PAGES);
+    m_in_edges_file.set_access_hint(CDiskDriver::EAccessHint_t::normal, CFG_LPG_HUGE_PAGES);
+
     //~ Open mapping to model files
     m_index_file.open(path, INDEX_FILE_NAME, initialise);
     m_vertices_file.open(path, VERTICES_FILE_NAME, initialise);
     m_edges_file.open(path, EDGES_FILE_NAME, initialise);
+    m_in_edges_file.open(path, IN_EDGES_FILE_NAME, initialise);
     m_properties_file.open(path, PROPERTIES_FILE_NAME, initialise);
+    m_heap_file.open(path, HEAP_FILE_NAME, initialise);
     m_label_ref_file.open(path, LABEL_REF_FILE_NAME, initialise);
+    m_label_dir_file.open(path, LABEL_DIR_FILE_NAME, initialise);
+
+    //~ The csr snapshot is derived data, therefore create it if absent from an older graph.
+    m_csr_file.open(path, CSR_FILE_NAME, initialise || !CDiskDriver::check_if_file_exists(path.string(), CSR_FILE_NAME));
+    setup_temporal_files(path, initialise);
+    setup_column_files(path, initialise);
+    setup_property_index_files(path, initialise);
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::setup_temporal_files(const std::filesystem::path & path, const bool initialise) noexcept
+{
+    m_temporal_files.clear();
+
+    if (initialise)
+        return;
+
+    const auto temporal_index_c = utils::atomic_load(&read_graph_metadata()->temporal_index_c);
+    m_temporal_files.reserve(temporal_index_c);
+
+    for (uint8_t i = 0; i < temporal_index_c; i++)
+    {
+        m_temporal_files.emplace_back(std::make_unique<CTemporalFile>());
+        m_temporal_files.back()->open(path, fmt::format("{}_{}", TEMPORAL_FILE_NAME, i), false);
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::setup_column_files(const std::filesystem::path & path, const bool initialise) noexcept
+{
+    m_column_files.clear();
+
+    if (initialise)
+        return;
+
+    const auto property_column_c = utils::atomic_load(&read_graph_metadata()->property_column_c);
+    m_column_files.reserve(property_column_c);
+
+    for (uint8_t i = 0; i < property_column_c; i++)
+    {
+        m_column_files.emplace_back(std::make_unique<CColumnFile>());
+        m_column_files.back()->open(path, fmt::format("{}_{}", COLUMN_FILE_NAME, i), false);
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::setup_property_index_files(const std::filesystem::path & path, const bool initialise) noexcept
+{
+    m_property_index_files.clear();
+
+    if (initialise)
+        return;
+
+    const auto property_index_c = utils::atomic_load(&read_graph_metadata()->property_index_c);
+    m_property_index_files.reserve(property_index_c);
+
+    for (uint8_t i = 0; i < property_index_c; i++)
+    {
+        const SPropertyIndex_t index = *read_property_index_entry(i);
+        m_property_index_files.emplace_back(std::make_unique<CPropertyIndexFile>());
+        m_property_index_files.back()->open(path, fmt::format("{}_{}", PROPERTY_INDEX_NAME, i), false, index.index_type, index.value_type);
+    }
 }
 
 void
@@ -169,40 +529,52 @@ graphquery::database::storage::CMemoryModelMMAPLPG::store_graph_metadata() noexc
     metadata->edges_c                 = 0;
     metadata->vertex_label_c          = 0;
     metadata->edge_label_c            = 0;
+    metadata->property_key_c          = 0;
     metadata->vertex_label_table_addr = VERTEX_LABELS_START_ADDR;
     metadata->edge_label_table_addr   = EDGE_LABELS_START_ADDR;
     metadata->label_size              = sizeof(SLabel_t);
+    metadata->edge_version            = 0;
+    metadata->checkpoint_id           = 0;
+    metadata->checkpoint_lsn          = 0;
+    metadata->temporal_index_c        = 0;
+    metadata->property_column_c       = 0;
+    metadata->property_index_c        = 0;
     metadata->flush_needed            = false;
     metadata->prune_needed            = false;
+    metadata->id_size                 = sizeof(Id_t);
 }
 
 bool
-graphquery::database::storage::CMemoryModelMMAPLPG::store_vertex_entry(const Id_t id, const std::unordered_set<uint16_t> & label_ids, const std::vector<SProperty_t> & props) noexcept
+graphquery::database::storage::CMemoryModelMMAPLPG::store_vertex_entry(const Id_t id,
+                                                                       const std::unordered_set<uint16_t> & label_ids,
+                                                                       const std::vector<SProperty_t> & props,
+                                                                       CTransactionUndoLog & undo_log) noexcept
 {
-    auto data_block_ptr         = m_vertices_file.attain_data_block();
-    const uint32_t entry_offset = data_block_ptr->idx;
+    auto data_block_ptr     = m_vertices_file.attain_data_block();
+    const Id_t entry_offset = data_block_ptr->idx;
+    undo_log.push({.action = EUndoAction_t::free_vertex_block, .id = id, .offset = entry_offset});
 
+    //~ Storing the index entry is the sole step that can fail, therefore no change past it records an undo.
     if (!store_index_entry(id, label_ids, entry_offset))
-    {
-        m_vertices_file.append_free_data_block(entry_offset);
         return false;
-    }
 
     data_block_ptr->state   = 1 << VERTEX_INITIALISED_STATE_BIT | 1 << VERTEX_VALID_STATE_BIT;
     data_block_ptr->version = END_INDEX;
 
     data_block_ptr->payload.edge_idx              = END_INDEX;
+    data_block_ptr->payload.in_edge_idx           = END_INDEX;
+    data_block_ptr->payload.label_dir_idx         = END_INDEX;
     data_block_ptr->payload.metadata.id           = id;
     data_block_ptr->payload.metadata.outdegree    = 0;
     data_block_ptr->payload.metadata.property_c   = props.size();
     data_block_ptr->payload.metadata.edge_label_c = 0;
 
-    Id_t next_label_ref = END_INDEX;
+    //~ Labels are held within the vertex mask, the label ref chain is only read from older graphs.
+    data_block_ptr->payload.metadata.label_id   = END_INDEX;
+    data_block_ptr->payload.metadata.label_mask = {};
 
     for (const auto label_id : label_ids)
-        next_label_ref = store_label_entry(label_id, next_label_ref);
-
-    data_block_ptr->payload.metadata.label_id = next_label_ref;
+        data_block_ptr->payload.metadata.label_mask.set(label_id);
 
     Id_t next_props_ref = END_INDEX;
 
@@ -211,15 +583,23 @@ graphquery::database::storage::CMemoryModelMMAPLPG::store_vertex_entry(const Id_
 
     data_block_ptr->payload.metadata.property_id = next_props_ref;
 
+    //~ Offsets are reused, therefore every column is written to drop the values of a former vertex.
+    if (!m_column_files.empty())
+        store_column_entries(entry_offset, label_ids, props);
+
+    if (!m_property_index_files.empty())
+        store_property_index_entries(entry_offset, label_ids, props);
+
     return true;
 }
 
 bool
-graphquery::database::storage::CMemoryModelMMAPLPG::store_index_entry(const Id_t id, const std::unordered_set<uint16_t> & label_ids, const uint32_t vertex_offset) noexcept
+graphquery::database::storage::CMemoryModelMMAPLPG::store_index_entry(const Id_t id, const std::unordered_set<uint16_t> & label_ids, const Id_t vertex_offset) noexcept
 {
     if (!m_index_file.store_entry(id, vertex_offset))
         return false;
 
+    std::lock_guard label_vertex_lock(m_label_vertex_lock);
     for (const auto label_id : label_ids)
         m_label_vertex[label_id].emplace_back(vertex_offset);
     return true;
@@ -227,10 +607,15 @@ graphquery::database::storage::CMemoryModelMMAPLPG::store_index_entry(const Id_t
 
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::store_edge_entry(const Id_t src, const Id_t dst, const uint16_t edge_label_id, const std::vector<SProperty_t> & props) noexcept
+{
+    store_in_edge_entry(store_out_edge_entry(src, dst, edge_label_id, props));
+}
+
+graphquery::database::storage::ILPGModel::SEdge_t
+graphquery::database::storage::CMemoryModelMMAPLPG::store_out_edge_entry(const Id_t src, const Id_t dst, const uint16_t edge_label_id, const std::vector<SProperty_t> & props) noexcept
 {
     SRef_t<SVertexDataBlock, true> src_v_ptr    = m_vertices_file.read_entry<true>(src);
-    SRef_t<SEdgeDataBlock, true> data_block_ptr = m_edges_file.attain_data_block(src_v_ptr->payload.edge_idx);
-    const auto entry_offset                     = data_block_ptr->idx;
+    SRef_t<SEdgeDataBlock, true> data_block_ptr = attain_label_edge_block<false>(src_v_ptr, edge_label_id);
 
     size_t payload_offset = 0;
     for (; payload_offset < data_block_ptr->state.size(); payload_offset++)
@@ -255,17 +640,27 @@ graphquery::database::storage::CMemoryModelMMAPLPG::store_edge_entry(const Id_t
         next_props_ref = store_property_entry(prop, next_props_ref);
 
     data_block_ptr->payload[payload_offset].metadata.property_id = next_props_ref;
+    const SEdge_t edge                                           = data_block_ptr->payload[payload_offset].metadata;
 
-    // ~ Update vertex tail and connect edges
-    utils::atomic_store(&src_v_ptr->payload.edge_idx, entry_offset);
+    // ~ Update vertex degree, the tail has been connected when attaining the block
     utils::atomic_fetch_inc(&src_v_ptr->payload.metadata.outdegree);
+    update_edge_version();
+
+    //~ Lose write references, before linking the edge to the temporal adjacency of the source.
+    data_block_ptr.~SRef_t();
+    src_v_ptr.~SRef_t();
+
+    if (!m_temporal_files.empty())
+        store_temporal_entries(edge, false);
+
+    return edge;
 }
 
-graphquery::database::storage::Id_t
-graphquery::database::storage::CMemoryModelMMAPLPG::store_label_entry(const uint16_t label_id, const Id_t next_ref) noexcept
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::store_in_edge_entry(const SEdge_t & edge) noexcept
 {
-    SRef_t<SLabelRefDataBlock, true> data_block_ptr = m_label_ref_file.attain_data_block(next_ref);
-    const Id_t entry_offset                         = data_block_ptr->idx;
+    SRef_t<SVertexDataBlock, true> dst_v_ptr    = m_vertices_file.read_entry<true>(edge.dst);
+    SRef_t<SEdgeDataBlock, true> data_block_ptr = attain_label_edge_block<true>(dst_v_ptr, edge.edge_label_id);
 
     size_t payload_offset = 0;
     for (; payload_offset < data_block_ptr->state.size(); payload_offset++)
@@ -278,14 +673,161 @@ graphquery::database::storage::CMemoryModelMMAPLPG::store_label_entry(const uint
         }
     }
 
-    data_block_ptr->state[payload_offset] = true;
-    utils::atomic_store(&data_block_ptr->payload[payload_offset], label_id);
-    return entry_offset;
+    //~ The incoming entry shares the property chain of the outgoing entry.
+    data_block_ptr->payload[payload_offset].metadata = edge;
+
+    data_block_ptr.~SRef_t();
+    dst_v_ptr.~SRef_t();
+
+    if (!m_temporal_files.empty())
+        store_temporal_entries(edge, true);
+}
+
+template<bool incoming>
+graphquery::database::storage::SRef_t<graphquery::database::storage::CMemoryModelMMAPLPG::SEdgeDataBlock, true>
+graphquery::database::storage::CMemoryModelMMAPLPG::attain_label_edge_block(SRef_t<SVertexDataBlock, true> & vertex_ptr, const uint16_t edge_label_id) noexcept
+{
+    auto & edges_file    = incoming ? m_in_edges_file : m_edges_file;
+    Id_t & chain_head    = incoming ? vertex_ptr->payload.in_edge_idx : vertex_ptr->payload.edge_idx;
+    auto [dir_ptr, slot] = attain_label_dir_entry(vertex_ptr, edge_label_id);
+    Id_t & segment_head  = incoming ? dir_ptr->payload[slot].in_idx : dir_ptr->payload[slot].out_idx;
+
+    //~ Open a new segment at the head of the chain for an unseen label.
+    if (segment_head == END_INDEX)
+    {
+        auto data_block_ptr = edges_file.attain_new_data_block(chain_head);
+        utils::atomic_store(&chain_head, data_block_ptr->idx);
+        utils::atomic_store(&segment_head, data_block_ptr->idx);
+        return data_block_ptr;
+    }
+
+    Id_t segment_next = END_INDEX;
+    {
+        auto data_block_ptr = edges_file.read_entry<true>(segment_head);
+        if (!data_block_ptr->state.all())
+            return data_block_ptr;
+
+        segment_next = data_block_ptr->next;
+    }
+
+    //~ New blocks are linked behind the segment head, therefore the latest one follows it.
+    if (segment_next != END_INDEX)
+    {
+        auto data_block_ptr = edges_file.read_entry<true>(segment_next);
+        if (data_block_ptr->payload[0].metadata.edge_label_id == edge_label_id && !data_block_ptr->state.all())
+            return data_block_ptr;
+    }
+
+    //~ Reserve a run twice the size of the last, once the current one is used up.
+    Id_t & reserve_idx  = incoming ? dir_ptr->payload[slot].in_reserve_idx : dir_ptr->payload[slot].out_reserve_idx;
+    uint8_t & reserve_c = incoming ? dir_ptr->payload[slot].in_reserve_c : dir_ptr->payload[slot].out_reserve_c;
+    uint8_t & run_class = incoming ? dir_ptr->payload[slot].in_run_class : dir_ptr->payload[slot].out_run_class;
+
+    if (reserve_c == 0)
+    {
+        reserve_idx = edges_file.attain_data_block_run(run_class);
+        reserve_c   = static_cast<uint8_t>(1 << run_class);
+        run_class   = std::min<uint8_t>(run_class + 1, EDGE_RUN_CLASS_MAX);
+    }
+
+    //~ Blocks are taken from the end of the run, as linking behind the head reverses them into ascending order.
+    const Id_t new_block_idx = reserve_idx + --reserve_c;
+    utils::atomic_store(&edges_file.read_entry<true>(new_block_idx)->next, segment_next);
+    utils::atomic_store(&edges_file.read_entry<true>(segment_head)->next, new_block_idx);
+    return edges_file.read_entry<true>(new_block_idx);
+}
+
+std::pair<graphquery::database::storage::SRef_t<graphquery::database::storage::CMemoryModelMMAPLPG::SLabelDirDataBlock, true>, uint8_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::attain_label_dir_entry(SRef_t<SVertexDataBlock, true> & vertex_ptr, const uint16_t edge_label_id) noexcept
+{
+    Id_t curr = vertex_ptr->payload.label_dir_idx;
+
+    while (curr != END_INDEX)
+    {
+        auto dir_ptr = m_label_dir_file.read_entry<true>(curr);
+
+        for (uint8_t j = 0; j < dir_ptr->payload.size(); j++)
+        {
+            if (dir_ptr->state.test(j) && dir_ptr->payload[j].edge_label_id == edge_label_id)
+                return {std::move(dir_ptr), j};
+        }
+        curr = dir_ptr->next;
+    }
+
+    auto dir_ptr = m_label_dir_file.attain_data_block(vertex_ptr->payload.label_dir_idx);
+    uint8_t slot = 0;
+
+    for (; slot < dir_ptr->state.size(); slot++)
+    {
+        if (!dir_ptr->state.test(slot))
+            break;
+    }
+
+    dir_ptr->state.set(slot);
+    utils::atomic_fetch_inc(&dir_ptr->payload_amt);
+    dir_ptr->payload[slot] = {.edge_label_id = edge_label_id};
+
+    utils::atomic_store(&vertex_ptr->payload.label_dir_idx, dir_ptr->idx);
+    utils::atomic_fetch_inc(&vertex_ptr->payload.metadata.edge_label_c);
+    return {std::move(dir_ptr), slot};
+}
+
+graphquery::database::storage::Id_t
+graphquery::database::storage::CMemoryModelMMAPLPG::get_label_edge_head(const Id_t label_dir_idx, const uint16_t edge_label_id, const bool incoming) noexcept
+{
+    auto gbl_dir_ptr = m_label_dir_file.read_entry(0);
+    Id_t curr        = label_dir_idx;
+
+    while (curr != END_INDEX)
+    {
+        const auto dir_ptr = gbl_dir_ptr + curr;
+
+        for (size_t j = 0; j < dir_ptr->payload.size(); j++)
+        {
+            if (dir_ptr->state.test(j) && dir_ptr->payload[j].edge_label_id == edge_label_id)
+                return utils::atomic_load(incoming ? &dir_ptr->payload[j].in_idx : &dir_ptr->payload[j].out_idx);
+        }
+        curr = dir_ptr->next;
+    }
+
+    return END_INDEX;
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::update_label_edge_head(const Id_t label_dir_idx, const uint16_t edge_label_id, const bool incoming, const Id_t removed_ref, const Id_t next_ref) noexcept
+{
+    auto & edges_file = incoming ? m_in_edges_file : m_edges_file;
+    auto gbl_dir_ptr  = m_label_dir_file.read_entry(0);
+    Id_t curr         = label_dir_idx;
+
+    while (curr != END_INDEX)
+    {
+        const auto dir_ptr = gbl_dir_ptr + curr;
+
+        for (size_t j = 0; j < dir_ptr->payload.size(); j++)
+        {
+            if (!(dir_ptr->state.test(j) && dir_ptr->payload[j].edge_label_id == edge_label_id))
+                continue;
+
+            //~ Move the head along the segment, or close the segment once it has been emptied.
+            Id_t * head = incoming ? &dir_ptr->payload[j].in_idx : &dir_ptr->payload[j].out_idx;
+            if (*head == removed_ref)
+            {
+                const bool next_in_segment = next_ref != END_INDEX && edges_file.read_entry(next_ref)->payload[0].metadata.edge_label_id == edge_label_id;
+                utils::atomic_store(head, next_in_segment ? next_ref : static_cast<Id_t>(END_INDEX));
+            }
+            return;
+        }
+        curr = dir_ptr->next;
+    }
 }
 
 graphquery::database::storage::Id_t
 graphquery::database::storage::CMemoryModelMMAPLPG::store_property_entry(const SProperty_t & prop, const Id_t next_ref) noexcept
 {
+    //~ Keys are interned prior to the first change of an insert, which fails once the keys are exhausted.
+    const uint16_t key_id = check_if_property_key_exists(prop.key).value();
+
     SRef_t<SPropertyDataBlock, true> data_block_ptr = m_properties_file.attain_data_block(next_ref);
     const Id_t entry_offset                         = data_block_ptr->idx;
 
@@ -301,14 +843,37 @@ graphquery::database::storage::CMemoryModelMMAPLPG::store_property_entry(const S
     }
 
     data_block_ptr->state[payload_offset] = true;
-    strncpy(&data_block_ptr->payload[payload_offset].key[0], prop.key, CFG_LPG_PROPERTY_KEY_LENGTH);
-    data_block_ptr->payload[payload_offset].key[CFG_LPG_PROPERTY_KEY_LENGTH - 1] = '\0';
-    strncpy(&data_block_ptr->payload[payload_offset].value[0], prop.value, CFG_LPG_PROPERTY_VALUE_LENGTH);
-    data_block_ptr->payload[payload_offset].value[CFG_LPG_PROPERTY_VALUE_LENGTH - 1] = '\0';
+    auto & entry                          = data_block_ptr->payload[payload_offset];
+
+    entry.key_id       = key_id;
+    entry.value_length = static_cast<uint32_t>(prop.value.size());
+
+    if (prop.value.size() <= CFG_LPG_PROPERTY_INLINE_LENGTH)
+        std::copy_n(prop.value.data(), prop.value.size(), &entry.inline_value[0]);
+    else
+        entry.heap_addr = m_heap_file.append(prop.value);
 
     return entry_offset;
 }
 
+inline std::string
+graphquery::database::storage::CMemoryModelMMAPLPG::read_property_value(const SPropertyEntry_t & entry) noexcept
+{
+    if (entry.value_length <= CFG_LPG_PROPERTY_INLINE_LENGTH)
+        return {&entry.inline_value[0], entry.value_length};
+
+    return m_heap_file.read(entry.heap_addr);
+}
+
+inline graphquery::database::storage::ILPGModel::SProperty_t
+graphquery::database::storage::CMemoryModelMMAPLPG::read_property_entry(const SPropertyEntry_t & entry) noexcept
+{
+    SProperty_t prop = {};
+    prop.key         = read_property_key_entry(entry.key_id)->key_s;
+    prop.value       = read_property_value(entry);
+    return prop;
+}
+
 bool
 graphquery::database::storage::CMemoryModelMMAPLPG::contains_vertex_label_id(const int64_t vertex_offset, const uint16_t label_id) noexcept
 {
@@ -317,20 +882,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::contains_vertex_label_id(con
     if (!v_ptr.has_value())
         return false;
 
-    auto label_head = v_ptr->ref->payload.metadata.label_id;
-
-    while (label_head != END_INDEX)
-    {
-        auto l_ptr = m_label_ref_file.read_entry(label_head);
-
-        for (size_t i = 0; i < l_ptr->state.size(); i++)
-        {
-            if (l_ptr->state.test(i) && l_ptr->payload[i] == label_id)
-                return true;
-        }
-        label_head = l_ptr->next;
-    }
-    return false;
+    return label_id < VERTEX_LABELS_MAX_AMT && v_ptr->ref->payload.metadata.label_mask[label_id];
 }
 
 uint16_t
@@ -364,22 +916,57 @@ graphquery::database::storage::CMemoryModelMMAPLPG::create_vertex_label(const st
     return label_id;
 }
 
-bool
-graphquery::database::storage::CMemoryModelMMAPLPG::check_if_edge_exists(const Id_t src_idx, const Id_t dst_idx, const uint16_t edge_label_id) noexcept
+std::optional<uint16_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::create_property_key(const std::string_view key_str) noexcept
 {
-    const auto v_ptr = m_vertices_file.read_entry(src_idx);
-    auto v_edge_idx  = v_ptr.ref->payload.edge_idx;
-    auto gbl_e_ptr   = m_edges_file.read_entry(0);
-
-    while (v_edge_idx != END_INDEX)
+    uint16_t key_id = {};
     {
-        const SEdgeDataBlock * e_curr = gbl_e_ptr + v_edge_idx;
+        auto metadata = read_graph_metadata();
+        key_id        = utils::atomic_load(&metadata->property_key_c);
 
-        for (uint8_t p = 0, j = 0; p != e_curr->payload_amt && j < e_curr->payload.size();)
+        //~ Claimed solely while below the limit, such that the count never addresses past the key dictionary.
+        while (true)
         {
-            if (e_curr->state.test(j))
+            if (key_id >= PROPERTY_KEYS_MAX_AMT)
             {
-                if (e_curr->payload[j].metadata.dst == dst_idx && e_curr->payload[j].metadata.edge_label_id == edge_label_id)
+                m_log_system->error(fmt::format("Property key ({}) exceeds the limit of {} keys", key_str, PROPERTY_KEYS_MAX_AMT));
+                return std::nullopt;
+            }
+
+            uint16_t next_key_c = key_id + 1;
+            if (utils::atomic_fetch_cas(&metadata->property_key_c, key_id, next_key_c, false))
+                break;
+        }
+    }
+
+    const auto key_ptr = read_property_key_entry<true>(key_id);
+
+    strncpy(&key_ptr.ref->key_s[0], key_str.data(), std::min(key_str.size(), static_cast<size_t>(CFG_LPG_PROPERTY_KEY_LENGTH - 1)));
+    key_ptr.ref->key_id               = key_id;
+    m_p_key_map[std::string(key_str)] = key_id;
+
+    return key_id;
+}
+
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::check_if_edge_exists(const Id_t src_idx, const Id_t dst_idx, const uint16_t edge_label_id) noexcept
+{
+    const auto label_dir_idx = utils::atomic_load(&m_vertices_file.read_entry(src_idx)->payload.label_dir_idx);
+    auto v_edge_idx          = get_label_edge_head(label_dir_idx, edge_label_id, false);
+    auto gbl_e_ptr           = m_edges_file.read_entry(0);
+
+    while (v_edge_idx != END_INDEX)
+    {
+        const SEdgeDataBlock * e_curr = gbl_e_ptr + v_edge_idx;
+
+        if (e_curr->payload[0].metadata.edge_label_id != edge_label_id)
+            break;
+
+        for (uint8_t p = 0, j = 0; p != e_curr->payload_amt && j < e_curr->payload.size();)
+        {
+            if (e_curr->state.test(j))
+            {
+                if (e_curr->payload[j].metadata.dst == dst_idx && e_curr->payload[j].metadata.edge_label_id == edge_label_id)
                     return true;
                 p++;
             }
@@ -408,6 +995,17 @@ graphquery::database::storage::CMemoryModelMMAPLPG::check_if_vertex_label_exists
     return m_v_label_map.at(label_str.data());
 }
 
+std::optional<uint16_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::check_if_property_key_exists(const std::string_view & key_str) noexcept
+{
+    const auto key_it = m_p_key_map.find(std::string(key_str));
+
+    if (key_it == m_p_key_map.end())
+        return std::nullopt;
+
+    return key_it->second;
+}
+
 std::unordered_set<uint16_t>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_vertex_labels(const std::vector<std::string_view> & labels, const bool create_if_absent) noexcept
 {
@@ -429,16 +1027,48 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_vertex_labels(const std:
     return ret;
 }
 
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::intern_property_keys(const std::vector<SProperty_t> & props) noexcept
+{
+    for (const auto & prop : props)
+        if (!check_if_property_key_exists(prop.key).has_value() && !create_property_key(prop.key).has_value())
+            return false;
+
+    return true;
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::intern_vertex_names(const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & props) noexcept
+{
+    //~ Created in the order an insert of the vertex would create them, a key beyond the limit fails the insert itself.
+    (void) get_vertex_labels(labels, true);
+    (void) intern_property_keys(props);
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::intern_edge_names(const std::string_view edge_label, const std::vector<SProperty_t> & props) noexcept
+{
+    //~ Created in the order an insert of the edge would create them.
+    if (!check_if_edge_label_exists(edge_label).has_value() && get_num_edge_labels() < EDGE_LABELS_MAX_AMT)
+        (void) create_edge_label(edge_label);
+
+    (void) intern_property_keys(props);
+}
+
 graphquery::database::storage::CMemoryModelMMAPLPG::EActionState_t
 graphquery::database::storage::CMemoryModelMMAPLPG::add_vertex_entry(const Id_t id, const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & props) noexcept
 {
-    if (get_vertex_by_id(id).has_value())
+    if (get_vertex_by_id(id).has_value() || !intern_property_keys(props))
         return EActionState_t::invalid;
 
     std::unordered_set<uint16_t> label_ids = get_vertex_labels(labels, true);
+    CTransactionUndoLog undo_log;
 
-    if (!store_vertex_entry(id, label_ids, props))
+    if (!store_vertex_entry(id, label_ids, props, undo_log))
+    {
+        undo_transaction(undo_log);
         return EActionState_t::abort;
+    }
 
     utils::atomic_fetch_pre_inc(&read_graph_metadata()->vertices_c);
 
@@ -449,14 +1079,20 @@ graphquery::database::storage::CMemoryModelMMAPLPG::add_vertex_entry(const Id_t
 }
 
 graphquery::database::storage::CMemoryModelMMAPLPG::EActionState_t
-graphquery::database::storage::CMemoryModelMMAPLPG::add_vertex_entry(const std::vector<std::string_view> & labels, [[maybe_unused]] const std::vector<SProperty_t> & props) noexcept
+graphquery::database::storage::CMemoryModelMMAPLPG::add_vertex_entry(const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & props) noexcept
 {
+    if (!intern_property_keys(props))
+        return EActionState_t::invalid;
+
     std::unordered_set<uint16_t> label_ids = get_vertex_labels(labels, true);
+    CTransactionUndoLog undo_log;
 
     const auto vertex_id = utils::atomic_fetch_inc(&read_graph_metadata()->vertices_c);
-    if (!store_vertex_entry(vertex_id, label_ids, props))
+    undo_log.push({.action = EUndoAction_t::restore_vertices_c, .id = vertex_id});
+
+    if (!store_vertex_entry(vertex_id, label_ids, props, undo_log))
     {
-        utils::atomic_fetch_dec(&read_graph_metadata()->vertices_c);
+        undo_transaction(undo_log);
         return EActionState_t::abort;
     }
 
@@ -471,7 +1107,8 @@ graphquery::database::storage::CMemoryModelMMAPLPG::add_edge_entry(const Id_t sr
                                                                    const Id_t dst,
                                                                    const std::string_view edge_label,
                                                                    const std::vector<SProperty_t> & props,
-                                                                   const bool undirected) noexcept
+                                                                   const bool undirected,
+                                                                   const bool deduplicated) noexcept
 {
     Id_t src_idx;
     Id_t dst_idx;
@@ -484,94 +1121,247 @@ graphquery::database::storage::CMemoryModelMMAPLPG::add_edge_entry(const Id_t sr
         dst_idx = dst_vertex_exists->ref->idx;
     }
 
+    //~ Every step that can fail precedes the first change, therefore an edge is never partially applied and records no undo.
     const std::optional<uint16_t> edge_label_exists = check_if_edge_label_exists(edge_label);
-    const auto edge_label_id                        = edge_label_exists.has_value() ? *edge_label_exists : create_edge_label(edge_label);
+    if ((!edge_label_exists.has_value() && get_num_edge_labels() >= EDGE_LABELS_MAX_AMT) || !intern_property_keys(props))
+        return EActionState_t::invalid;
 
-    if (check_if_edge_exists(src, dst, edge_label_id))
+    const auto edge_label_id = edge_label_exists.has_value() ? *edge_label_exists : create_edge_label(edge_label);
+
+    if (!deduplicated && check_if_edge_exists(src_idx, dst_idx, edge_label_id))
         return EActionState_t::invalid;
 
     utils::atomic_fetch_inc(&read_edge_label_entry(edge_label_id)->item_c);
-    utils::atomic_fetch_inc(&m_vertices_file.read_entry(dst)->payload.metadata.indegree);
+    utils::atomic_fetch_inc(&m_vertices_file.read_entry(dst_idx)->payload.metadata.indegree);
     store_edge_entry(src_idx, dst_idx, edge_label_id, props);
     utils::atomic_fetch_inc(&read_graph_metadata()->edges_c);
 
     if (undirected)
     {
-        utils::atomic_fetch_inc(&m_vertices_file.read_entry(src)->payload.metadata.indegree);
+        utils::atomic_fetch_inc(&m_vertices_file.read_entry(src_idx)->payload.metadata.indegree);
         store_edge_entry(dst_idx, src_idx, edge_label_id, props);
     }
 
     return EActionState_t::valid;
 }
 
+template<typename Func>
+auto
+graphquery::database::storage::CMemoryModelMMAPLPG::partition_batch(const uint32_t item_c, Func && vertex_of) noexcept -> std::array<std::vector<uint32_t>, BATCH_PARTITION_C>
+{
+    //~ Items of a vertex share a partition, keeping the order of the batch.
+    std::array<std::vector<uint32_t>, BATCH_PARTITION_C> partitions = {};
+
+    for (uint32_t i = 0; i < item_c; i++)
+        partitions[vertex_of(i) % BATCH_PARTITION_C].emplace_back(i);
+
+    return partitions;
+}
+
+uint64_t
+graphquery::database::storage::CMemoryModelMMAPLPG::add_edge_entries(const std::vector<SEdgeChange_t> & changes, const bool deduplicated) noexcept
+{
+    struct SEdgeOp
+    {
+        Id_t owner             = {};
+        Id_t target            = {};
+        uint16_t edge_label_id = {};
+        uint32_t change        = {};
+        SEdge_t edge           = {};
+    };
+
+    const auto change_c = static_cast<uint32_t>(changes.size());
+    std::vector<Id_t> src_idx(change_c, END_INDEX);
+    std::vector<Id_t> dst_idx(change_c, END_INDEX);
+    std::vector<uint16_t> edge_label_ids(change_c, 0);
+    std::vector<uint8_t> applied(change_c, 0);
+
+    //~ Resolved against the graph prior to the batch, which is solely read meanwhile.
+#pragma omp parallel for default(none) shared(changes, src_idx, dst_idx, edge_label_ids, applied, change_c, deduplicated) schedule(static)
+    for (uint32_t i = 0; i < change_c; i++)
+    {
+        const auto src_vertex    = get_vertex_by_id(changes[i].src);
+        const auto dst_vertex    = get_vertex_by_id(changes[i].dst);
+        const auto edge_label_id = check_if_edge_label_exists(changes[i].edge_label);
+        const bool keys_exist    = std::all_of(changes[i].props->begin(), changes[i].props->end(), [this](const SProperty_t & prop) -> bool { return check_if_property_key_exists(prop.key).has_value(); });
+
+        if (!(src_vertex.has_value() && dst_vertex.has_value() && edge_label_id.has_value() && keys_exist))
+            continue;
+
+        src_idx[i]        = src_vertex->ref->idx;
+        dst_idx[i]        = dst_vertex->ref->idx;
+        edge_label_ids[i] = *edge_label_id;
+        applied[i]        = deduplicated || !check_if_edge_exists(src_idx[i], dst_idx[i], *edge_label_id);
+    }
+
+    //~ Duplicates within the batch are settled in order, as inserting the changes one by one would.
+    if (!deduplicated)
+    {
+        std::set<std::tuple<Id_t, Id_t, uint16_t>> inserted = {};
+
+        for (uint32_t i = 0; i < change_c; i++)
+        {
+            if (!applied[i])
+                continue;
+
+            applied[i] = inserted.emplace(src_idx[i], dst_idx[i], edge_label_ids[i]).second;
+
+            if (applied[i] && changes[i].undirected)
+                inserted.emplace(dst_idx[i], src_idx[i], edge_label_ids[i]);
+        }
+    }
+
+    std::vector<SEdgeOp> ops = {};
+    uint64_t applied_c       = 0;
+    ops.reserve(change_c);
+
+    for (uint32_t i = 0; i < change_c; i++)
+    {
+        if (!applied[i])
+            continue;
+
+        ops.emplace_back(SEdgeOp {.owner = src_idx[i], .target = dst_idx[i], .edge_label_id = edge_label_ids[i], .change = i});
+
+        if (changes[i].undirected)
+            ops.emplace_back(SEdgeOp {.owner = dst_idx[i], .target = src_idx[i], .edge_label_id = edge_label_ids[i], .change = i});
+
+        utils::atomic_fetch_inc(&read_edge_label_entry(edge_label_ids[i])->item_c);
+        applied_c++;
+    }
+
+    utils::atomic_fetch_add(&read_graph_metadata()->edges_c, static_cast<Id_t>(applied_c));
+
+    //~ Each outgoing chain is appended to by a single partition, followed by each incoming chain likewise.
+    const auto out_partitions = partition_batch(static_cast<uint32_t>(ops.size()), [&ops](const uint32_t k) -> Id_t { return ops[k].owner; });
+
+#pragma omp parallel for default(none) shared(out_partitions, ops, changes) schedule(dynamic, 1)
+    for (uint32_t p = 0; p < BATCH_PARTITION_C; p++)
+        for (const uint32_t k : out_partitions[p])
+            ops[k].edge = store_out_edge_entry(ops[k].owner, ops[k].target, ops[k].edge_label_id, *changes[ops[k].change].props);
+
+    const auto in_partitions = partition_batch(static_cast<uint32_t>(ops.size()), [&ops](const uint32_t k) -> Id_t { return ops[k].target; });
+
+#pragma omp parallel for default(none) shared(in_partitions, ops) schedule(dynamic, 1)
+    for (uint32_t p = 0; p < BATCH_PARTITION_C; p++)
+    {
+        for (const uint32_t k : in_partitions[p])
+        {
+            utils::atomic_fetch_inc(&m_vertices_file.read_entry(ops[k].target)->payload.metadata.indegree);
+            store_in_edge_entry(ops[k].edge);
+        }
+    }
+
+    return change_c - applied_c;
+}
+
+uint64_t
+graphquery::database::storage::CMemoryModelMMAPLPG::rm_edge_entries(const std::vector<SEdgeChange_t> & changes) noexcept
+{
+    const auto change_c = static_cast<uint32_t>(changes.size());
+    std::vector<uint8_t> removed(change_c, 0);
+
+    //~ Each outgoing chain is unlinked from by a single partition, followed by each incoming chain likewise.
+    const auto out_partitions = partition_batch(change_c, [&changes](const uint32_t i) -> Id_t { return changes[i].src; });
+
+#pragma omp parallel for default(none) shared(out_partitions, changes, removed) schedule(dynamic, 1)
+    for (uint32_t p = 0; p < BATCH_PARTITION_C; p++)
+    {
+        for (const uint32_t i : out_partitions[p])
+        {
+            const SEdgeChange_t & change = changes[i];
+            const EActionState_t state   = change.edge_label.empty() ? rm_edge_entry(change.src, change.dst, EChainSide_t::outgoing)
+                                                                      : rm_edge_entry(change.src, change.dst, change.edge_label, EChainSide_t::outgoing);
+            removed[i]                   = state == EActionState_t::valid;
+        }
+    }
+
+    const auto in_partitions = partition_batch(change_c, [&changes](const uint32_t i) -> Id_t { return changes[i].dst; });
+
+#pragma omp parallel for default(none) shared(in_partitions, changes, removed) schedule(dynamic, 1)
+    for (uint32_t p = 0; p < BATCH_PARTITION_C; p++)
+    {
+        for (const uint32_t i : in_partitions[p])
+        {
+            if (!removed[i])
+                continue;
+
+            const SEdgeChange_t & change               = changes[i];
+            const Id_t src_idx                         = get_vertex_by_id(change.src).value()->idx;
+            const Id_t dst_idx                         = get_vertex_by_id(change.dst).value()->idx;
+            const std::optional<uint16_t> edge_label_id = change.edge_label.empty() ? std::nullopt : check_if_edge_label_exists(change.edge_label);
+
+            (void) rm_in_edge_entries(src_idx, dst_idx, edge_label_id);
+            rm_temporal_entries(src_idx, dst_idx, edge_label_id, true);
+        }
+    }
+
+    return static_cast<uint64_t>(std::ranges::count(removed, 0));
+}
+
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::add_vertex(const Id_t src, const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & prop)
 {
+    std::shared_lock checkpoint_lock(m_checkpoint_lock);
     const uint64_t commit_addr = m_transactions->log_vertex(labels, prop, src);
     if (const EActionState_t state = add_vertex_entry(src, labels, prop); state > EActionState_t::valid)
     {
         m_transactions->close_transaction_gracefully();
         m_log_system->warning(fmt::format("Issue adding vertex"));
-
-        if (state == EActionState_t::abort)
-            rollback();
         return;
     }
-    m_transactions->commit_transaction<CTransaction::SVertexCommit>(commit_addr);
+    if (!m_transactions->commit_transaction<CTransaction::SVertexCommit>(commit_addr))
+        m_log_system->error("Vertex transaction could not be made durable, it is lost once the graph is reopened");
     utils::atomic_store(&read_graph_metadata()->flush_needed, true);
 }
 
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::add_edge(const Id_t src, const Id_t dst, const std::string_view edge_label, const std::vector<SProperty_t> & prop, bool undirected)
 {
+    std::shared_lock checkpoint_lock(m_checkpoint_lock);
     const uint64_t commit_addr = m_transactions->log_edge(src, dst, edge_label, prop, undirected);
     if (const EActionState_t state = add_edge_entry(src, dst, edge_label, prop, undirected); state > EActionState_t::valid)
     {
         m_transactions->close_transaction_gracefully();
         m_log_system->warning(fmt::format("Issue adding edge({}) to vertex({})", dst, src));
-
-        if (state == EActionState_t::abort)
-            rollback();
         return;
     }
 
-    m_transactions->commit_transaction<CTransaction::SEdgeCommit>(commit_addr);
+    if (!m_transactions->commit_transaction<CTransaction::SEdgeCommit>(commit_addr))
+        m_log_system->error("Edge transaction could not be made durable, it is lost once the graph is reopened");
     utils::atomic_store(&read_graph_metadata()->flush_needed, true);
 }
 
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::add_vertex(const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & prop)
 {
+    std::shared_lock checkpoint_lock(m_checkpoint_lock);
     const uint64_t commit_addr = m_transactions->log_vertex(labels, prop);
     if (const EActionState_t state = add_vertex_entry(labels, prop); state > EActionState_t::valid)
     {
         m_transactions->close_transaction_gracefully();
         m_log_system->warning("Issue adding vertex");
-
-        if (state == EActionState_t::abort)
-            rollback();
         return;
     }
 
-    m_transactions->commit_transaction<CTransaction::SVertexCommit>(commit_addr);
+    if (!m_transactions->commit_transaction<CTransaction::SVertexCommit>(commit_addr))
+        m_log_system->error("Vertex transaction could not be made durable, it is lost once the graph is reopened");
     utils::atomic_store(&read_graph_metadata()->flush_needed, true);
 }
 
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::rm_vertex(Id_t src)
 {
+    std::shared_lock checkpoint_lock(m_checkpoint_lock);
     const uint64_t commit_addr = m_transactions->log_rm_vertex(src);
     if (const EActionState_t state = rm_vertex_entry(src); state > EActionState_t::valid)
     {
         m_transactions->close_transaction_gracefully();
         m_log_system->warning(fmt::format("Issue removing vertex({})", src));
-
-        if (state == EActionState_t::abort)
-            rollback();
         return;
     }
 
-    m_transactions->commit_transaction<CTransaction::SVertexCommit>(commit_addr);
+    if (!m_transactions->commit_transaction<CTransaction::SVertexCommit>(commit_addr))
+        m_log_system->error("Vertex transaction could not be made durable, it is lost once the graph is reopened");
     utils::atomic_store(&read_graph_metadata()->flush_needed, true);
     utils::atomic_store(&read_graph_metadata()->prune_needed, true);
 }
@@ -579,18 +1369,17 @@ graphquery::database::storage::CMemoryModelMMAPLPG::rm_vertex(Id_t src)
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::rm_edge(Id_t src, Id_t dst)
 {
+    std::shared_lock checkpoint_lock(m_checkpoint_lock);
     uint64_t commit_addr = m_transactions->log_rm_edge(src, dst);
     if (const EActionState_t state = rm_edge_entry(src, dst); state > EActionState_t::valid)
     {
         m_transactions->close_transaction_gracefully();
         m_log_system->warning(fmt::format("Issue remvoing edge({}) to vertex({})", dst, src));
-
-        if (state == EActionState_t::abort)
-            rollback();
         return;
     }
 
-    m_transactions->commit_transaction<CTransaction::SEdgeCommit>(commit_addr);
+    if (!m_transactions->commit_transaction<CTransaction::SEdgeCommit>(commit_addr))
+        m_log_system->error("Edge transaction could not be made durable, it is lost once the graph is reopened");
     utils::atomic_store(&read_graph_metadata()->flush_needed, true);
     utils::atomic_store(&read_graph_metadata()->prune_needed, true);
 }
@@ -598,188 +1387,512 @@ graphquery::database::storage::CMemoryModelMMAPLPG::rm_edge(Id_t src, Id_t dst)
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::rm_edge(Id_t src, Id_t dst, const std::string_view edge_label)
 {
+    std::shared_lock checkpoint_lock(m_checkpoint_lock);
     uint64_t commit_addr = m_transactions->log_rm_edge(src, dst, edge_label);
     if (const EActionState_t state = rm_edge_entry(src, dst, edge_label); state > EActionState_t::valid)
     {
         m_transactions->close_transaction_gracefully();
         m_log_system->warning(fmt::format("Issue remvoing edge({}) to vertex({})", dst, src));
-
-        if (state == EActionState_t::abort)
-            rollback();
         return;
     }
 
-    m_transactions->commit_transaction<CTransaction::SEdgeCommit>(commit_addr);
+    if (!m_transactions->commit_transaction<CTransaction::SEdgeCommit>(commit_addr))
+        m_log_system->error("Edge transaction could not be made durable, it is lost once the graph is reopened");
     utils::atomic_store(&read_graph_metadata()->flush_needed, true);
 }
 
-std::optional<graphquery::database::storage::ILPGModel::SVertex_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_vertex(const Id_t src)
+std::optional<graphquery::database::storage::Id_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::lookup_vertex(const Id_t id) noexcept
 {
-    auto ptr = get_vertex_by_id(src);
+    const auto vertex_ptr = get_vertex_by_id(id);
 
-    if (!ptr.has_value())
+    if (!vertex_ptr.has_value())
         return std::nullopt;
 
-    return ptr->ref->payload.metadata;
+    return vertex_ptr->ref->idx;
 }
 
-std::optional<graphquery::database::storage::Id_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_vertex_idx(const Id_t id) noexcept
+graphquery::database::storage::ILPGModel::SMutation_t
+graphquery::database::storage::CMemoryModelMMAPLPG::make_edge_mutation(const SEdge_t & edge) noexcept
 {
-    auto vertex = get_vertex_by_id(id);
-
-    if (!vertex)
-        return std::nullopt;
-
-    return (*vertex)->idx;
+    return SMutation_t {.type       = EMutationType_t::add_edge,
+                        .src        = m_vertices_file.read_entry(edge.src)->payload.metadata.id,
+                        .dst        = m_vertices_file.read_entry(edge.dst)->payload.metadata.id,
+                        .edge_label = read_edge_label_entry(edge.edge_label_id)->label_s,
+                        .props      = read_property_chain(edge.property_id)};
 }
 
-std::optional<graphquery::database::storage::Id_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_vertex_id(const Id_t idx) noexcept
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::read_edge_mutations(const Id_t vertex_idx,
+                                                                        const bool incoming,
+                                                                        const std::function<bool(const SEdge_t &)> & pred,
+                                                                        std::vector<SMutation_t> & mutations) noexcept
 {
-    auto vertex = get_vertex_by_offset(idx);
+    //~ The edges are copied out of the chain prior to resolving them, such that no reference to the edge files is held meanwhile.
+    std::vector<SEdge_t> edges = {};
 
-    if (!vertex)
-        return std::nullopt;
+    {
+        auto & edges_file = incoming ? m_in_edges_file : m_edges_file;
+        auto v_ptr        = m_vertices_file.read_entry(vertex_idx);
+        auto gbl_edge_ptr = edges_file.read_entry(0);
+        Id_t curr         = incoming ? v_ptr->payload.in_edge_idx : v_ptr->payload.edge_idx;
 
-    return (*vertex)->payload.metadata.id;
+        while (curr != END_INDEX)
+        {
+            const auto curr_edge_ptr = gbl_edge_ptr + curr;
+
+            for (size_t j = 0; j < curr_edge_ptr->state.size(); j++)
+            {
+                if (curr_edge_ptr->state.test(j) && pred(curr_edge_ptr->payload[j].metadata))
+                    edges.emplace_back(curr_edge_ptr->payload[j].metadata);
+            }
+            curr = curr_edge_ptr->next;
+        }
+    }
+
+    for (const SEdge_t & edge : edges)
+        mutations.emplace_back(make_edge_mutation(edge));
 }
 
-std::vector<graphquery::database::storage::ILPGModel::SVertex_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_vertices(const std::function<bool(const SVertex_t &)> & pred)
+graphquery::database::storage::CMemoryModelMMAPLPG::EActionState_t
+graphquery::database::storage::CMemoryModelMMAPLPG::apply_mutation(const SMutation_t & mutation, std::vector<SMutation_t> & undo) noexcept
 {
-    const uint32_t datablock_c = utils::atomic_load(&m_vertices_file.read_metadata()->data_block_c);
-
-    std::vector<SVertex_t> ret = {};
-    ret.reserve(datablock_c);
+    //~ The statements reverting the mutation are pushed in the reverse order of their application, as the undo is rewound newest first.
+    const size_t undo_c  = undo.size();
+    EActionState_t state = EActionState_t::invalid;
 
-    for (uint32_t i = 0; i < datablock_c; i++)
+    switch (mutation.type)
     {
-        auto curr_vertex_ptr = m_vertices_file.read_entry(i);
+    case EMutationType_t::add_vertex:
+    {
+        const Id_t id = mutation.src == std::numeric_limits<Id_t>::max() ? static_cast<Id_t>(get_num_vertices()) : mutation.src;
+        const std::vector<std::string_view> labels(mutation.labels.begin(), mutation.labels.end());
+        state = add_vertex_entry(id, labels, mutation.props);
+        undo.emplace_back(SMutation_t {.type = EMutationType_t::rm_vertex, .src = id});
+        break;
+    }
+    case EMutationType_t::add_edge:
+    {
+        //~ An undirected insert stores the reverse edge regardless, therefore a present reverse edge is restored once the pair is removed.
+        const auto src_idx       = lookup_vertex(mutation.src);
+        const auto dst_idx       = lookup_vertex(mutation.dst);
+        const auto edge_label_id = check_if_edge_label_exists(mutation.edge_label);
 
-        if (unlikely(!(curr_vertex_ptr->state & 1 << VERTEX_INITIALISED_STATE_BIT)))
-            continue;
+        if (mutation.undirected && src_idx.has_value() && dst_idx.has_value() && edge_label_id.has_value())
+            read_edge_mutations(*dst_idx, false, [&src_idx, &edge_label_id](const SEdge_t & edge) -> bool { return edge.dst == *src_idx && edge.edge_label_id == *edge_label_id; }, undo);
 
-        if (pred(curr_vertex_ptr->payload.metadata))
-            ret.emplace_back(curr_vertex_ptr->payload.metadata);
+        state = add_edge_entry(mutation.src, mutation.dst, mutation.edge_label, mutation.props, mutation.undirected);
+        undo.emplace_back(SMutation_t {.type = EMutationType_t::rm_edge, .src = mutation.src, .dst = mutation.dst, .undirected = mutation.undirected, .edge_label = mutation.edge_label});
+        break;
     }
+    case EMutationType_t::rm_vertex:
+    {
+        if (const auto vertex_idx = lookup_vertex(mutation.src); vertex_idx.has_value())
+        {
+            //~ Edges towards vertices marked for deletion are left out, as those are pruned regardless. Self loops are held by the outgoing edges.
+            read_edge_mutations(*vertex_idx, false, [this](const SEdge_t & edge) -> bool { return !(m_vertices_file.read_entry(edge.dst)->state & 1 << VERTEX_MARKED_STATE_BIT); }, undo);
 
-    ret.shrink_to_fit();
-    return ret;
-}
+            const size_t in_c = undo.size();
+            read_edge_mutations(*vertex_idx, true, [&vertex_idx](const SEdge_t & edge) -> bool { return edge.src != *vertex_idx; }, undo);
 
-std::optional<graphquery::database::storage::ILPGModel::SEdge_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_edge(const Id_t src_vertex_id, const std::string_view edge_label, const int64_t dst_vertex_id)
-{
-    auto edge_label_id = check_if_edge_label_exists(edge_label);
+            std::unordered_set<Id_t> neighbours = {};
+            for (size_t i = in_c; i < undo.size(); i++)
+                neighbours.emplace(undo[i].src);
 
-    if (!edge_label_id.has_value())
-        return std::nullopt;
+            {
+                auto vertex_ptr         = m_vertices_file.read_entry(*vertex_idx);
+                const auto & label_mask = vertex_ptr->payload.metadata.label_mask;
+                SMutation_t & restore   = undo.emplace_back(
+                    SMutation_t {.type = EMutationType_t::add_vertex, .src = mutation.src, .props = read_property_chain(vertex_ptr->payload.metadata.property_id)});
+
+                for (uint16_t label_id = 0; label_id < VERTEX_LABELS_MAX_AMT; label_id++)
+                {
+                    if (label_mask[label_id])
+                        restore.labels.emplace_back(read_vertex_label_entry(label_id)->label_s);
+                }
+            }
 
-    auto pred = [edge_label_id, dst_vertex_id](const SEdge_t & edge) -> bool { return dst_vertex_id == edge.dst && edge.edge_label_id == *edge_label_id; };
+            //~ The incoming edges are removed beforehand rather than pruned, such that the id is released at once and the vertex can be restored.
+            for (const Id_t neighbour : neighbours)
+                (void) rm_edge_entry(neighbour, mutation.src);
+        }
 
-    auto edges = get_edges_by_offset(src_vertex_id, pred);
+        state = rm_vertex_entry(mutation.src);
+        break;
+    }
+    case EMutationType_t::rm_edge:
+    {
+        const auto src_idx                          = lookup_vertex(mutation.src);
+        const auto dst_idx                          = lookup_vertex(mutation.dst);
+        const std::optional<uint16_t> edge_label_id = mutation.edge_label.empty() ? std::nullopt : check_if_edge_label_exists(mutation.edge_label);
+
+        if (src_idx.has_value() && dst_idx.has_value() && (mutation.edge_label.empty() || edge_label_id.has_value()))
+            read_edge_mutations(*src_idx,
+                                false,
+                                [&dst_idx, &edge_label_id](const SEdge_t & edge) -> bool { return edge.dst == *dst_idx && (!edge_label_id.has_value() || edge.edge_label_id == *edge_label_id); },
+                                undo);
+
+        state = mutation.edge_label.empty() ? rm_edge_entry(mutation.src, mutation.dst) : rm_edge_entry(mutation.src, mutation.dst, mutation.edge_label);
+        break;
+    }
+    }
 
-    if (edges.empty())
-        return std::nullopt;
+    if (state > EActionState_t::valid)
+        undo.resize(undo_c);
 
-    return edges[0];
+    return state;
 }
 
-std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::function<bool(const SEdge_t &)> & pred)
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::undo_mutations(std::vector<SMutation_t> & undo) noexcept
 {
-    const Id_t datablock_c = utils::atomic_load(&m_edges_file.read_metadata()->data_block_c);
-
-    std::vector<SEdge_t> ret = {};
-    ret.reserve(datablock_c);
-
-    SRef_t<SEdgeDataBlock> gbl_edge_ptr = m_edges_file.read_entry(0);
-
-#pragma omp declare reduction(merge : std::vector<SEdge_t> : omp_out.insert(omp_out.end(), omp_in.begin(), omp_in.end())) initializer(omp_priv = std::vector<SEdge_t>())
-#pragma omp parallel for default(none) shared(gbl_edge_ptr, datablock_c, pred) schedule(dynamic) reduction(merge : ret)
-    for (Id_t i = 0; i < datablock_c; i++)
+    for (auto it = undo.rbegin(); it != undo.rend(); ++it)
     {
-        const auto curr_edge_ptr = gbl_edge_ptr + i;
+        const SMutation_t & mutation = *it;
 
-        for (size_t j = 0; j < curr_edge_ptr->state.size(); j++)
+        switch (mutation.type)
         {
-            if (likely(curr_edge_ptr->state.test(j)))
+        case EMutationType_t::add_vertex:
+        {
+            const std::vector<std::string_view> labels(mutation.labels.begin(), mutation.labels.end());
+            (void) add_vertex_entry(mutation.src, labels, mutation.props);
+            break;
+        }
+        //~ Restored as found, duplicates stored by an undirected insert included.
+        case EMutationType_t::add_edge: (void) add_edge_entry(mutation.src, mutation.dst, mutation.edge_label, mutation.props, false, true); break;
+        case EMutationType_t::rm_vertex: (void) rm_vertex_entry(mutation.src); break;
+        case EMutationType_t::rm_edge:
+            (void) rm_edge_entry(mutation.src, mutation.dst, mutation.edge_label);
+
+            //~ The pair is counted once when inserted, whereas each of its edges is counted when removed.
+            if (const auto edge_label_id = check_if_edge_label_exists(mutation.edge_label); mutation.undirected && edge_label_id.has_value())
             {
-                if (pred(curr_edge_ptr->payload[j].metadata))
-                    ret.emplace_back(curr_edge_ptr->payload[j].metadata);
+                (void) rm_edge_entry(mutation.dst, mutation.src, mutation.edge_label);
+                utils::atomic_fetch_inc(&read_edge_label_entry(*edge_label_id)->item_c);
+                utils::atomic_fetch_inc(&read_graph_metadata()->edges_c);
             }
+            break;
         }
     }
 
-    return ret;
+    undo.clear();
 }
 
-std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_view vertex_label, const std::string_view edge_label, const Id_t dst)
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::commit_transaction(STransaction_t & transaction)
 {
-    const auto dst_vertex_exists = get_vertex_by_id(dst);
-
-    if (!dst_vertex_exists.has_value())
-        return {};
+    if (transaction.mutations.empty())
+        return true;
 
-    auto dst_vertex_idx = dst_vertex_exists->ref->idx;
-    return get_edges(vertex_label, edge_label, [dst_vertex_idx](const SEdge_t & edge) -> bool { return edge.dst == dst_vertex_idx; });
-}
-
-std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const Id_t vertex_id, std::string_view edge_label, std::string_view vertex_label)
-{
-    const auto edge_label_exists   = check_if_edge_label_exists(edge_label);
-    const auto vertex_label_exists = check_if_vertex_label_exists(vertex_label);
+    //~ Readers and single mutations are held off whilst the group applies, such that none observes or interleaves with part of it.
+    std::unique_lock transaction_lock(m_transaction_lock);
+    std::unique_lock checkpoint_lock(m_checkpoint_lock);
+    const uint64_t group_addr = m_transactions->log_group(transaction.mutations);
 
-    if (!(edge_label_exists.has_value() && vertex_label_exists.has_value()))
-        return {};
+    bool prune_needed             = false;
+    std::vector<SMutation_t> undo = {};
 
-    const auto edge_label_id   = edge_label_exists.value();
-    const auto vertex_label_id = vertex_label_exists.value();
-    auto gbl_v_ptr             = m_vertices_file.read_entry(0);
-    auto gbl_label_ref_ptr     = m_label_ref_file.read_entry(0);
+    for (size_t i = 0; i < transaction.mutations.size(); i++)
+    {
+        const SMutation_t & mutation = transaction.mutations[i];
 
-    return get_edges_by_offset(vertex_id,
-                               [&gbl_v_ptr, &gbl_label_ref_ptr, &edge_label_id, &vertex_label_id](const SEdge_t & edge) -> bool
-                               {
-                                   const auto dst_vertex_ptr = gbl_v_ptr + edge.dst;
-                                   auto label_head           = dst_vertex_ptr->payload.metadata.label_id;
+        if (apply_mutation(mutation, undo) > EActionState_t::valid)
+        {
+            m_log_system->warning(fmt::format("Issue applying statement ({}) of transaction, reverting it", i));
+            undo_mutations(undo);
+
+            //~ The group is left uncommitted, such that replay skips it as a whole.
+            m_transactions->close_transaction_gracefully();
+            utils::atomic_store(&read_graph_metadata()->flush_needed, true);
+            transaction.mutations.clear();
+            return false;
+        }
 
-                                   while (label_head != END_INDEX)
-                                   {
-                                       const auto label_ptr = gbl_label_ref_ptr + label_head;
+        prune_needed = prune_needed || mutation.type == EMutationType_t::rm_vertex || (mutation.type == EMutationType_t::rm_edge && mutation.edge_label.empty());
+    }
 
-                                       for (size_t i = 0; i < label_ptr->state.size(); i++)
-                                       {
-                                           if (!label_ptr->state.test(i))
-                                               continue;
+    const bool durable = m_transactions->commit_group(group_addr);
+    if (!durable)
+        m_log_system->error("Transaction could not be made durable, it is lost once the graph is reopened");
+    utils::atomic_store(&read_graph_metadata()->flush_needed, true);
 
-                                           if (label_ptr->payload[i] == vertex_label_id && edge.edge_label_id == edge_label_id)
-                                               return true;
-                                       }
-                                       label_head = label_ptr->next;
-                                   }
+    if (prune_needed)
+        utils::atomic_store(&read_graph_metadata()->prune_needed, true);
 
-                                   return false;
-                               });
+    transaction.mutations.clear();
+    return durable;
 }
 
-std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_view vertex_label, const std::function<bool(const SEdge_t &)> & pred)
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::bulk_load(STransaction_t & batch, const bool deduplicated)
 {
-    std::vector<int64_t> label_vertices = get_vertices_offset_by_label(vertex_label);
-    std::vector<SEdge_t> ret;
-    ret.reserve(label_vertices.size());
+    std::shared_lock checkpoint_lock(m_checkpoint_lock);
 
-#pragma omp declare reduction(merge : std::vector<SEdge_t> : omp_out.insert(omp_out.end(), omp_in.begin(), omp_in.end())) initializer(omp_priv = std::vector<SEdge_t>())
-#pragma omp parallel for default(none) shared(label_vertices, pred) schedule(dynamic) reduction(merge : ret)
-    for (size_t i = 0; i < label_vertices.size(); i++)
+    std::vector<uint32_t> vertices = {};
+    std::vector<uint32_t> edges    = {};
+    uint64_t failed_c              = 0;
+
+    //~ Names are interned in order beforehand, such that the partitions solely refer to existing ids.
+    for (uint32_t i = 0; i < batch.mutations.size(); i++)
     {
-        const auto edges = get_edges_by_offset(label_vertices[i], pred);
-        ret.insert(ret.begin(), edges.begin(), edges.end());
+        const SMutation_t & mutation = batch.mutations[i];
+
+        if (mutation.type == EMutationType_t::add_vertex)
+        {
+            intern_vertex_names(std::vector<std::string_view>(mutation.labels.begin(), mutation.labels.end()), mutation.props);
+            vertices.emplace_back(i);
+        }
+        else if (mutation.type == EMutationType_t::add_edge)
+        {
+            intern_edge_names(mutation.edge_label, mutation.props);
+            edges.emplace_back(i);
+        }
+        else
+            failed_c++;
+    }
+
+    //~ Rows are settled in order before any is applied, such that each insert receives the id given by inserting the rows one by one.
+    //~ As there, a row claiming a taken id is skipped, solely an inserted vertex advancing the id an automatic row is given.
+    auto next_id                     = static_cast<Id_t>(get_num_vertices());
+    std::unordered_set<Id_t> claimed = {};
+    std::vector<uint32_t> settled    = {};
+    settled.reserve(vertices.size());
+
+    for (const uint32_t i : vertices)
+    {
+        SMutation_t & mutation = batch.mutations[i];
+        const Id_t id          = mutation.src == std::numeric_limits<Id_t>::max() ? next_id : mutation.src;
+        const bool keys_exist  = std::ranges::all_of(mutation.props, [this](const SProperty_t & prop) -> bool { return check_if_property_key_exists(prop.key).has_value(); });
+
+        if (!keys_exist || claimed.contains(id) || get_vertex_by_id(id).has_value())
+        {
+            failed_c++;
+            continue;
+        }
+
+        mutation.src = id;
+        claimed.emplace(id);
+        settled.emplace_back(i);
+        next_id++;
+    }
+
+    //~ Vertices are inserted prior to the edges, such that both endpoints of an edge exist once it is applied.
+    std::array<std::vector<uint32_t>, BATCH_PARTITION_C> partitions = partition_batch(static_cast<uint32_t>(settled.size()), [&batch, &settled](const uint32_t k) -> Id_t { return batch.mutations[settled[k]].src; });
+
+#pragma omp parallel for default(none) shared(partitions, batch, settled) reduction(+ : failed_c) schedule(dynamic, 1)
+    for (uint32_t p = 0; p < BATCH_PARTITION_C; p++)
+    {
+        for (const uint32_t k : partitions[p])
+        {
+            const SMutation_t & mutation = batch.mutations[settled[k]];
+            failed_c += add_vertex_entry(mutation.src, std::vector<std::string_view>(mutation.labels.begin(), mutation.labels.end()), mutation.props) != EActionState_t::valid;
+        }
+    }
+
+    //~ Edges of a source are appended together, filling its blocks in turn rather than interleaved with other sources.
+    //~ Unless deduplicated, the order of the rows decides which duplicate is kept, therefore it is left as given.
+    if (deduplicated)
+        std::ranges::stable_sort(edges, {}, [&batch](const uint32_t i) -> Id_t { return batch.mutations[i].src; });
+
+    std::vector<SEdgeChange_t> changes = {};
+    changes.reserve(edges.size());
+
+    for (const uint32_t i : edges)
+    {
+        const SMutation_t & mutation = batch.mutations[i];
+        changes.emplace_back(SEdgeChange_t {.src = mutation.src, .dst = mutation.dst, .edge_label = mutation.edge_label, .props = &mutation.props, .undirected = mutation.undirected});
+    }
+
+    failed_c += add_edge_entries(changes, deduplicated);
+
+    if (failed_c > 0)
+        m_log_system->warning(fmt::format("Bulk load skipped ({}) of ({}) rows", failed_c, batch.mutations.size()));
+
+    if (!batch.mutations.empty())
+        utils::atomic_store(&read_graph_metadata()->flush_needed, true);
+
+    batch.mutations.clear();
+}
+
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::finish_bulk_load()
+{
+    //~ The rows were never logged, therefore a checkpoint is the sole record recovery restores them from.
+    if (!checkpoint())
+    {
+        m_log_system->error("Bulk load could not be made durable, the rows are lost once the graph is reopened");
+        return false;
+    }
+
+    return true;
+}
+
+std::optional<graphquery::database::storage::ILPGModel::SVertex_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_vertex(const Id_t src)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    auto ptr = get_vertex_by_id(src);
+
+    if (!ptr.has_value())
+        return std::nullopt;
+
+    return ptr->ref->payload.metadata;
+}
+
+std::optional<graphquery::database::storage::Id_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_vertex_idx(const Id_t id) noexcept
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    auto vertex = get_vertex_by_id(id);
+
+    if (!vertex)
+        return std::nullopt;
+
+    return (*vertex)->idx;
+}
+
+std::optional<graphquery::database::storage::Id_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_vertex_id(const Id_t idx) noexcept
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    auto vertex = get_vertex_by_offset(idx);
+
+    if (!vertex)
+        return std::nullopt;
+
+    return (*vertex)->payload.metadata.id;
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SVertex_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_vertices(const std::function<bool(const SVertex_t &)> & pred)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    const Id_t datablock_c = utils::atomic_load(&m_vertices_file.read_metadata()->data_block_c);
+
+    std::vector<SVertex_t> ret = {};
+    ret.reserve(datablock_c);
+
+    for (Id_t i = 0; i < datablock_c; i++)
+    {
+        auto curr_vertex_ptr = m_vertices_file.read_entry(i);
+
+        if (unlikely(!(curr_vertex_ptr->state & 1 << VERTEX_INITIALISED_STATE_BIT)))
+            continue;
+
+        if (pred(curr_vertex_ptr->payload.metadata))
+            ret.emplace_back(curr_vertex_ptr->payload.metadata);
+    }
+
+    ret.shrink_to_fit();
+    return ret;
+}
+
+std::optional<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_edge(const Id_t src_vertex_id, const std::string_view edge_label, const int64_t dst_vertex_id)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    auto edge_label_id = check_if_edge_label_exists(edge_label);
+
+    if (!edge_label_id.has_value())
+        return std::nullopt;
+
+    auto pred = [dst_vertex_id](const SEdge_t & edge) -> bool { return static_cast<Id_t>(dst_vertex_id) == edge.dst; };
+
+    auto edges = get_label_edges_by_offset<false>(src_vertex_id, *edge_label_id, pred);
+
+    if (edges.empty())
+        return std::nullopt;
+
+    return edges[0];
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::function<bool(const SEdge_t &)> & pred)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    const Id_t datablock_c = utils::atomic_load(&m_edges_file.read_metadata()->data_block_c);
+
+    std::vector<SEdge_t> ret = {};
+    ret.reserve(datablock_c);
+
+    SRef_t<SEdgeDataBlock> gbl_edge_ptr = m_edges_file.read_entry(0);
+
+#pragma omp declare reduction(merge : std::vector<SEdge_t> : omp_out.insert(omp_out.end(), omp_in.begin(), omp_in.end())) initializer(omp_priv = std::vector<SEdge_t>())
+#pragma omp parallel for default(none) shared(gbl_edge_ptr, datablock_c, pred) schedule(dynamic) reduction(merge : ret)
+    for (Id_t i = 0; i < datablock_c; i++)
+    {
+        const auto curr_edge_ptr = gbl_edge_ptr + i;
+
+        for (size_t j = 0; j < curr_edge_ptr->state.size(); j++)
+        {
+            if (likely(curr_edge_ptr->state.test(j)))
+            {
+                if (pred(curr_edge_ptr->payload[j].metadata))
+                    ret.emplace_back(curr_edge_ptr->payload[j].metadata);
+            }
+        }
+    }
+
+    return ret;
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_view vertex_label, const std::string_view edge_label, const Id_t dst)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    const auto dst_vertex_exists   = get_vertex_by_id(dst);
+    const auto edge_label_exists   = check_if_edge_label_exists(edge_label);
+    const auto vertex_label_exists = check_if_vertex_label_exists(vertex_label);
+
+    if (!(dst_vertex_exists.has_value() && edge_label_exists.has_value() && vertex_label_exists.has_value()))
+        return {};
+
+    const auto dst_vertex_idx  = dst_vertex_exists->ref->idx;
+    const auto edge_label_id   = edge_label_exists.value();
+    const auto vertex_label_id = vertex_label_exists.value();
+
+    //~ Walk the incoming chain of the destination, rather than every vertex of the source label.
+    return get_label_edges_by_offset<true>(dst_vertex_idx,
+                                           edge_label_id,
+                                           [this, &vertex_label_id](const SEdge_t & edge) -> bool { return contains_vertex_label_id(edge.src, vertex_label_id); });
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const Id_t vertex_id, std::string_view edge_label, std::string_view vertex_label)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    const auto edge_label_exists   = check_if_edge_label_exists(edge_label);
+    const auto vertex_label_exists = check_if_vertex_label_exists(vertex_label);
+
+    if (!(edge_label_exists.has_value() && vertex_label_exists.has_value()))
+        return {};
+
+    const auto edge_label_id   = edge_label_exists.value();
+    const auto vertex_label_id = vertex_label_exists.value();
+    auto gbl_v_ptr             = m_vertices_file.read_entry(0);
+
+    if (vertex_label_id >= VERTEX_LABELS_MAX_AMT)
+        return {};
+
+    return get_label_edges_by_offset<false>(vertex_id,
+                                            edge_label_id,
+                                            [&gbl_v_ptr, &vertex_label_id](const SEdge_t & edge) -> bool { return (gbl_v_ptr + edge.dst)->payload.metadata.label_mask[vertex_label_id]; });
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_view vertex_label, const std::function<bool(const SEdge_t &)> & pred)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    std::vector<int64_t> label_vertices = get_vertices_offset_by_label(vertex_label);
+    std::vector<SEdge_t> ret;
+    ret.reserve(label_vertices.size());
+
+#pragma omp declare reduction(merge : std::vector<SEdge_t> : omp_out.insert(omp_out.end(), omp_in.begin(), omp_in.end())) initializer(omp_priv = std::vector<SEdge_t>())
+#pragma omp parallel for default(none) shared(label_vertices, pred) schedule(dynamic) reduction(merge : ret)
+    for (size_t i = 0; i < label_vertices.size(); i++)
+    {
+        const auto edges = get_edges_by_offset(label_vertices[i], pred);
+        ret.insert(ret.begin(), edges.begin(), edges.end());
     }
     return ret;
 }
@@ -787,6 +1900,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_
 std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_view vertex_label, const std::string_view edge_label, const std::function<bool(const SEdge_t &)> & pred)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     uint16_t label_id = {};
     if (const std::optional<uint16_t> exists = check_if_edge_label_exists(edge_label); !exists.has_value())
         return {};
@@ -798,36 +1912,15 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_
     std::vector<SEdge_t> ret;
     ret.reserve(label_vertices.size());
 
-    auto label_pred               = [&label_id, &pred](const SEdge_t & edge) -> bool { return edge.edge_label_id == label_id && pred(edge); };
+    auto label_pred               = [&pred](const SEdge_t & edge) -> bool { return pred(edge); };
     size_t labelled_vertices_size = label_vertices.size();
 
-    auto gbl_v_ptr = m_vertices_file.read_entry(0);
-    auto gbl_e_ptr = m_edges_file.read_entry(0);
-
 #pragma omp declare reduction(insert : std::vector<SEdge_t> : omp_out.insert(omp_out.end(), omp_in.begin(), omp_in.end())) initializer(omp_priv = std::vector<SEdge_t>())
 #pragma omp parallel for schedule(static) reduction(insert : ret)
     for (size_t i = 0; i < labelled_vertices_size; i++)
     {
-        auto vertex_ptr = gbl_v_ptr + label_vertices[i];
-
-        Id_t curr = utils::atomic_load(&vertex_ptr->payload.edge_idx);
-
-        while (curr != END_INDEX)
-        {
-            auto curr_edge_ptr = gbl_e_ptr + curr;
-
-            for (uint8_t p = 0, j = 0; p != curr_edge_ptr->payload_amt && j < curr_edge_ptr->payload.size();)
-            {
-                if (likely(curr_edge_ptr->state.test(j)))
-                {
-                    if (label_pred(curr_edge_ptr->payload[j].metadata))
-                        ret.insert(ret.end(), curr_edge_ptr->payload[j].metadata);
-                    p++;
-                }
-                j++;
-            }
-            curr = curr_edge_ptr->next;
-        }
+        const auto edges = get_label_edges_by_offset<false>(label_vertices[i], label_id, label_pred);
+        ret.insert(ret.end(), edges.begin(), edges.end());
     }
 
     ret.shrink_to_fit();
@@ -837,6 +1930,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_
 std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_view vertex_label, const std::string_view edge_label)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     uint16_t label_id = {};
     if (const std::optional<uint16_t> exists = check_if_edge_label_exists(edge_label); !exists.has_value())
         return {};
@@ -848,36 +1942,15 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_
     std::vector<SEdge_t> ret;
     ret.reserve(label_vertices.size() * get_avg_out_degree());
 
-    auto label_pred               = [&label_id](const SEdge_t & edge) -> bool { return edge.edge_label_id == label_id; };
+    auto label_pred               = [](const SEdge_t &) -> bool { return true; };
     size_t labelled_vertices_size = label_vertices.size();
 
-    auto gbl_v_ptr = m_vertices_file.read_entry(0);
-    auto gbl_e_ptr = m_edges_file.read_entry(0);
-
 #pragma omp declare reduction(insert : std::vector<SEdge_t> : omp_out.insert(omp_out.end(), omp_in.begin(), omp_in.end())) initializer(omp_priv = std::vector<SEdge_t>())
 #pragma omp parallel for schedule(static) reduction(insert : ret)
     for (size_t i = 0; i < labelled_vertices_size; i++)
     {
-        auto vertex_ptr = gbl_v_ptr + label_vertices[i];
-
-        Id_t curr = utils::atomic_load(&vertex_ptr->payload.edge_idx);
-
-        while (curr != END_INDEX)
-        {
-            auto curr_edge_ptr = gbl_e_ptr + curr;
-
-            for (uint8_t p = 0, j = 0; p != curr_edge_ptr->payload_amt && j < curr_edge_ptr->payload.size();)
-            {
-                if (likely(curr_edge_ptr->state.test(j)))
-                {
-                    if (label_pred(curr_edge_ptr->payload[j].metadata))
-                        ret.insert(ret.end(), curr_edge_ptr->payload[j].metadata);
-                    p++;
-                }
-                j++;
-            }
-            curr = curr_edge_ptr->next;
-        }
+        const auto edges = get_label_edges_by_offset<false>(label_vertices[i], label_id, label_pred);
+        ret.insert(ret.end(), edges.begin(), edges.end());
     }
 
     ret.shrink_to_fit();
@@ -887,6 +1960,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_
 std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_view vertex_label, const std::string_view edge_label, const std::string_view dst_vertex_label)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     uint16_t edge_label_id  = {};
     uint16_t dst_v_label_id = {};
 
@@ -903,36 +1977,17 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_
 
     std::vector<SEdge_t> ret;
     ret.reserve(label_vertices.size());
-    auto gbl_v_ptr         = m_vertices_file.read_entry(0);
-    auto gbl_label_ref_ptr = m_label_ref_file.read_entry(0);
-
-    auto label_pred = [&gbl_v_ptr, &gbl_label_ref_ptr, edge_label_id, dst_v_label_id](const SEdge_t & edge) -> bool
-    {
-        const auto dst_vertex_ptr = gbl_v_ptr + edge.dst;
-        auto label_head           = dst_vertex_ptr->payload.metadata.label_id;
-
-        while (label_head != END_INDEX)
-        {
-            const auto label_ptr = gbl_label_ref_ptr + label_head;
-
-            for (size_t i = 0; i < label_ptr->state.size(); i++)
-            {
-                if (!label_ptr->state.test(i))
-                    continue;
+    auto gbl_v_ptr = m_vertices_file.read_entry(0);
 
-                if (label_ptr->payload[i] == dst_v_label_id && edge.edge_label_id == edge_label_id)
-                    return true;
-            }
-            label_head = label_ptr->next;
-        }
+    if (dst_v_label_id >= VERTEX_LABELS_MAX_AMT)
+        return {};
 
-        return false;
-    };
+    auto label_pred = [&gbl_v_ptr, dst_v_label_id](const SEdge_t & edge) -> bool { return (gbl_v_ptr + edge.dst)->payload.metadata.label_mask[dst_v_label_id]; };
 
     // Parallel loop with reduction clause
     for (const long label_vertex : label_vertices)
     {
-        auto edges = get_edges_by_offset(label_vertex, label_pred);
+        auto edges = get_label_edges_by_offset<false>(label_vertex, edge_label_id, label_pred);
         ret.insert(ret.end(), edges.begin(), edges.end());
     }
 
@@ -940,7 +1995,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const std::string_
 }
 
 std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const uint32_t vertex_id, const std::function<bool(const SEdge_t &)> & pred)
+graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const Id_t vertex_id, const std::function<bool(const SEdge_t &)> & pred)
 {
     auto vertex_ptr          = get_vertex_by_offset(vertex_id);
     std::vector<SEdge_t> ret = {};
@@ -948,6 +2003,9 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const ui
     if (!vertex_ptr.has_value())
         return ret;
 
+    if (auto csr_edges = get_csr_edges_by_offset(vertex_id, pred); csr_edges.has_value())
+        return std::move(*csr_edges);
+
     const auto neighbours = utils::atomic_load(&vertex_ptr.value()->payload.metadata.outdegree);
     ret.reserve(neighbours);
 
@@ -972,7 +2030,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const ui
 }
 
 std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const uint32_t src_vertex_id, const uint32_t dst_vertex_id)
+graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const Id_t src_vertex_id, const Id_t dst_vertex_id)
 {
     auto src_vertex_ptr      = get_vertex_by_offset(src_vertex_id);
     auto dst_vertex_ptr      = get_vertex_by_offset(dst_vertex_id);
@@ -981,10 +2039,14 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const ui
     if (!(src_vertex_ptr.has_value() && dst_vertex_ptr.has_value()))
         return ret;
 
-    ret.reserve(utils::atomic_load(&src_vertex_ptr.value()->payload.metadata.outdegree));
-    uint32_t curr           = utils::atomic_load(&src_vertex_ptr.value()->payload.edge_idx);
     auto dst_vertex_ptr_idx = utils::atomic_load(&dst_vertex_ptr->ref->idx);
 
+    if (auto csr_edges = get_csr_edges_by_offset(src_vertex_id, [&dst_vertex_ptr_idx](const SEdge_t & edge) -> bool { return edge.dst == dst_vertex_ptr_idx; }); csr_edges.has_value())
+        return std::move(*csr_edges);
+
+    ret.reserve(utils::atomic_load(&src_vertex_ptr.value()->payload.metadata.outdegree));
+    Id_t curr = utils::atomic_load(&src_vertex_ptr.value()->payload.edge_idx);
+
     auto gbl_edge_ptr = m_edges_file.read_entry(0);
     while (curr != END_INDEX)
     {
@@ -1007,7 +2069,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const ui
 }
 
 std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const uint32_t src_vertex_id, const uint32_t dst_vertex_id, const std::function<bool(const SEdge_t &)> & pred)
+graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const Id_t src_vertex_id, const Id_t dst_vertex_id, const std::function<bool(const SEdge_t &)> & pred)
 {
     auto src_vertex_ptr      = get_vertex_by_offset(src_vertex_id);
     auto dst_vertex_ptr      = get_vertex_by_offset(dst_vertex_id);
@@ -1016,12 +2078,15 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const ui
     if (!(src_vertex_ptr.has_value() && dst_vertex_ptr.has_value()))
         return ret;
 
-    ret.reserve(utils::atomic_load(&src_vertex_ptr.value()->payload.metadata.outdegree));
-    uint32_t curr           = utils::atomic_load(&src_vertex_ptr.value()->payload.edge_idx);
     auto dst_vertex_ptr_idx = utils::atomic_load(&dst_vertex_ptr->ref->idx);
-
     const auto pred_dst_idx = [&dst_vertex_ptr_idx, &pred](const SEdge_t & edge) -> bool { return edge.dst == dst_vertex_ptr_idx && pred(edge); };
-    auto gbl_edge_ptr       = m_edges_file.read_entry(0);
+
+    if (auto csr_edges = get_csr_edges_by_offset(src_vertex_id, pred_dst_idx); csr_edges.has_value())
+        return std::move(*csr_edges);
+
+    ret.reserve(utils::atomic_load(&src_vertex_ptr.value()->payload.metadata.outdegree));
+    Id_t curr         = utils::atomic_load(&src_vertex_ptr.value()->payload.edge_idx);
+    auto gbl_edge_ptr = m_edges_file.read_entry(0);
     while (curr != END_INDEX)
     {
         auto curr_edge_ptr = gbl_edge_ptr + curr;
@@ -1043,30 +2108,35 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const ui
 }
 
 std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const uint32_t vertex_id, const uint16_t edge_label_id, const std::function<bool(const SEdge_t &)> & pred)
+graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_offset(const Id_t vertex_id, const uint16_t edge_label_id, const std::function<bool(const SEdge_t &)> & pred)
 {
-    const auto edge_label_pred = [&edge_label_id, &pred](const SEdge_t & edge) -> bool { return edge.edge_label_id == edge_label_id && pred(edge); };
-
-    return get_edges_by_offset(vertex_id, edge_label_pred);
+    return get_label_edges_by_offset<false>(vertex_id, edge_label_id, pred);
 }
 
+template<bool incoming>
 std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_id(const Id_t src, const std::function<bool(const SEdge_t &)> & pred)
+graphquery::database::storage::CMemoryModelMMAPLPG::get_label_edges_by_offset(const Id_t vertex_id, const uint16_t edge_label_id, const std::function<bool(const SEdge_t &)> & pred)
 {
-    const auto vertex_ptr    = get_vertex_by_id(src);
+    auto vertex_ptr          = get_vertex_by_offset(vertex_id);
     std::vector<SEdge_t> ret = {};
 
-    if (unlikely(!vertex_ptr.has_value()))
+    if (!vertex_ptr.has_value())
         return ret;
 
-    ret.reserve(utils::atomic_load(&vertex_ptr->ref->payload.metadata.outdegree));
-    uint32_t curr     = utils::atomic_load(&vertex_ptr->ref->payload.edge_idx);
-    auto gbl_edge_ptr = m_edges_file.read_entry(0);
+    const auto label_dir_idx = utils::atomic_load(&vertex_ptr.value()->payload.label_dir_idx);
+    vertex_ptr.value().~SRef_t();
+
+    //~ Only the blocks of the label segment are touched, which are contiguous within the chain.
+    Id_t curr         = get_label_edge_head(label_dir_idx, edge_label_id, incoming);
+    auto gbl_edge_ptr = incoming ? m_in_edges_file.read_entry(0) : m_edges_file.read_entry(0);
 
     while (curr != END_INDEX)
     {
         auto curr_edge_ptr = gbl_edge_ptr + curr;
 
+        if (curr_edge_ptr->payload[0].metadata.edge_label_id != edge_label_id)
+            break;
+
         for (size_t i = 0; i < curr_edge_ptr->state.size(); i++)
         {
             if (likely(curr_edge_ptr->state.test(i)))
@@ -1077,7 +2147,69 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_id(const Id_t s
         }
         curr = curr_edge_ptr->next;
     }
-
+    return ret;
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_id(const Id_t src, const std::function<bool(const SEdge_t &)> & pred)
+{
+    const auto vertex_ptr    = get_vertex_by_id(src);
+    std::vector<SEdge_t> ret = {};
+
+    if (unlikely(!vertex_ptr.has_value()))
+        return ret;
+
+    ret.reserve(utils::atomic_load(&vertex_ptr->ref->payload.metadata.outdegree));
+    Id_t curr         = utils::atomic_load(&vertex_ptr->ref->payload.edge_idx);
+    auto gbl_edge_ptr = m_edges_file.read_entry(0);
+
+    while (curr != END_INDEX)
+    {
+        auto curr_edge_ptr = gbl_edge_ptr + curr;
+
+        for (size_t i = 0; i < curr_edge_ptr->state.size(); i++)
+        {
+            if (likely(curr_edge_ptr->state.test(i)))
+            {
+                if (pred(curr_edge_ptr->payload[i].metadata))
+                    ret.emplace_back(curr_edge_ptr->payload[i].metadata);
+            }
+        }
+        curr = curr_edge_ptr->next;
+    }
+
+    ret.shrink_to_fit();
+    return ret;
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_in_edges_by_offset(const Id_t vertex_id, const std::function<bool(const SEdge_t &)> & pred)
+{
+    auto vertex_ptr          = get_vertex_by_offset(vertex_id);
+    std::vector<SEdge_t> ret = {};
+
+    if (!vertex_ptr.has_value())
+        return ret;
+
+    ret.reserve(utils::atomic_load(&vertex_ptr.value()->payload.metadata.indegree));
+    Id_t curr            = utils::atomic_load(&vertex_ptr.value()->payload.in_edge_idx);
+    auto gbl_in_edge_ptr = m_in_edges_file.read_entry(0);
+
+    while (curr != END_INDEX)
+    {
+        auto curr_edge_ptr = gbl_in_edge_ptr + curr;
+
+        for (size_t i = 0; i < curr_edge_ptr->state.size(); i++)
+        {
+            if (likely(curr_edge_ptr->state.test(i)))
+            {
+                if (pred(curr_edge_ptr->payload[i].metadata))
+                    ret.emplace_back(curr_edge_ptr->payload[i].metadata);
+            }
+        }
+        curr = curr_edge_ptr->next;
+    }
+
     ret.shrink_to_fit();
     return ret;
 }
@@ -1085,22 +2217,48 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_id(const Id_t s
 std::unique_ptr<std::vector<std::vector<int64_t>>>
 graphquery::database::storage::CMemoryModelMMAPLPG::make_inverse_graph() noexcept
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     auto inv_graph = std::make_unique<std::vector<std::vector<int64_t>>>();
     auto vblock_c  = m_vertices_file.read_metadata()->data_block_c;
-    auto eblock_c  = m_edges_file.read_metadata()->data_block_c;
 
     inv_graph->resize(vblock_c);
-    SRef_t<SEdgeDataBlock> e_ptr = m_edges_file.read_entry(0);
 
-    for (Id_t i = 0; i < eblock_c; i++)
+    //~ Read the incoming neighbours from the csc arrays of the snapshot, when valid.
+    if (std::shared_lock csr_lock(m_csr_lock, std::try_to_lock); csr_lock.owns_lock() && check_if_csr_valid())
     {
-        const auto lcl_e_ptr = e_ptr + i;
-        for (size_t j = 0; j < lcl_e_ptr->state.size(); j++)
-        {
-            if (!lcl_e_ptr->state.test(j))
-                continue;
+        const int64_t vertex_c = std::min<int64_t>(utils::atomic_load(&m_csr_file.read_metadata()->vertex_c), vblock_c);
+        const auto in_offsets  = m_csr_file.read_in_offsets().ref;
+        const auto in_src      = m_csr_file.read_in_src().ref;
+
+#pragma omp parallel for default(none) shared(inv_graph, in_offsets, in_src, vertex_c) schedule(static)
+        for (int64_t i = 0; i < vertex_c; i++)
+            (*inv_graph)[i].assign(in_src + in_offsets[i], in_src + in_offsets[i + 1]);
+
+        return inv_graph;
+    }
+
+    //~ Otherwise, read the incoming chain of each vertex.
+    auto gbl_vertex_ptr  = m_vertices_file.read_entry(0).ref;
+    auto gbl_in_edge_ptr = m_in_edges_file.read_entry(0).ref;
 
-            (*inv_graph)[e_ptr->payload[j].metadata.dst].emplace_back(e_ptr->payload[j].metadata.src);
+#pragma omp parallel for default(none) shared(inv_graph, gbl_vertex_ptr, gbl_in_edge_ptr, vblock_c) schedule(dynamic, 1024)
+    for (Id_t i = 0; i < vblock_c; i++)
+    {
+        const auto vertex_ptr = gbl_vertex_ptr + i;
+        if (unlikely(!(vertex_ptr->state & 1 << VERTEX_INITIALISED_STATE_BIT)))
+            continue;
+
+        (*inv_graph)[i].reserve(vertex_ptr->payload.metadata.indegree);
+        Id_t curr = vertex_ptr->payload.in_edge_idx;
+        while (curr != END_INDEX)
+        {
+            const auto in_edge_ptr = gbl_in_edge_ptr + curr;
+            for (size_t j = 0; j < in_edge_ptr->state.size(); j++)
+            {
+                if (in_edge_ptr->state.test(j))
+                    (*inv_graph)[i].emplace_back(in_edge_ptr->payload[j].metadata.src);
+            }
+            curr = in_edge_ptr->next;
         }
     }
 
@@ -1110,6 +2268,28 @@ graphquery::database::storage::CMemoryModelMMAPLPG::make_inverse_graph() noexcep
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::edgemap(const std::unique_ptr<analytic::IRelax> & relax) noexcept
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
+    if (!check_if_csr_valid())
+        build_csr_snapshot();
+
+    //~ Stream the dense outgoing arrays of the snapshot, when valid.
+    if (std::shared_lock csr_lock(m_csr_lock, std::try_to_lock); csr_lock.owns_lock() && check_if_csr_valid())
+    {
+        const auto scan        = m_csr_file.get_file().scoped_access(CDiskDriver::EAccessHint_t::sequential);
+        const int64_t vertex_c = utils::atomic_load(&m_csr_file.read_metadata()->vertex_c);
+        const auto out_offsets = m_csr_file.read_out_offsets().ref;
+        const auto out_dst     = m_csr_file.read_out_dst().ref;
+
+#pragma omp parallel for default(none) firstprivate(out_offsets, out_dst, vertex_c) shared(relax) schedule(dynamic, 1024)
+        for (int64_t i = 0; i < vertex_c; i++)
+        {
+            for (int64_t e = out_offsets[i]; e < out_offsets[i + 1]; e++)
+                relax->relax(i, out_dst[e]);
+        }
+        return;
+    }
+
+    const auto scan        = m_edges_file.scoped_scan();
     const auto datablock_c = utils::atomic_load(&m_edges_file.read_metadata()->data_block_c);
     auto gbl_curr_edge_ptr = m_edges_file.read_entry(0).ref;
 
@@ -1136,6 +2316,20 @@ graphquery::database::storage::CMemoryModelMMAPLPG::edgemap(const std::unique_pt
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::src_edgemap(const Id_t vertex_offset, const std::function<void(int64_t src, int64_t dst)> & relax)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
+    if (std::shared_lock csr_lock(m_csr_lock, std::try_to_lock); csr_lock.owns_lock() && check_if_csr_valid())
+    {
+        if (static_cast<int64_t>(vertex_offset) >= utils::atomic_load(&m_csr_file.read_metadata()->vertex_c))
+            return;
+
+        const auto out_offsets = m_csr_file.read_out_offsets().ref;
+        const auto out_dst     = m_csr_file.read_out_dst().ref;
+
+        for (int64_t e = out_offsets[vertex_offset]; e < out_offsets[vertex_offset + 1]; e++)
+            relax(vertex_offset, out_dst[e]);
+        return;
+    }
+
     const auto v_ptr = m_vertices_file.read_entry(vertex_offset).ref;
 
     auto gbl_edge_ptr = m_edges_file.read_entry(0).ref;
@@ -1146,7 +2340,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::src_edgemap(const Id_t verte
 
         for (uint8_t p = 0, j = 0; p != e_ptr->payload_amt && j < e_ptr->payload.size();)
         {
-            if (!e_ptr->state.test(j))
+            if (e_ptr->state.test(j))
             {
                 relax(e_ptr->payload[j].metadata.src, e_ptr->payload[j].metadata.dst);
                 p++;
@@ -1157,10 +2351,47 @@ graphquery::database::storage::CMemoryModelMMAPLPG::src_edgemap(const Id_t verte
     }
 }
 
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::dst_edgemap(const Id_t vertex_offset, const std::function<bool(int64_t src, int64_t dst)> & relax)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    if (std::shared_lock csr_lock(m_csr_lock, std::try_to_lock); csr_lock.owns_lock() && check_if_csr_valid())
+    {
+        if (static_cast<int64_t>(vertex_offset) >= utils::atomic_load(&m_csr_file.read_metadata()->vertex_c))
+            return;
+
+        const auto in_offsets = m_csr_file.read_in_offsets().ref;
+        const auto in_src     = m_csr_file.read_in_src().ref;
+
+        for (int64_t e = in_offsets[vertex_offset]; e < in_offsets[vertex_offset + 1]; e++)
+            if (relax(in_src[e], vertex_offset))
+                return;
+        return;
+    }
+
+    const auto v_ptr = m_vertices_file.read_entry(vertex_offset).ref;
+
+    auto gbl_in_edge_ptr = m_in_edges_file.read_entry(0).ref;
+    auto in_edge_head    = v_ptr->payload.in_edge_idx;
+    while (in_edge_head != END_INDEX)
+    {
+        auto e_ptr = gbl_in_edge_ptr + in_edge_head;
+
+        for (size_t j = 0; j < e_ptr->state.size(); j++)
+        {
+            if (e_ptr->state.test(j) && relax(e_ptr->payload[j].metadata.src, e_ptr->payload[j].metadata.dst))
+                return;
+        }
+        in_edge_head = e_ptr->next;
+    }
+}
+
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::persist_graph_changes() noexcept
 {
-    const auto datablock_c = utils::atomic_load(&m_vertices_file.read_metadata()->data_block_c);
+    const auto vertices_scan = m_vertices_file.scoped_scan();
+    const auto edges_scan    = m_edges_file.scoped_scan();
+    const auto datablock_c   = utils::atomic_load(&m_vertices_file.read_metadata()->data_block_c);
 
     auto gbl_vertex_ptr = m_vertices_file.read_entry(0);
     auto gbl_edge_ptr   = m_edges_file.read_entry(0);
@@ -1170,8 +2401,8 @@ graphquery::database::storage::CMemoryModelMMAPLPG::persist_graph_changes() noex
         if (unlikely(!(src_vertex_ptr->state & 1 << VERTEX_INITIALISED_STATE_BIT)))
             continue;
 
-        uint32_t edge_ref      = src_vertex_ptr->payload.edge_idx;
-        uint32_t prev_edge_ref = edge_ref;
+        Id_t edge_ref      = src_vertex_ptr->payload.edge_idx;
+        Id_t prev_edge_ref = edge_ref;
         while (edge_ref != END_INDEX)
         {
             auto edge_ptr = gbl_edge_ptr + edge_ref;
@@ -1191,16 +2422,14 @@ graphquery::database::storage::CMemoryModelMMAPLPG::persist_graph_changes() noex
                         utils::atomic_fetch_dec(&dst_vertex_ptr->payload.metadata.indegree);
                         utils::atomic_fetch_dec(&src_vertex_ptr->payload.metadata.outdegree);
                         utils::atomic_fetch_dec(&read_edge_label_entry(edge_ptr->payload[j].metadata.edge_label_id)->item_c);
+                        update_edge_version();
 
                         // Mark deletion to properties
                         m_properties_file.foreach_block(edge_ptr->payload[j].metadata.property_id,
                                                         [this](SRef_t<SPropertyDataBlock> & prop_block_ptr) -> void { m_properties_file.append_free_data_block(prop_block_ptr->idx); });
 
                         if (dst_vertex_ptr->payload.metadata.indegree == 0)
-                        {
-                            utils::atomic_store(&m_index_file.read_entry(dst_vertex_ptr->payload.metadata.id)->set, 0);
-                            m_vertices_file.append_free_data_block(dst_vertex_ptr->idx);
-                        }
+                            free_vertex_entry(dst_vertex_ptr->payload.metadata, dst_vertex_ptr->idx);
                     }
                     p++;
                 }
@@ -1209,20 +2438,23 @@ graphquery::database::storage::CMemoryModelMMAPLPG::persist_graph_changes() noex
 
             if (edge_ptr->payload_amt == 0)
             {
+                const auto next_edge_ref = edge_ptr->next;
+                update_label_edge_head(src_vertex_ptr->payload.label_dir_idx, edge_ptr->payload[0].metadata.edge_label_id, false, edge_ref, next_edge_ref);
+
+                //~ The previous block remains unchanged when unlinking, unless the head itself was unlinked.
                 if (prev_edge_ref == edge_ref)
                 {
-                    src_vertex_ptr->payload.edge_idx = edge_ptr->next;
+                    src_vertex_ptr->payload.edge_idx = next_edge_ref;
+                    prev_edge_ref                    = next_edge_ref;
                 }
                 else
                 {
                     auto prev_edge_ptr  = gbl_edge_ptr + prev_edge_ref;
-                    prev_edge_ptr->next = edge_ptr->next;
+                    prev_edge_ptr->next = next_edge_ref;
                 }
 
-                prev_edge_ref = edge_ref;
-                edge_ref      = edge_ptr->next;
-
                 m_edges_file.append_free_data_block(edge_ptr->idx);
+                edge_ref = next_edge_ref;
             }
             else
             {
@@ -1233,9 +2465,164 @@ graphquery::database::storage::CMemoryModelMMAPLPG::persist_graph_changes() noex
     }
 }
 
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::build_csr_snapshot() noexcept
+{
+    //~ Taken once the running mutations drain, such that the snapshot never holds part of a transaction.
+    std::unique_lock checkpoint_lock(m_checkpoint_lock);
+    std::unique_lock csr_lock(m_csr_lock);
+
+    const auto version     = utils::atomic_load(&read_graph_metadata()->edge_version);
+    const int64_t vblock_c = utils::atomic_load(&m_vertices_file.read_metadata()->data_block_c);
+
+    std::vector<int64_t> out_offsets(vblock_c + 1, 0);
+    std::vector<int64_t> in_offsets(vblock_c + 1, 0);
+
+    {
+        auto gbl_vertex_ptr = m_vertices_file.read_entry(0).ref;
+        auto gbl_edge_ptr   = m_edges_file.read_entry(0).ref;
+
+        //~ First pass, count the live edges of each chain for both directions.
+#pragma omp parallel for default(none) firstprivate(gbl_vertex_ptr, gbl_edge_ptr, vblock_c) shared(out_offsets, in_offsets) schedule(dynamic, 1024)
+        for (int64_t i = 0; i < vblock_c; i++)
+        {
+            const auto vertex_ptr = gbl_vertex_ptr + i;
+            if (unlikely(!(vertex_ptr->state & 1 << VERTEX_INITIALISED_STATE_BIT)))
+                continue;
+
+            Id_t curr = vertex_ptr->payload.edge_idx;
+            while (curr != END_INDEX)
+            {
+                const auto edge_ptr = gbl_edge_ptr + curr;
+                for (size_t j = 0; j < edge_ptr->state.size(); j++)
+                {
+                    if (!edge_ptr->state.test(j) || static_cast<int64_t>(edge_ptr->payload[j].metadata.dst) >= vblock_c)
+                        continue;
+
+                    out_offsets[i + 1]++;
+                    utils::atomic_fetch_inc(&in_offsets[edge_ptr->payload[j].metadata.dst + 1]);
+                }
+                curr = edge_ptr->next;
+            }
+        }
+    }
+
+    for (int64_t i = 0; i < vblock_c; i++)
+    {
+        out_offsets[i + 1] += out_offsets[i];
+        in_offsets[i + 1] += in_offsets[i];
+    }
+
+    const int64_t edge_c = out_offsets[vblock_c];
+    m_csr_file.allocate(vblock_c, edge_c);
+
+    {
+        auto gbl_vertex_ptr = m_vertices_file.read_entry(0).ref;
+        auto gbl_edge_ptr   = m_edges_file.read_entry(0).ref;
+        auto csr_out_offset = m_csr_file.read_out_offsets();
+        auto csr_out_dst    = m_csr_file.read_out_dst();
+        auto csr_out_attr   = m_csr_file.read_out_attr();
+        auto csr_in_offset  = m_csr_file.read_in_offsets();
+        auto csr_in_src     = m_csr_file.read_in_src();
+
+        std::copy(out_offsets.begin(), out_offsets.end(), csr_out_offset.ref);
+        std::copy(in_offsets.begin(), in_offsets.end(), csr_in_offset.ref);
+
+        auto out_dst    = csr_out_dst.ref;
+        auto out_attr   = csr_out_attr.ref;
+        auto in_bounds  = csr_in_offset.ref;
+        auto in_src     = csr_in_src.ref;
+        auto in_cursors = std::move(in_offsets);
+
+        //~ Second pass, scatter the chains into the dense arrays. Bounds are kept against the first pass,
+        //~ such that a concurrent mutation can only lead to an unpublished snapshot.
+#pragma omp parallel for default(none) firstprivate(gbl_vertex_ptr, gbl_edge_ptr, vblock_c, out_dst, out_attr, in_bounds, in_src) shared(out_offsets, in_cursors) schedule(dynamic, 1024)
+        for (int64_t i = 0; i < vblock_c; i++)
+        {
+            const auto vertex_ptr = gbl_vertex_ptr + i;
+            if (unlikely(!(vertex_ptr->state & 1 << VERTEX_INITIALISED_STATE_BIT)))
+                continue;
+
+            int64_t pos = out_offsets[i];
+            Id_t curr   = vertex_ptr->payload.edge_idx;
+            while (curr != END_INDEX && pos < out_offsets[i + 1])
+            {
+                const auto edge_ptr = gbl_edge_ptr + curr;
+                for (size_t j = 0; j < edge_ptr->state.size() && pos < out_offsets[i + 1]; j++)
+                {
+                    if (!edge_ptr->state.test(j) || static_cast<int64_t>(edge_ptr->payload[j].metadata.dst) >= vblock_c)
+                        continue;
+
+                    const SEdge_t & edge = edge_ptr->payload[j].metadata;
+                    out_dst[pos]         = edge.dst;
+                    out_attr[pos]        = {edge.property_id, edge.edge_label_id, edge.property_c};
+                    pos++;
+
+                    if (const auto in_pos = utils::atomic_fetch_inc(&in_cursors[edge.dst]); in_pos < in_bounds[edge.dst + 1])
+                        in_src[in_pos] = i;
+                }
+                curr = edge_ptr->next;
+            }
+        }
+    }
+
+    if (utils::atomic_load(&read_graph_metadata()->edge_version) == version)
+        m_csr_file.publish(version);
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::update_edge_version() noexcept
+{
+    utils::atomic_fetch_inc(&read_graph_metadata()->edge_version);
+}
+
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::check_if_csr_valid() noexcept
+{
+    return m_csr_file.is_valid(utils::atomic_load(&read_graph_metadata()->edge_version));
+}
+
+std::optional<std::vector<graphquery::database::storage::ILPGModel::SEdge_t>>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_csr_edges_by_offset(const Id_t vertex_id, const std::function<bool(const SEdge_t &)> & pred) noexcept
+{
+    std::shared_lock csr_lock(m_csr_lock, std::try_to_lock);
+
+    if (!(csr_lock.owns_lock() && check_if_csr_valid()))
+        return std::nullopt;
+
+    std::vector<SEdge_t> ret = {};
+    if (static_cast<int64_t>(vertex_id) >= utils::atomic_load(&m_csr_file.read_metadata()->vertex_c))
+        return ret;
+
+    const auto out_offsets = m_csr_file.read_out_offsets();
+    const auto out_dst     = m_csr_file.read_out_dst();
+    const auto out_attr    = m_csr_file.read_out_attr();
+    const int64_t begin    = out_offsets.ref[vertex_id];
+    const int64_t end      = out_offsets.ref[vertex_id + 1];
+
+    ret.reserve(end - begin);
+    SEdge_t edge = {};
+    edge.src     = vertex_id;
+
+    for (int64_t e = begin; e < end; e++)
+    {
+        edge.dst           = out_dst.ref[e];
+        edge.property_id   = out_attr.ref[e].property_id;
+        edge.edge_label_id = out_attr.ref[e].edge_label_id;
+        edge.property_c    = out_attr.ref[e].property_c;
+
+        if (pred(edge))
+            ret.emplace_back(edge);
+    }
+
+    ret.shrink_to_fit();
+    return ret;
+}
+
 std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const Id_t src, const Id_t dst)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     auto src_vertex_ptr = get_vertex_by_id(src);
     auto dst_vertex_ptr = get_vertex_by_id(dst);
 
@@ -1261,6 +2648,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges_by_label(const std
 std::vector<graphquery::database::storage::ILPGModel::SVertex_t>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_vertices_by_label(const std::string_view label)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     const std::optional<uint16_t> exists = check_if_vertex_label_exists(label);
 
     if (!exists.has_value())
@@ -1271,7 +2659,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_vertices_by_label(const
     std::vector<SVertex_t> ret = {};
     ret.reserve(m_label_vertex[label_id].size());
 
-    for (const uint32_t vertex_offset : m_label_vertex[label_id])
+    for (const Id_t vertex_offset : m_label_vertex[label_id])
     {
         auto vertex_ptr = get_vertex_by_offset(vertex_offset);
 
@@ -1297,7 +2685,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_vertices_offset_by_label
     std::vector<int64_t> ret = {};
     ret.reserve(m_label_vertex[label_id].size());
 
-    for (const uint32_t vertex_offset : m_label_vertex[label_id])
+    for (const Id_t vertex_offset : m_label_vertex[label_id])
         ret.emplace_back(vertex_offset);
 
     return ret;
@@ -1306,6 +2694,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_vertices_offset_by_label
 std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const Id_t src, const std::string_view edge_label, const std::string_view vertex_label)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     const auto src_vertex_ptr      = get_vertex_by_id(src);
     const auto vertex_label_exists = check_if_vertex_label_exists(vertex_label);
     const auto edge_label_exists   = check_if_edge_label_exists(edge_label);
@@ -1323,6 +2712,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edges(const Id_t src, co
 std::unordered_set<graphquery::database::storage::Id_t>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_edge_dst_vertices(const Id_t src, [[maybe_unused]] const std::function<bool(const SEdge_t &)> & pred)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     auto vertex_ptr = get_vertex_by_id(src);
 
     if (unlikely(!vertex_ptr.has_value()))
@@ -1334,7 +2724,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edge_dst_vertices(const
     ret.reserve(neighbours);
 
     auto gbl_edge_ptr = m_edges_file.read_entry(0);
-    uint32_t curr     = utils::atomic_load(&(*vertex_ptr)->payload.edge_idx);
+    Id_t curr         = utils::atomic_load(&(*vertex_ptr)->payload.edge_idx);
 
     while (curr != END_INDEX)
     {
@@ -1358,40 +2748,30 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_edge_dst_vertices(const
 std::unordered_set<graphquery::database::storage::Id_t>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_edge_dst_vertices(const Id_t src, const std::string_view edge_label, const std::string_view vertex_label)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     const std::optional<uint16_t> vertex_label_exists = check_if_vertex_label_exists(vertex_label);
     const std::optional<uint16_t> edge_label_exists   = check_if_edge_label_exists(edge_label);
 
     if (!(vertex_label_exists.has_value() && edge_label_exists.has_value()))
         return {};
 
-    auto vertex_label_id   = vertex_label_exists.value();
-    auto edge_label_id     = edge_label_exists.value();
-    auto gbl_v_ptr         = m_vertices_file.read_entry(0);
-    auto gbl_label_ref_ptr = m_label_ref_file.read_entry(0);
+    const auto vertex_ptr = get_vertex_by_id(src);
 
-    return get_edge_dst_vertices(src,
-                                 [&gbl_label_ref_ptr, &gbl_v_ptr, &vertex_label_id, &edge_label_id](const SEdge_t & edge) -> bool
-                                 {
-                                     const auto dst_vertex_ptr = gbl_v_ptr + edge.dst;
-                                     auto label_head           = dst_vertex_ptr->payload.metadata.label_id;
+    if (unlikely(!vertex_ptr.has_value()))
+        return {};
 
-                                     while (label_head != END_INDEX)
-                                     {
-                                         const auto label_ptr = gbl_label_ref_ptr + label_head;
+    const auto vertex_label_id = vertex_label_exists.value();
+    const auto edge_label_id   = edge_label_exists.value();
+    const auto src_idx         = vertex_ptr->ref->idx;
+    const auto edges           = get_label_edges_by_offset<false>(src_idx, edge_label_id, [this, &vertex_label_id](const SEdge_t & edge) -> bool { return contains_vertex_label_id(edge.dst, vertex_label_id); });
 
-                                         for (size_t i = 0; i < label_ptr->state.size(); i++)
-                                         {
-                                             if (!label_ptr->state.test(i))
-                                                 continue;
+    std::unordered_set<Id_t> ret = {};
+    ret.reserve(edges.size());
 
-                                             if (label_ptr->payload[i] == vertex_label_id && edge.edge_label_id == edge_label_id)
-                                                 return true;
-                                         }
-                                         label_head = label_ptr->next;
-                                     }
+    for (const auto & edge : edges)
+        ret.insert(edge.dst);
 
-                                     return false;
-                                 });
+    return ret;
 }
 
 std::vector<graphquery::database::storage::ILPGModel::SEdge_t>
@@ -1424,6 +2804,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_recursive_edges(const Id
 std::vector<graphquery::database::storage::ILPGModel::SProperty_t>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_vertex(const Id_t src)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     SRef_t<SVertexDataBlock> src_vertex = {};
     std::vector<SProperty_t> ret        = {};
 
@@ -1444,7 +2825,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_vertex(con
         for (size_t i = 0; i < property_ptr->state.size(); i++)
         {
             if (likely(property_ptr->state.test(i)))
-                ret.emplace_back(property_ptr->payload[i].key, property_ptr->payload[i].value);
+                ret.emplace_back(read_property_entry(property_ptr->payload[i]));
         }
 
         property_ref_cpy = property_ptr->next;
@@ -1457,6 +2838,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_vertex(con
 std::unordered_map<std::string, std::string>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_vertex_map(Id_t src)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     SRef_t<SVertexDataBlock> src_vertex              = {};
     std::unordered_map<std::string, std::string> ret = {};
 
@@ -1477,7 +2859,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_vertex_map
         for (size_t i = 0; i < property_ptr->state.size(); i++)
         {
             if (likely(property_ptr->state.test(i)))
-                ret[property_ptr->payload[i].key] = property_ptr->payload[i].value;
+                ret[read_property_key_entry(property_ptr->payload[i].key_id)->key_s] = read_property_value(property_ptr->payload[i]);
         }
 
         property_ref_cpy = property_ptr->next;
@@ -1489,6 +2871,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_vertex_map
 std::vector<graphquery::database::storage::ILPGModel::SProperty_t>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_id(const int64_t id)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     SRef_t<SVertexDataBlock> vertex_ptr = m_vertices_file.read_entry(static_cast<int64_t>(id));
     std::vector<SProperty_t> ret        = {};
 
@@ -1503,7 +2886,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_id(const i
         for (size_t i = 0; i < property_ptr->state.size(); i++)
         {
             if (likely(property_ptr->state.test(i)))
-                ret.emplace_back(property_ptr->payload[i].key, property_ptr->payload[i].value);
+                ret.emplace_back(read_property_entry(property_ptr->payload[i]));
         }
 
         property_ref_cpy = property_ptr->next;
@@ -1516,6 +2899,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_id(const i
 std::unordered_map<std::string, std::string>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_id_map(const int64_t id)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     SRef_t<SVertexDataBlock> vertex_ptr              = m_vertices_file.read_entry(id);
     std::unordered_map<std::string, std::string> ret = {};
 
@@ -1530,7 +2914,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_id_map(con
         for (size_t i = 0; i < property_ptr->state.size(); i++)
         {
             if (likely(property_ptr->state.test(i)))
-                ret.emplace(property_ptr->payload[i].key, property_ptr->payload[i].value);
+                ret.emplace(read_property_key_entry(property_ptr->payload[i].key_id)->key_s, read_property_value(property_ptr->payload[i]));
         }
 
         property_ref_cpy = property_ptr->next;
@@ -1540,11 +2924,18 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_id_map(con
 }
 
 std::vector<graphquery::database::storage::ILPGModel::SProperty_t>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_property_id(const uint32_t id)
+graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_property_id(const Id_t id)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    return read_property_chain(id);
+}
+
+std::vector<graphquery::database::storage::ILPGModel::SProperty_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::read_property_chain(const Id_t property_id) noexcept
 {
     std::vector<SProperty_t> ret = {};
 
-    auto property_ref_cpy = id;
+    auto property_ref_cpy = property_id;
     auto gbl_p_ptr        = m_properties_file.read_entry(0).ref;
     while (property_ref_cpy != END_INDEX)
     {
@@ -1553,7 +2944,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_property_i
         for (size_t i = 0; i < property_ptr->state.size(); i++)
         {
             if (likely(property_ptr->state.test(i)))
-                ret.emplace_back(property_ptr->payload[i].key, property_ptr->payload[i].value);
+                ret.emplace_back(read_property_entry(property_ptr->payload[i]));
         }
 
         property_ref_cpy = property_ptr->next;
@@ -1564,8 +2955,9 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_property_i
 }
 
 std::unordered_map<std::string, std::string>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_property_id_map(const uint32_t id)
+graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_property_id_map(const Id_t id)
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     std::unordered_map<std::string, std::string> ret = {};
 
     auto property_ref_cpy = id;
@@ -1576,7 +2968,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_property_i
         for (size_t i = 0; i < property_ptr->state.size(); i++)
         {
             if (likely(property_ptr->state.test(i)))
-                ret[property_ptr->payload[i].key] = property_ptr->payload[i].value;
+                ret[read_property_key_entry(property_ptr->payload[i].key_id)->key_s] = read_property_value(property_ptr->payload[i]);
         }
 
         property_ref_cpy = property_ptr->next;
@@ -1588,6 +2980,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_properties_by_property_i
 uint32_t
 graphquery::database::storage::CMemoryModelMMAPLPG::out_degree(const Id_t id) noexcept
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     assert(id < m_vertices_file.read_metadata()->data_block_c);
     return get_vertex_by_offset(id)->ref->payload.metadata.outdegree;
 }
@@ -1595,6 +2988,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::out_degree(const Id_t id) no
 uint32_t
 graphquery::database::storage::CMemoryModelMMAPLPG::in_degree(const Id_t id) noexcept
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     assert(id < m_vertices_file.read_metadata()->data_block_c);
     return get_vertex_by_offset(id)->ref->payload.metadata.indegree;
 }
@@ -1608,6 +3002,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::out_degree_by_id(const Id_t
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::calc_outdegree(uint32_t outdeg[]) noexcept
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     const auto datablock_c   = utils::atomic_load(&m_vertices_file.read_metadata()->data_block_c);
     auto gbl_curr_vertex_ptr = m_vertices_file.read_entry(0);
 
@@ -1625,6 +3020,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::calc_outdegree(uint32_t outd
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::calc_indegree(uint32_t indeg[]) noexcept
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     const auto datablock_c   = utils::atomic_load(&m_vertices_file.read_metadata()->data_block_c);
     auto gbl_curr_vertex_ptr = m_vertices_file.read_entry(0);
 
@@ -1642,6 +3038,7 @@ graphquery::database::storage::CMemoryModelMMAPLPG::calc_indegree(uint32_t indeg
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::calc_vertex_sparse_map(Id_t arr[]) noexcept
 {
+    std::shared_lock transaction_lock(m_transaction_lock);
     SRef_t<SVertexDataBlock> gbl_vertex_ptr = m_vertices_file.read_entry(0);
     int64_t block_c                         = utils::atomic_load(&m_vertices_file.read_metadata()->data_block_c);
     int64_t vertex_i                        = 0;
@@ -1661,9 +3058,9 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_avg_out_degree() noexcep
 }
 
 std::optional<graphquery::database::storage::SRef_t<graphquery::database::storage::CMemoryModelMMAPLPG::SVertexDataBlock>>
-graphquery::database::storage::CMemoryModelMMAPLPG::get_vertex_by_offset(const uint32_t offset) noexcept
+graphquery::database::storage::CMemoryModelMMAPLPG::get_vertex_by_offset(const Id_t offset) noexcept
 {
-    const uint32_t block_c = utils::atomic_load(&m_vertices_file.read_metadata()->data_block_c);
+    const Id_t block_c = utils::atomic_load(&m_vertices_file.read_metadata()->data_block_c);
 
     if (offset >= block_c)
         return std::nullopt;
@@ -1677,12 +3074,12 @@ graphquery::database::storage::CMemoryModelMMAPLPG::get_vertex_by_offset(const u
 std::optional<graphquery::database::storage::SRef_t<graphquery::database::storage::CMemoryModelMMAPLPG::SVertexDataBlock>>
 graphquery::database::storage::CMemoryModelMMAPLPG::get_vertex_by_id(const Id_t id) noexcept
 {
-    auto index_ptr = m_index_file.read_entry(id);
+    const auto offset = m_index_file.lookup(id);
 
-    if (index_ptr->set == 0)
+    if (!offset.has_value())
         return std::nullopt;
 
-    auto v_ptr = m_vertices_file.read_entry(index_ptr->offset);
+    auto v_ptr = m_vertices_file.read_entry(offset.value());
     if (v_ptr->state & 1 << VERTEX_MARKED_STATE_BIT)
         return std::nullopt;
     return v_ptr;
@@ -1698,62 +3095,79 @@ graphquery::database::storage::CMemoryModelMMAPLPG::read_graph_metadata() noexce
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::define_luts() noexcept
 {
-    auto label_c = utils::atomic_load(&read_graph_metadata()->vertex_label_c);
+    //~ Each table is released before the next is referenced, as referencing beyond the mapping grows the file, which waits on readers.
+    {
+        const auto label_c = utils::atomic_load(&read_graph_metadata()->vertex_label_c);
 
-    m_label_vertex.resize(label_c);
-    m_v_label_map.reserve(label_c);
+        m_label_vertex.resize(label_c);
+        m_v_label_map.reserve(label_c);
 
-    auto label_ptr = read_vertex_label_entry(0);
+        auto label_ptr = read_vertex_label_entry(0);
+
+        for (uint16_t i = 0; i < label_c; i++, ++label_ptr)
+        {
+            m_v_label_map[label_ptr->label_s] = label_ptr->label_id;
+            m_label_vertex[label_ptr->label_id].reserve(label_ptr->item_c);
+        }
+    }
 
-    for (uint16_t i = 0; i < label_c; i++, ++label_ptr)
     {
-        m_v_label_map[label_ptr->label_s] = label_ptr->label_id;
-        m_label_vertex[label_ptr->label_id].reserve(label_ptr->item_c);
+        const auto label_c = utils::atomic_load(&read_graph_metadata()->edge_label_c);
+        m_e_label_map.reserve(label_c);
+        auto label_ptr = read_edge_label_entry(0);
+
+        for (uint16_t i = 0; i < label_c; i++, ++label_ptr)
+            m_e_label_map[label_ptr->label_s] = label_ptr->label_id;
     }
 
-    label_c = utils::atomic_load(&read_graph_metadata()->edge_label_c);
-    m_e_label_map.reserve(label_c);
-    label_ptr = read_edge_label_entry(0);
+    const auto key_c = utils::atomic_load(&read_graph_metadata()->property_key_c);
+    m_p_key_map.reserve(key_c);
+    auto key_ptr = read_property_key_entry(0);
 
-    for (uint16_t i = 0; i < label_c; i++, ++label_ptr)
-        m_e_label_map[label_ptr->label_s] = label_ptr->label_id;
+    for (uint16_t i = 0; i < key_c; i++, ++key_ptr)
+        m_p_key_map[key_ptr->key_s] = key_ptr->key_id;
 }
 
 void
 graphquery::database::storage::CMemoryModelMMAPLPG::read_index_list() noexcept
 {
+    //~ Rebuilt from the vertices file, dropping the offsets appended while replaying the log.
+    m_label_vertex.clear();
     define_luts();
-    const uint32_t block_c = utils::atomic_load(&m_vertices_file.read_metadata()->data_block_c);
+    const auto scan    = m_vertices_file.scoped_scan();
+    const Id_t block_c = utils::atomic_load(&m_vertices_file.read_metadata()->data_block_c);
 
     auto vertex_ptr        = m_vertices_file.read_entry(0);
     auto gbl_label_ref_ptr = m_label_ref_file.read_entry(0);
 
-    for (uint32_t vertex_i = 0; vertex_i < block_c; vertex_i++, ++vertex_ptr)
+    for (Id_t vertex_i = 0; vertex_i < block_c; vertex_i++, ++vertex_ptr)
     {
         if (unlikely(!(vertex_ptr->state & 1 << VERTEX_INITIALISED_STATE_BIT)))
             continue;
 
+        //~ Migrate the label ref chain of older graphs into the label mask.
         auto label_head = vertex_ptr->payload.metadata.label_id;
 
         while (label_head != END_INDEX)
         {
-            auto label_ptr = gbl_label_ref_ptr + label_head;
-
-            if (!label_ptr->state.any())
-                continue;
+            const auto label_ptr = gbl_label_ref_ptr + label_head;
 
-            for (uint8_t p = 0, j = 0; p != label_ptr->payload_amt && j < label_ptr->payload.size();)
+            for (size_t j = 0; j < label_ptr->payload.size(); j++)
             {
-                if (label_ptr->state.test(j))
-                {
-                    m_label_vertex[label_ptr->payload[j]].emplace_back(vertex_ptr->idx);
-                    p++;
-                }
-                j++;
+                if (label_ptr->state.test(j) && label_ptr->payload[j] < VERTEX_LABELS_MAX_AMT)
+                    vertex_ptr->payload.metadata.label_mask.set(label_ptr->payload[j]);
             }
 
             label_head = label_ptr->next;
         }
+
+        const auto & label_mask = vertex_ptr->payload.metadata.label_mask;
+
+        for (uint16_t label_id = 0; label_id < m_label_vertex.size() && label_id < VERTEX_LABELS_MAX_AMT; label_id++)
+        {
+            if (label_mask[label_id])
+                m_label_vertex[label_id].emplace_back(vertex_ptr->idx);
+        }
     }
 }
 
@@ -1777,6 +3191,38 @@ graphquery::database::storage::CMemoryModelMMAPLPG::read_edge_label_entry(const
     return m_master_file.ref<SLabel_t, write>(effective_addr);
 }
 
+template<bool write>
+graphquery::database::storage::SRef_t<graphquery::database::storage::CMemoryModelMMAPLPG::SPropertyKey_t, write>
+graphquery::database::storage::CMemoryModelMMAPLPG::read_property_key_entry(const uint32_t offset) noexcept
+{
+    const auto effective_addr = PROPERTY_KEYS_START_ADDR + sizeof(SPropertyKey_t) * offset;
+    return m_master_file.ref<SPropertyKey_t, write>(effective_addr);
+}
+
+template<bool write>
+graphquery::database::storage::SRef_t<graphquery::database::storage::CMemoryModelMMAPLPG::STemporalIndex_t, write>
+graphquery::database::storage::CMemoryModelMMAPLPG::read_temporal_index_entry(const uint32_t offset) noexcept
+{
+    const auto effective_addr = TEMPORAL_INDEX_START_ADDR + sizeof(STemporalIndex_t) * offset;
+    return m_master_file.ref<STemporalIndex_t, write>(effective_addr);
+}
+
+template<bool write>
+graphquery::database::storage::SRef_t<graphquery::database::storage::CMemoryModelMMAPLPG::SPropertyColumn_t, write>
+graphquery::database::storage::CMemoryModelMMAPLPG::read_property_column_entry(const uint32_t offset) noexcept
+{
+    const auto effective_addr = PROPERTY_COLS_START_ADDR + sizeof(SPropertyColumn_t) * offset;
+    return m_master_file.ref<SPropertyColumn_t, write>(effective_addr);
+}
+
+template<bool write>
+graphquery::database::storage::SRef_t<graphquery::database::storage::CMemoryModelMMAPLPG::SPropertyIndex_t, write>
+graphquery::database::storage::CMemoryModelMMAPLPG::read_property_index_entry(const uint32_t offset) noexcept
+{
+    const auto effective_addr = PROPERTY_IDXS_START_ADDR + sizeof(SPropertyIndex_t) * offset;
+    return m_master_file.ref<SPropertyIndex_t, write>(effective_addr);
+}
+
 graphquery::database::storage::CMemoryModelMMAPLPG::EActionState_t
 graphquery::database::storage::CMemoryModelMMAPLPG::rm_vertex_entry(const Id_t src) noexcept
 {
@@ -1789,14 +3235,23 @@ graphquery::database::storage::CMemoryModelMMAPLPG::rm_vertex_entry(const Id_t s
 
     //~ Mark deletion for each edge block connected to the vertex
     const auto head_edge_idx = utils::atomic_load(&vertex_ptr->payload.edge_idx);
+    const Id_t vertex_idx    = vertex_ptr->idx;
     m_edges_file.foreach_block(head_edge_idx,
-                               [this](SRef_t<SEdgeDataBlock> & edge_block_ptr) -> void
+                               [this, vertex_idx](SRef_t<SEdgeDataBlock> & edge_block_ptr) -> void
                                {
                                    for (uint8_t p = 0, j = 0; p != edge_block_ptr->payload_amt && j < edge_block_ptr->payload.size();)
                                    {
                                        if (edge_block_ptr->state.test(j))
                                        {
                                            utils::atomic_fetch_dec(&read_edge_label_entry(edge_block_ptr->payload[j].metadata.edge_label_id)->item_c);
+                                           (void) rm_in_edge_entries(edge_block_ptr->payload[j].metadata.src, edge_block_ptr->payload[j].metadata.dst, std::nullopt);
+                                           rm_temporal_entries(edge_block_ptr->payload[j].metadata.src, edge_block_ptr->payload[j].metadata.dst, edge_block_ptr->payload[j].metadata.edge_label_id);
+
+                                           //~ A neighbour marked for deletion is released once its last incoming edge is, as when pruned.
+                                           auto dst_vertex_ptr = m_vertices_file.read_entry(edge_block_ptr->payload[j].metadata.dst);
+                                           if (utils::atomic_fetch_pre_dec(&dst_vertex_ptr->payload.metadata.indegree) == 0 && dst_vertex_ptr->idx != vertex_idx &&
+                                               dst_vertex_ptr->state & 1 << VERTEX_MARKED_STATE_BIT)
+                                               free_vertex_entry(dst_vertex_ptr->payload.metadata, dst_vertex_ptr->idx);
 
                                            // Mark deletion to properties
                                            m_properties_file.foreach_block(edge_block_ptr->payload[j].metadata.property_id,
@@ -1809,60 +3264,115 @@ graphquery::database::storage::CMemoryModelMMAPLPG::rm_vertex_entry(const Id_t s
                                    m_edges_file.append_free_data_block(edge_block_ptr->idx);
                                });
 
-    // Mark deletion to properties
+    // Mark deletion to properties, once their values are dropped from the property indexes.
     const auto head_prop_idx = utils::atomic_load(&vertex_ptr->payload.metadata.property_id);
+    if (!m_property_index_files.empty())
+        rm_property_index_entries(vertex_ptr->idx, vertex_ptr->payload.metadata.label_mask, head_prop_idx);
+
     m_properties_file.foreach_block(head_prop_idx, [this](SRef_t<SPropertyDataBlock> & prop_block_ptr) -> void { m_properties_file.append_free_data_block(prop_block_ptr->idx); });
 
-    // Mark deletion to label refs
-    auto gbl_label_ref = m_label_ref_file.read_entry(0);
-    auto gbl_v_label   = read_vertex_label_entry(0);
-    auto label_ref_idx = vertex_ptr->payload.metadata.label_id;
+    // Mark deletion to labels
+    auto gbl_v_label        = read_vertex_label_entry(0);
+    const auto & label_mask = vertex_ptr->payload.metadata.label_mask;
+
+    for (uint16_t label_id = 0; label_id < VERTEX_LABELS_MAX_AMT; label_id++)
+    {
+        if (label_mask[label_id])
+            (gbl_v_label + label_id)->item_c--;
+    }
+
+    const auto head_label_ref_idx = utils::atomic_load(&vertex_ptr->payload.metadata.label_id);
+    m_label_ref_file.foreach_block(head_label_ref_idx, [this](SRef_t<SLabelRefDataBlock> & label_ref_block_ptr) -> void { m_label_ref_file.append_free_data_block(label_ref_block_ptr->idx); });
+
+    //~ Free the edge label directory along with the unused blocks reserved by its segments, as both chains are released.
+    const auto head_label_dir_idx = utils::atomic_load(&vertex_ptr->payload.label_dir_idx);
+    m_label_dir_file.foreach_block(head_label_dir_idx,
+                                   [this](SRef_t<SLabelDirDataBlock> & label_dir_block_ptr) -> void
+                                   {
+                                       for (size_t j = 0; j < label_dir_block_ptr->payload.size(); j++)
+                                       {
+                                           if (!label_dir_block_ptr->state.test(j))
+                                               continue;
+
+                                           const auto & entry = label_dir_block_ptr->payload[j];
+                                           if (entry.out_reserve_c > 0)
+                                               m_edges_file.append_free_data_block_run(entry.out_reserve_idx, entry.out_reserve_c);
+                                           if (entry.in_reserve_c > 0)
+                                               m_in_edges_file.append_free_data_block_run(entry.in_reserve_idx, entry.in_reserve_c);
+                                       }
+                                       m_label_dir_file.append_free_data_block(label_dir_block_ptr->idx);
+                                   });
+
+    //~ Free the incoming chain, the outgoing entries of the neighbours are pruned on sync.
+    auto gbl_in_edge_ptr = m_in_edges_file.read_entry(0);
+    auto in_edge_idx     = utils::atomic_load(&vertex_ptr->payload.in_edge_idx);
 
-    while (label_ref_idx != END_INDEX)
+    while (in_edge_idx != END_INDEX)
     {
-        auto label_ref = gbl_label_ref + label_ref_idx;
+        const auto in_edge_ptr = gbl_in_edge_ptr + in_edge_idx;
 
-        for (uint8_t p = 0, j = 0; p != label_ref->payload_amt && j < label_ref->payload.size();)
+        //~ Remove the outgoing entries of the neighbours from the temporal indexes.
+        for (size_t j = 0; j < in_edge_ptr->state.size() && !m_temporal_files.empty(); j++)
         {
-            if (label_ref->state.test(j))
-            {
-                (gbl_v_label + label_ref->payload[j])->item_c--;
-                p++;
-            }
-            j++;
+            if (in_edge_ptr->state.test(j))
+                rm_temporal_entries(in_edge_ptr->payload[j].metadata.src, in_edge_ptr->payload[j].metadata.dst, in_edge_ptr->payload[j].metadata.edge_label_id);
         }
-        label_ref_idx = label_ref->next;
+
+        const auto next_in_edge_idx = in_edge_ptr->next;
+        m_in_edges_file.append_free_data_block(in_edge_idx);
+        in_edge_idx = next_in_edge_idx;
     }
 
-    const auto head_label_ref_idx = utils::atomic_load(&vertex_ptr->payload.edge_idx);
-    m_label_ref_file.foreach_block(head_label_ref_idx, [this](SRef_t<SLabelRefDataBlock> & label_ref_block_ptr) -> void { m_label_ref_file.append_free_data_block(label_ref_block_ptr->idx); });
+    //~ Drop the values of the vertex from the columns, such that scans skip it.
+    for (const auto & column_file : m_column_files)
+        column_file->store(vertex_ptr->idx, std::nullopt);
 
     //~ Mark deletion for vertex
     utils::atomic_store(&vertex_ptr->state, 1 << VERTEX_MARKED_STATE_BIT);
     utils::atomic_store(&vertex_ptr->payload.edge_idx, END_INDEX);
+    utils::atomic_store(&vertex_ptr->payload.in_edge_idx, END_INDEX);
+    utils::atomic_store(&vertex_ptr->payload.label_dir_idx, END_INDEX);
+    utils::atomic_store(&vertex_ptr->payload.metadata.edge_label_c, static_cast<uint16_t>(0));
     utils::atomic_fetch_dec(&read_graph_metadata()->vertices_c);
-    utils::atomic_fetch_sub(&read_graph_metadata()->edges_c, vertex_ptr->payload.metadata.outdegree);
+    utils::atomic_fetch_sub(&read_graph_metadata()->edges_c, static_cast<Id_t>(vertex_ptr->payload.metadata.outdegree));
     utils::atomic_store(&vertex_ptr->payload.metadata.outdegree, 0);
+    update_edge_version();
 
     if (vertex_ptr->payload.metadata.indegree == 0)
+        free_vertex_entry(vertex_ptr->payload.metadata, vertex_ptr->idx);
+
+    return EActionState_t::valid;
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::free_vertex_entry(const SVertex_t & metadata, const Id_t vertex_offset) noexcept
+{
+    (void) m_index_file.remove(metadata.id);
+
+    //~ The offset is dropped from the vertex lists of its labels, such that a vertex reusing it is listed once.
     {
-        utils::atomic_store(&m_index_file.read_entry(src)->set, 0);
-        m_vertices_file.append_free_data_block(vertex_ptr->idx);
+        std::lock_guard label_vertex_lock(m_label_vertex_lock);
+        for (uint16_t label_id = 0; label_id < m_label_vertex.size() && label_id < VERTEX_LABELS_MAX_AMT; label_id++)
+        {
+            if (metadata.label_mask[label_id])
+                std::erase(m_label_vertex[label_id], vertex_offset);
+        }
     }
 
-    return EActionState_t::valid;
+    m_vertices_file.append_free_data_block(vertex_offset);
 }
 
 graphquery::database::storage::CMemoryModelMMAPLPG::EActionState_t
-graphquery::database::storage::CMemoryModelMMAPLPG::rm_edge_entry(const Id_t src, const Id_t dst) noexcept
+graphquery::database::storage::CMemoryModelMMAPLPG::rm_edge_entry(const Id_t src, const Id_t dst, const EChainSide_t chains) noexcept
 {
     std::optional<SRef_t<SVertexDataBlock>> src_vertex_ptr = get_vertex_by_id(src);
     std::optional<SRef_t<SVertexDataBlock>> dst_vertex_ptr = get_vertex_by_id(dst);
 
+    //~ Solely the lookups can fail, preceding the first change, therefore a removal records no undo.
     if (unlikely(!(src_vertex_ptr.has_value() && dst_vertex_ptr.has_value())))
         return EActionState_t::invalid;
 
-    const uint32_t head_edge_idx = utils::atomic_load(&src_vertex_ptr.value()->payload.edge_idx);
+    const Id_t head_edge_idx     = utils::atomic_load(&src_vertex_ptr.value()->payload.edge_idx);
     const auto dst_idx           = utils::atomic_load(&dst_vertex_ptr.value()->idx);
     Id_t edge_c                  = 0;
 
@@ -1895,60 +3405,562 @@ graphquery::database::storage::CMemoryModelMMAPLPG::rm_edge_entry(const Id_t src
                                });
 
     utils::atomic_fetch_sub(&read_graph_metadata()->edges_c, edge_c);
-    utils::atomic_fetch_sub(&src_vertex_ptr->ref->payload.metadata.outdegree, edge_c);
+    utils::atomic_fetch_sub(&src_vertex_ptr->ref->payload.metadata.outdegree, static_cast<uint32_t>(edge_c));
+
+    //~ The incoming chain of the destination is left to the caller when unlinked separately.
+    if (edge_c > 0)
+    {
+        if (chains == EChainSide_t::both)
+            (void) rm_in_edge_entries(src_vertex_ptr->ref->idx, dst_idx, std::nullopt);
+        rm_temporal_entries(src_vertex_ptr->ref->idx, dst_idx, std::nullopt, chains == EChainSide_t::both ? std::nullopt : std::optional<bool>(false));
+        update_edge_version();
+    }
 
     return EActionState_t::valid;
 }
 
 graphquery::database::storage::CMemoryModelMMAPLPG::EActionState_t
-graphquery::database::storage::CMemoryModelMMAPLPG::rm_edge_entry(const Id_t src, const Id_t dst, const std::string_view edge_label) noexcept
+graphquery::database::storage::CMemoryModelMMAPLPG::rm_edge_entry(const Id_t src, const Id_t dst, const std::string_view edge_label, const EChainSide_t chains) noexcept
 {
     std::optional<SRef_t<SVertexDataBlock>> src_vertex_ptr = get_vertex_by_id(src);
     std::optional<SRef_t<SVertexDataBlock>> dst_vertex_ptr = get_vertex_by_id(dst);
     std::optional<uint16_t> edge_label_id                  = check_if_edge_label_exists(edge_label);
 
+    //~ Likewise solely the lookups can fail.
     if (unlikely(!(src_vertex_ptr.has_value() && dst_vertex_ptr.has_value() && edge_label_id.has_value())))
         return EActionState_t::invalid;
 
-    const uint32_t head_edge_idx = utils::atomic_load(&src_vertex_ptr.value()->payload.edge_idx);
     const auto label_id          = *edge_label_id;
+    const auto label_dir_idx     = utils::atomic_load(&src_vertex_ptr.value()->payload.label_dir_idx);
     const auto dst_idx           = utils::atomic_load(&dst_vertex_ptr.value()->idx);
+    Id_t edge_ref                = get_label_edge_head(label_dir_idx, label_id, false);
     Id_t edge_c                  = 0;
 
-    m_edges_file.foreach_block(head_edge_idx,
-                               [this, &edge_c, dst_idx, label_id, &dst_vertex_ptr](SRef_t<SEdgeDataBlock> & edge_block_ptr) -> void
-                               {
-                                   auto payload_amt = edge_block_ptr->payload_amt;
-                                   for (uint8_t p = 0, j = 0; p != payload_amt && j < edge_block_ptr->payload.size();)
+    //~ Only the label segment of the chain can contain the edge.
+    while (edge_ref != END_INDEX)
+    {
+        auto edge_block_ptr = m_edges_file.read_entry(edge_ref);
 
-                                   {
-                                       if (edge_block_ptr->state.test(j))
-                                       {
-                                           if (edge_block_ptr->payload[j].metadata.dst == dst_idx && edge_block_ptr->payload[j].metadata.edge_label_id == label_id)
-                                           {
-                                               edge_block_ptr->state[j].flip();
-                                               utils::atomic_fetch_dec(&edge_block_ptr->payload_amt);
-                                               utils::atomic_fetch_dec(&dst_vertex_ptr->ref->payload.metadata.indegree);
-                                               utils::atomic_fetch_dec(&read_edge_label_entry(label_id)->item_c);
+        if (edge_block_ptr->payload[0].metadata.edge_label_id != label_id)
+            break;
 
-                                               // Mark deletion to properties
-                                               m_properties_file.foreach_block(edge_block_ptr->payload[j].metadata.property_id,
-                                                                               [this](SRef_t<SPropertyDataBlock> & prop_block_ptr) -> void
-                                                                               { m_properties_file.append_free_data_block(prop_block_ptr->idx); });
-                                               edge_c++;
-                                           }
-                                           p++;
-                                       }
-                                       j++;
-                                   }
-                               });
+        auto payload_amt = edge_block_ptr->payload_amt;
+        for (uint8_t p = 0, j = 0; p != payload_amt && j < edge_block_ptr->payload.size();)
+        {
+            if (edge_block_ptr->state.test(j))
+            {
+                if (edge_block_ptr->payload[j].metadata.dst == dst_idx)
+                {
+                    edge_block_ptr->state[j].flip();
+                    utils::atomic_fetch_dec(&edge_block_ptr->payload_amt);
+                    utils::atomic_fetch_dec(&dst_vertex_ptr->ref->payload.metadata.indegree);
+                    utils::atomic_fetch_dec(&read_edge_label_entry(label_id)->item_c);
+
+                    // Mark deletion to properties
+                    m_properties_file.foreach_block(edge_block_ptr->payload[j].metadata.property_id,
+                                                    [this](SRef_t<SPropertyDataBlock> & prop_block_ptr) -> void { m_properties_file.append_free_data_block(prop_block_ptr->idx); });
+                    edge_c++;
+                }
+                p++;
+            }
+            j++;
+        }
+        edge_ref = edge_block_ptr->next;
+    }
 
     utils::atomic_fetch_sub(&read_graph_metadata()->edges_c, edge_c);
-    utils::atomic_fetch_sub(&src_vertex_ptr->ref->payload.metadata.outdegree, edge_c);
+    utils::atomic_fetch_sub(&src_vertex_ptr->ref->payload.metadata.outdegree, static_cast<uint32_t>(edge_c));
+
+    if (edge_c > 0)
+    {
+        if (chains == EChainSide_t::both)
+            (void) rm_in_edge_entries(src_vertex_ptr->ref->idx, dst_idx, label_id);
+        rm_temporal_entries(src_vertex_ptr->ref->idx, dst_idx, label_id, chains == EChainSide_t::both ? std::nullopt : std::optional<bool>(false));
+        update_edge_version();
+    }
 
     return EActionState_t::valid;
 }
 
+graphquery::database::storage::Id_t
+graphquery::database::storage::CMemoryModelMMAPLPG::rm_in_edge_entries(const Id_t src_idx, const Id_t dst_idx, const std::optional<uint16_t> edge_label_id) noexcept
+{
+    auto dst_vertex_ptr   = m_vertices_file.read_entry(dst_idx);
+    auto gbl_in_edge_ptr  = m_in_edges_file.read_entry(0);
+    Id_t in_edge_ref      = utils::atomic_load(&dst_vertex_ptr->payload.in_edge_idx);
+    Id_t prev_in_edge_ref = END_INDEX;
+    Id_t edge_c           = 0;
+
+    while (in_edge_ref != END_INDEX)
+    {
+        auto in_edge_ptr = gbl_in_edge_ptr + in_edge_ref;
+
+        for (size_t j = 0; j < in_edge_ptr->state.size(); j++)
+        {
+            if (!in_edge_ptr->state.test(j))
+                continue;
+
+            const SEdge_t & edge = in_edge_ptr->payload[j].metadata;
+            if (edge.src != src_idx || (edge_label_id.has_value() && edge.edge_label_id != *edge_label_id))
+                continue;
+
+            in_edge_ptr->state[j] = false;
+            utils::atomic_fetch_dec(&in_edge_ptr->payload_amt);
+            edge_c++;
+        }
+
+        const Id_t next_in_edge_ref = in_edge_ptr->next;
+
+        //~ Unlink emptied blocks from the incoming chain.
+        if (in_edge_ptr->payload_amt == 0)
+        {
+            update_label_edge_head(dst_vertex_ptr->payload.label_dir_idx, in_edge_ptr->payload[0].metadata.edge_label_id, true, in_edge_ref, next_in_edge_ref);
+
+            if (prev_in_edge_ref == END_INDEX)
+                utils::atomic_store(&dst_vertex_ptr->payload.in_edge_idx, next_in_edge_ref);
+            else
+                (gbl_in_edge_ptr + prev_in_edge_ref)->next = next_in_edge_ref;
+
+            m_in_edges_file.append_free_data_block(in_edge_ref);
+        }
+        else
+            prev_in_edge_ref = in_edge_ref;
+
+        in_edge_ref = next_in_edge_ref;
+    }
+
+    return edge_c;
+}
+
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::create_temporal_index(const std::string_view vertex_label,
+                                                                          const std::string_view edge_label,
+                                                                          const std::string_view property_key,
+                                                                          const bool incoming,
+                                                                          const bool edge_property)
+{
+    if (get_temporal_index(vertex_label, edge_label, incoming).has_value() || m_temporal_files.size() >= TEMPORAL_INDEX_MAX_AMT)
+    {
+        m_log_system->warning(fmt::format("Temporal index on ({})-[{}] could not be created", vertex_label, edge_label));
+        return false;
+    }
+
+    STemporalIndex_t index = {};
+    strncpy(&index.vertex_label[0], vertex_label.data(), std::min(vertex_label.size(), static_cast<size_t>(CFG_LPG_LABEL_LENGTH - 1)));
+    strncpy(&index.edge_label[0], edge_label.data(), std::min(edge_label.size(), static_cast<size_t>(CFG_LPG_LABEL_LENGTH - 1)));
+    strncpy(&index.property_key[0], property_key.data(), std::min(property_key.size(), static_cast<size_t>(CFG_LPG_PROPERTY_KEY_LENGTH - 1)));
+    index.incoming      = incoming;
+    index.edge_property = edge_property;
+
+    const auto index_id = static_cast<uint8_t>(m_temporal_files.size());
+    *read_temporal_index_entry<true>(index_id).ref = index;
+
+    m_temporal_files.emplace_back(std::make_unique<CTemporalFile>());
+    m_temporal_files.back()->open(m_graph_path, fmt::format("{}_{}", TEMPORAL_FILE_NAME, index_id), true);
+    m_temporal_files.back()->store_metadata();
+    utils::atomic_fetch_inc(&read_graph_metadata()->temporal_index_c);
+
+    //~ Populate the index with the edges already stored.
+    for (const auto & edge : get_edges(vertex_label, edge_label))
+    {
+        if (const auto timestamp = get_temporal_timestamp(index, edge); timestamp.has_value())
+            m_temporal_files[index_id]->insert(incoming ? edge.dst : edge.src, {edge, *timestamp});
+    }
+
+    //~ Checkpointed once populated, such that a restored image holds every declared index.
+    (void) checkpoint();
+    return true;
+}
+
+std::optional<std::vector<graphquery::database::storage::ILPGModel::STemporalEdge_t>>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_recent_edges(const Id_t vertex_id,
+                                                                     const std::string_view vertex_label,
+                                                                     const std::string_view edge_label,
+                                                                     const bool incoming,
+                                                                     const size_t limit,
+                                                                     const int64_t max_timestamp)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    const auto index_id = get_temporal_index(vertex_label, edge_label, incoming);
+
+    if (!index_id.has_value())
+        return std::nullopt;
+
+    const auto vertex_idx = lookup_vertex(vertex_id);
+
+    if (!vertex_idx.has_value())
+        return std::vector<STemporalEdge_t>{};
+
+    //~ Neighbours marked for deletion are kept within the index until pruned.
+    auto gbl_v_ptr = m_vertices_file.read_entry(0);
+    return m_temporal_files[*index_id]->get_recent(*vertex_idx,
+                                                   max_timestamp,
+                                                   limit,
+                                                   [&gbl_v_ptr, incoming](const STemporalEdge_t & entry) -> bool
+                                                   {
+                                                       const auto neighbour_ptr = gbl_v_ptr + (incoming ? entry.edge.src : entry.edge.dst);
+                                                       return !(neighbour_ptr->state & 1 << VERTEX_MARKED_STATE_BIT);
+                                                   });
+}
+
+std::optional<uint8_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_temporal_index(const std::string_view vertex_label, const std::string_view edge_label, const bool incoming) noexcept
+{
+    for (uint8_t i = 0; i < m_temporal_files.size(); i++)
+    {
+        const auto index_ptr = read_temporal_index_entry(i);
+
+        if (index_ptr.ref->incoming == incoming && vertex_label == index_ptr.ref->vertex_label && edge_label == index_ptr.ref->edge_label)
+            return i;
+    }
+
+    return std::nullopt;
+}
+
+std::optional<int64_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_temporal_timestamp(const STemporalIndex_t & index, const SEdge_t & edge) noexcept
+{
+    Id_t property_id = edge.property_id;
+
+    if (!index.edge_property)
+    {
+        const auto neighbour_ptr = m_vertices_file.read_entry(index.incoming ? edge.src : edge.dst);
+        property_id              = utils::atomic_load(&neighbour_ptr.ref->payload.metadata.property_id);
+    }
+
+    const auto key_id = check_if_property_key_exists(index.property_key);
+    if (!key_id.has_value())
+        return std::nullopt;
+
+    const auto value = get_property_value(property_id, *key_id);
+    if (!value.has_value())
+        return std::nullopt;
+
+    //~ Values not wholly parsed as a date are rejected, leaving the edge unindexed rather than indexed by a prefix.
+    return utils::parse_date(*value);
+}
+
+std::optional<std::string>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_property_value(Id_t property_id, const uint16_t key_id) noexcept
+{
+    while (property_id != END_INDEX)
+    {
+        auto property_ptr = m_properties_file.read_entry(property_id);
+
+        for (size_t i = 0; i < property_ptr->state.size(); i++)
+        {
+            if (property_ptr->state.test(i) && property_ptr->payload[i].key_id == key_id)
+                return read_property_value(property_ptr->payload[i]);
+        }
+
+        property_id = property_ptr->next;
+    }
+
+    return std::nullopt;
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::store_temporal_entries(const SEdge_t & edge, const bool incoming) noexcept
+{
+    for (uint8_t i = 0; i < m_temporal_files.size(); i++)
+    {
+        const STemporalIndex_t index = *read_temporal_index_entry(i);
+
+        //~ Solely the indexes kept for the side of the edge being linked, such that each vertex adjacency is changed by its chain alone.
+        if ((index.incoming != 0) != incoming)
+            continue;
+
+        const auto edge_label_id     = check_if_edge_label_exists(index.edge_label);
+        const auto vertex_label_id   = check_if_vertex_label_exists(index.vertex_label);
+
+        if (!(edge_label_id.has_value() && vertex_label_id.has_value()) || *edge_label_id != edge.edge_label_id || !contains_vertex_label_id(edge.src, *vertex_label_id))
+            continue;
+
+        if (const auto timestamp = get_temporal_timestamp(index, edge); timestamp.has_value())
+            m_temporal_files[i]->insert(index.incoming ? edge.dst : edge.src, {edge, *timestamp});
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::rm_temporal_entries(const Id_t src_idx, const Id_t dst_idx, const std::optional<uint16_t> edge_label_id, const std::optional<bool> incoming) noexcept
+{
+    for (uint8_t i = 0; i < m_temporal_files.size(); i++)
+    {
+        const STemporalIndex_t index   = *read_temporal_index_entry(i);
+        const auto index_edge_label_id = check_if_edge_label_exists(index.edge_label);
+
+        if (!index_edge_label_id.has_value() || (edge_label_id.has_value() && *edge_label_id != *index_edge_label_id))
+            continue;
+
+        if (incoming.has_value() && (index.incoming != 0) != *incoming)
+            continue;
+
+        (void) m_temporal_files[i]->remove(index.incoming ? dst_idx : src_idx,
+                                           [src_idx, dst_idx, &index_edge_label_id](const STemporalEdge_t & entry) -> bool
+                                           { return entry.edge.src == src_idx && entry.edge.dst == dst_idx && entry.edge.edge_label_id == *index_edge_label_id; });
+    }
+}
+
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::create_property_column(const std::string_view vertex_label, const std::string_view property_key, const EColumnType_t type)
+{
+    if (get_property_column(vertex_label, property_key).has_value() || m_column_files.size() >= PROPERTY_COLUMNS_MAX_AMT)
+    {
+        m_log_system->warning(fmt::format("Property column on ({}).{} could not be created", vertex_label, property_key));
+        return false;
+    }
+
+    SPropertyColumn_t column = {};
+    strncpy(&column.vertex_label[0], vertex_label.data(), std::min(vertex_label.size(), static_cast<size_t>(CFG_LPG_LABEL_LENGTH - 1)));
+    strncpy(&column.property_key[0], property_key.data(), std::min(property_key.size(), static_cast<size_t>(CFG_LPG_PROPERTY_KEY_LENGTH - 1)));
+    column.type = type;
+
+    const auto column_id                             = static_cast<uint8_t>(m_column_files.size());
+    *read_property_column_entry<true>(column_id).ref = column;
+
+    m_column_files.emplace_back(std::make_unique<CColumnFile>());
+    m_column_files.back()->open(m_graph_path, fmt::format("{}_{}", COLUMN_FILE_NAME, column_id), true);
+    m_column_files.back()->store_metadata(type);
+    utils::atomic_fetch_inc(&read_graph_metadata()->property_column_c);
+
+    //~ Populate the column with the vertices already stored.
+    for (const auto vertex_offset : get_vertices_offset_by_label(vertex_label))
+    {
+        for (const auto & prop : get_properties_by_id(vertex_offset))
+        {
+            if (prop.key == column.property_key)
+            {
+                m_column_files[column_id]->store(vertex_offset, m_column_files[column_id]->encode(prop.value));
+                break;
+            }
+        }
+    }
+
+    //~ Checkpointed once populated, such that a restored image holds every declared column.
+    (void) checkpoint();
+    return true;
+}
+
+std::optional<uint8_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_property_column(const std::string_view vertex_label, const std::string_view property_key)
+{
+    for (uint8_t i = 0; i < m_column_files.size(); i++)
+    {
+        const auto column_ptr = read_property_column_entry(i);
+
+        if (vertex_label == column_ptr.ref->vertex_label && property_key == column_ptr.ref->property_key)
+            return i;
+    }
+
+    return std::nullopt;
+}
+
+std::optional<int64_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_column_value(const uint8_t column_id, const Id_t vertex_offset)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    if (unlikely(column_id >= m_column_files.size()))
+        return std::nullopt;
+
+    return m_column_files[column_id]->load(vertex_offset);
+}
+
+std::optional<std::string>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_column_string(const uint8_t column_id, const Id_t vertex_offset)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    if (unlikely(column_id >= m_column_files.size()))
+        return std::nullopt;
+
+    if (const auto value = m_column_files[column_id]->load(vertex_offset); value.has_value())
+        return m_column_files[column_id]->decode(*value);
+    return std::nullopt;
+}
+
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::scan_property_column(const uint8_t column_id,
+                                                                         const std::function<void(const int64_t * values, const uint8_t * valid, int64_t value_c)> & func)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    if (unlikely(column_id >= m_column_files.size()))
+        return false;
+
+    m_column_files[column_id]->scan(func);
+    return true;
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::store_column_entries(const Id_t vertex_offset, const std::unordered_set<uint16_t> & label_ids, const std::vector<SProperty_t> & props) noexcept
+{
+    for (uint8_t i = 0; i < m_column_files.size(); i++)
+    {
+        const SPropertyColumn_t column = *read_property_column_entry(i);
+        const auto vertex_label_id     = check_if_vertex_label_exists(column.vertex_label);
+        std::optional<int64_t> value   = std::nullopt;
+
+        if (vertex_label_id.has_value() && label_ids.contains(*vertex_label_id))
+        {
+            for (const auto & prop : props)
+            {
+                if (prop.key == column.property_key)
+                {
+                    value = m_column_files[i]->encode(prop.value);
+                    break;
+                }
+            }
+        }
+
+        m_column_files[i]->store(vertex_offset, value);
+    }
+}
+
+bool
+graphquery::database::storage::CMemoryModelMMAPLPG::create_property_index(const std::string_view vertex_label,
+                                                                          const std::string_view property_key,
+                                                                          const EIndexType_t index_type,
+                                                                          const EColumnType_t value_type)
+{
+    //~ Strings hold no order to parse them by, therefore they are solely hashed.
+    if (get_property_index(vertex_label, property_key).has_value() || m_property_index_files.size() >= PROPERTY_INDEX_MAX_AMT ||
+        (index_type == EIndexType_t::ordered && value_type == EColumnType_t::string))
+    {
+        m_log_system->warning(fmt::format("Property index on ({}).{} could not be created", vertex_label, property_key));
+        return false;
+    }
+
+    SPropertyIndex_t index = {};
+    strncpy(&index.vertex_label[0], vertex_label.data(), std::min(vertex_label.size(), static_cast<size_t>(CFG_LPG_LABEL_LENGTH - 1)));
+    strncpy(&index.property_key[0], property_key.data(), std::min(property_key.size(), static_cast<size_t>(CFG_LPG_PROPERTY_KEY_LENGTH - 1)));
+    index.index_type = index_type;
+    index.value_type = value_type;
+
+    const auto index_id                            = static_cast<uint8_t>(m_property_index_files.size());
+    *read_property_index_entry<true>(index_id).ref = index;
+
+    m_property_index_files.emplace_back(std::make_unique<CPropertyIndexFile>());
+    m_property_index_files.back()->open(m_graph_path, fmt::format("{}_{}", PROPERTY_INDEX_NAME, index_id), true, index_type, value_type);
+    m_property_index_files.back()->store_metadata();
+    utils::atomic_fetch_inc(&read_graph_metadata()->property_index_c);
+
+    //~ Populate the index with the vertices already stored.
+    if (const auto key_id = check_if_property_key_exists(property_key); key_id.has_value())
+    {
+        for (const auto vertex_offset : get_vertices_offset_by_label(vertex_label))
+        {
+            const auto property_id = utils::atomic_load(&m_vertices_file.read_entry(vertex_offset)->payload.metadata.property_id);
+
+            if (const auto value = get_property_value(property_id, *key_id); value.has_value())
+                m_property_index_files[index_id]->insert(*value, vertex_offset);
+        }
+    }
+
+    //~ Checkpointed once populated, such that a restored image holds every declared index.
+    (void) checkpoint();
+    return true;
+}
+
+std::optional<std::vector<graphquery::database::storage::Id_t>>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_vertices_by_property(const std::string_view vertex_label, const std::string_view property_key, const std::string_view value)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    const auto index_id = get_property_index(vertex_label, property_key);
+
+    if (!index_id.has_value())
+        return std::nullopt;
+
+    auto candidates = m_property_index_files[*index_id]->lookup(value);
+
+    if (m_property_index_files[*index_id]->get_index_type() != EIndexType_t::hash)
+        return candidates;
+
+    //~ Distinct values may share a hash, therefore verify each candidate against its stored value.
+    const auto key_id = check_if_property_key_exists(property_key);
+    if (!key_id.has_value())
+        return std::vector<Id_t>{};
+
+    std::erase_if(candidates,
+                  [this, &key_id, &value](const Id_t vertex_offset) -> bool
+                  {
+                      const auto property_id = utils::atomic_load(&m_vertices_file.read_entry(vertex_offset)->payload.metadata.property_id);
+                      const auto stored      = get_property_value(property_id, *key_id);
+                      return !stored.has_value() || *stored != value;
+                  });
+
+    return candidates;
+}
+
+std::optional<std::vector<graphquery::database::storage::Id_t>>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_vertices_by_property_range(const std::string_view vertex_label,
+                                                                                   const std::string_view property_key,
+                                                                                   const std::string_view lower,
+                                                                                   const std::string_view upper)
+{
+    std::shared_lock transaction_lock(m_transaction_lock);
+    const auto index_id = get_property_index(vertex_label, property_key);
+
+    if (!index_id.has_value() || m_property_index_files[*index_id]->get_index_type() != EIndexType_t::ordered)
+        return std::nullopt;
+
+    return m_property_index_files[*index_id]->range(lower, upper);
+}
+
+std::optional<uint8_t>
+graphquery::database::storage::CMemoryModelMMAPLPG::get_property_index(const std::string_view vertex_label, const std::string_view property_key) noexcept
+{
+    for (uint8_t i = 0; i < m_property_index_files.size(); i++)
+    {
+        const auto index_ptr = read_property_index_entry(i);
+
+        if (vertex_label == index_ptr.ref->vertex_label && property_key == index_ptr.ref->property_key)
+            return i;
+    }
+
+    return std::nullopt;
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::store_property_index_entries(const Id_t vertex_offset,
+                                                                                 const std::unordered_set<uint16_t> & label_ids,
+                                                                                 const std::vector<SProperty_t> & props) noexcept
+{
+    for (uint8_t i = 0; i < m_property_index_files.size(); i++)
+    {
+        const SPropertyIndex_t index = *read_property_index_entry(i);
+        const auto vertex_label_id   = check_if_vertex_label_exists(index.vertex_label);
+
+        if (!vertex_label_id.has_value() || !label_ids.contains(*vertex_label_id))
+            continue;
+
+        for (const auto & prop : props)
+        {
+            if (prop.key == index.property_key)
+            {
+                m_property_index_files[i]->insert(prop.value, vertex_offset);
+                break;
+            }
+        }
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelMMAPLPG::rm_property_index_entries(const Id_t vertex_offset,
+                                                                              const std::bitset<CFG_LPG_VERTEX_LABELS_MAX_AMT> & label_mask,
+                                                                              const Id_t property_id) noexcept
+{
+    for (uint8_t i = 0; i < m_property_index_files.size(); i++)
+    {
+        const SPropertyIndex_t index = *read_property_index_entry(i);
+        const auto vertex_label_id   = check_if_vertex_label_exists(index.vertex_label);
+        const auto key_id            = check_if_property_key_exists(index.property_key);
+
+        if (!(vertex_label_id.has_value() && key_id.has_value()) || !label_mask.test(*vertex_label_id))
+            continue;
+
+        if (const auto value = get_property_value(property_id, *key_id); value.has_value())
+            m_property_index_files[i]->remove(*value, vertex_offset);
+    }
+}
+
 int64_t
 graphquery::database::storage::CMemoryModelMMAPLPG::get_num_edges()
 {
@@ -24,14 +24,29 @@
 #include "db/storage/graph_model.h"
 #include "block_file.hpp"
 #include "index_file.hpp"
+#include "hash_index_file.hpp"
+#include "csr_file.hpp"
+#include "temporal_file.hpp"
+#include "heap_file.hpp"
+#include "column_file.hpp"
+#include "property_index_file.hpp"
 #include "transaction.h"
+#include "undo_log.hpp"
 
+#include <array>
 #include <vector>
+#include <memory>
 #include <optional>
+#include <mutex>
+#include <shared_mutex>
 
 #define DATABLOCK_EDGE_PAYLOAD_C      3 // ~ Amount of edges for edge block.
 #define DATABLOCK_PROPERTY_PAYLOAD_C  3 // ~ Amount of edges for property block.
 #define DATABLOCK_LABEL_REF_PAYLOAD_C 3 // ~ Amount of edges for label ref block.
+#define DATABLOCK_LABEL_DIR_PAYLOAD_C 4 // ~ Amount of edge label heads for label directory block.
+#define EDGE_RUN_CLASS_MIN            1 // ~ Size class of the first run of edge blocks reserved for a label segment (2 blocks).
+#define EDGE_RUN_CLASS_MAX            5 // ~ Size class of the largest run of edge blocks reserved for a label segment (32 blocks).
+#define UNDO_INLINE_RECORD_C          8 // ~ Amount of undo records of a transaction held without allocating.
 
 #define VERTEX_INITIALISED_STATE_BIT 0 // ~ Vertex state bit 0 (initialised (1) unitialised (0)), used to check if the vertex is initialised or not.
 #define VERTEX_MARKED_STATE_BIT      1 // ~ Vertex state bit 1 (marked (1) unmarked(0)), used to check if vertex has been marked for deletion.
@@ -49,6 +64,7 @@ namespace graphquery::database::storage
          *
          *  \param valid   - valid state return (no issues found during compute)
          *  \param invalid - invalid state return (issues were found during compute)
+         *  \param abort   - failed once applying, the changes applied were reverted
          ***************************************************************/
         enum class EActionState_t : int8_t
         {
@@ -57,6 +73,19 @@ namespace graphquery::database::storage
             abort   = 2
         };
 
+        /****************************************************************
+         * \enum EChainSide_t
+         * \brief Chains of the vertices an edge change is applied to.
+         *
+         *  \param both     - outgoing chain of the source and incoming chain of the destination
+         *  \param outgoing - outgoing chain of the source, the incoming chain is left to the caller
+         ***************************************************************/
+        enum class EChainSide_t : uint8_t
+        {
+            both     = 0,
+            outgoing = 1
+        };
+
       private:
         /****************************************************************
          * \struct SGraphMetaData_t
@@ -72,6 +101,14 @@ namespace graphquery::database::storage
          * \param vertex_label_table_addr uint32_t - address offset for the vertex labels
          * \param edge_label_table_addr uint32_t   - address offset for the edge labels
          * \param label_size uint32_t              - size of one label for either vertices or edges
+         * \param edge_version uint64_t            - count of edge mutations, used to validate the csr snapshot
+         * \param checkpoint_id uint64_t           - id of the last checkpoint taken of the graph
+         * \param checkpoint_lsn uint64_t          - log sequence number the last checkpoint is consistent with
+         * \param property_key_c uint16_t          - count of the property keys interned by the graph
+         * \param temporal_index_c uint8_t         - count of the temporal indexes declared on the graph
+         * \param property_column_c uint8_t        - count of the property columns declared on the graph
+         * \param property_index_c uint8_t         - count of the property indexes declared on the graph
+         * \param id_size uint8_t                  - width in bytes of Id_t the graph was created with
          ***************************************************************/
         struct SGraphMetaData_t
         {
@@ -82,10 +119,18 @@ namespace graphquery::database::storage
             uint32_t vertex_label_table_addr             = {};
             uint32_t edge_label_table_addr               = {};
             uint32_t label_size                          = {};
+            uint64_t edge_version                        = {};
+            uint64_t checkpoint_id                       = {};
+            uint64_t checkpoint_lsn                      = {};
             uint16_t vertex_label_c                      = {};
             uint16_t edge_label_c                        = {};
+            uint16_t property_key_c                      = {};
+            uint8_t temporal_index_c                     = {};
+            uint8_t property_column_c                    = {};
+            uint8_t property_index_c                     = {};
             uint8_t flush_needed                         = {};
             uint8_t prune_needed                         = {};
+            uint8_t id_size                              = {};
         };
 
         /****************************************************************
@@ -104,12 +149,191 @@ namespace graphquery::database::storage
          * \brief Structure of a vertex entry to the vertex list.
          *
          * \param metadata SVertex_t      - metadata info the vertex
-         * \param edge_idx uint32_t       - tail edge offset
+         * \param edge_idx Id_t           - tail edge offset
+         * \param in_edge_idx Id_t        - tail incoming edge offset
+         * \param label_dir_idx Id_t      - head of the edge label directory
          ***************************************************************/
         struct SVertexEntry_t
         {
             SVertex_t metadata = {};
             Id_t edge_idx      = END_INDEX;
+            Id_t in_edge_idx   = END_INDEX;
+            Id_t label_dir_idx = END_INDEX;
+        };
+
+        /****************************************************************
+         * \struct SPropertyEntry_t
+         * \brief Structure of a property entry to the property list. Values
+         *        which fit are held inline, otherwise within the heap file.
+         *
+         * \param key_id uint16_t        - id of the property key within the key dictionary
+         * \param value_length uint32_t - length of the value
+         * \param inline_value char[]   - value when no longer than the inline length
+         * \param heap_addr int64_t     - addr of the value within the heap file otherwise
+         ***************************************************************/
+        struct SPropertyEntry_t
+        {
+            uint16_t key_id       = {};
+            uint32_t value_length = {};
+
+            union
+            {
+                char inline_value[CFG_LPG_PROPERTY_INLINE_LENGTH];
+                int64_t heap_addr = {};
+            };
+        };
+
+        /****************************************************************
+         * \struct SPropertyKey_t
+         * \brief Structure of an interned property key within the key dictionary.
+         *
+         * \param key_s char[]    - str of the property key
+         * \param key_id uint16_t - unique identifier referenced by property entries
+         ***************************************************************/
+        struct SPropertyKey_t
+        {
+            char key_s[CFG_LPG_PROPERTY_KEY_LENGTH] = {};
+            uint16_t key_id                         = {};
+        };
+
+        /****************************************************************
+         * \struct SLabelDirEntry_t
+         * \brief Structure of an entry to the edge label directory of a vertex.
+         *        Edge blocks hold a single label and are kept contiguous per
+         *        label within a chain, such that the heads below mark the
+         *        start of each label segment. Blocks beyond the head are
+         *        taken from runs reserved per segment, growing geometrically
+         *        such that the segments of high degree vertices stay contiguous.
+         *
+         * \param out_idx Id_t             - head of the outgoing label segment
+         * \param in_idx Id_t              - head of the incoming label segment
+         * \param out_reserve_idx Id_t     - first block of the reserved outgoing run
+         * \param in_reserve_idx Id_t      - first block of the reserved incoming run
+         * \param edge_label_id uint16_t   - label id of the segment
+         * \param out_reserve_c uint8_t    - amount of unused blocks of the outgoing run
+         * \param in_reserve_c uint8_t     - amount of unused blocks of the incoming run
+         * \param out_run_class uint8_t    - size class of the next outgoing run
+         * \param in_run_class uint8_t     - size class of the next incoming run
+         ***************************************************************/
+        struct SLabelDirEntry_t
+        {
+            Id_t out_idx           = END_INDEX;
+            Id_t in_idx            = END_INDEX;
+            Id_t out_reserve_idx   = END_INDEX;
+            Id_t in_reserve_idx    = END_INDEX;
+            uint16_t edge_label_id = {};
+            uint8_t out_reserve_c  = {};
+            uint8_t in_reserve_c   = {};
+            uint8_t out_run_class  = EDGE_RUN_CLASS_MIN;
+            uint8_t in_run_class   = EDGE_RUN_CLASS_MIN;
+        };
+
+        /****************************************************************
+         * \struct STemporalIndex_t
+         * \brief Declaration of a temporal index, ordering the adjacency of a
+         *        vertex newest first by a timestamp property. Labels are kept
+         *        by name, as their ids are reassigned when replaying the log.
+         *
+         * \param vertex_label char[]  - label of the source vertex of the indexed edges
+         * \param edge_label char[]    - label of the indexed edges
+         * \param property_key char[]  - key of the timestamp property
+         * \param incoming uint8_t     - whether the adjacency is kept for the destination
+         * \param edge_property uint8_t - whether the property belongs to the edge, else the neighbour
+         ***************************************************************/
+        struct STemporalIndex_t
+        {
+            char vertex_label[CFG_LPG_LABEL_LENGTH]        = {};
+            char edge_label[CFG_LPG_LABEL_LENGTH]          = {};
+            char property_key[CFG_LPG_PROPERTY_KEY_LENGTH] = {};
+            uint8_t incoming                               = {};
+            uint8_t edge_property                          = {};
+        };
+
+        /****************************************************************
+         * \struct SPropertyColumn_t
+         * \brief Declaration of a property column, holding one property of
+         *        the vertices of a label by vertex offset. Kept by name, as
+         *        label and key ids are reassigned when replaying the log.
+         *
+         * \param vertex_label char[]  - label of the vertices held by the column
+         * \param property_key char[]  - key of the property held by the column
+         * \param type EColumnType_t   - declared type of the values
+         ***************************************************************/
+        struct SPropertyColumn_t
+        {
+            char vertex_label[CFG_LPG_LABEL_LENGTH]        = {};
+            char property_key[CFG_LPG_PROPERTY_KEY_LENGTH] = {};
+            EColumnType_t type                             = {};
+        };
+
+        /****************************************************************
+         * \struct SPropertyIndex_t
+         * \brief Declaration of a secondary property index, mapping the
+         *        values of a property to the vertices of a label. Kept by
+         *        name, as label and key ids are reassigned when replaying the log.
+         *
+         * \param vertex_label char[]      - label of the vertices held by the index
+         * \param property_key char[]      - key of the indexed property
+         * \param index_type EIndexType_t  - hashed or ordered index
+         * \param value_type EColumnType_t - type the values are parsed by for an ordered index
+         ***************************************************************/
+        struct SPropertyIndex_t
+        {
+            char vertex_label[CFG_LPG_LABEL_LENGTH]        = {};
+            char property_key[CFG_LPG_PROPERTY_KEY_LENGTH] = {};
+            EIndexType_t index_type                        = {};
+            EColumnType_t value_type                       = {};
+        };
+
+        /****************************************************************
+         * \enum EUndoAction_t
+         * \brief Change applied by a transaction, reverted by its undo
+         *        record should the transaction abort.
+         *
+         * \param free_vertex_block  - return the attained vertex block
+         * \param restore_vertices_c - return the counter to the id taken from it
+         ***************************************************************/
+        enum class EUndoAction_t : uint8_t
+        {
+            free_vertex_block  = 0,
+            restore_vertices_c = 1
+        };
+
+        /****************************************************************
+         * \struct SUndoRecord_t
+         * \brief Logical undo of a change applied by a transaction.
+         *
+         * \param action EUndoAction_t - change to revert
+         * \param id Id_t              - id of the vertex changed
+         * \param offset Id_t          - offset of the vertex block changed
+         ***************************************************************/
+        struct SUndoRecord_t
+        {
+            EUndoAction_t action = {};
+            Id_t id              = {};
+            Id_t offset          = {};
+        };
+
+        /****************************************************************
+         * \struct SEdgeChange_t
+         * \brief Insert or removal of an edge within a batch applied in
+         *        parallel, such as a replay phase or a bulk load. The
+         *        labels and property keys of inserts are interned
+         *        beforehand.
+         *
+         * \param src Id_t                       - id of the source vertex
+         * \param dst Id_t                       - id of the destination vertex
+         * \param edge_label string_view         - label of the edge, empty removes any label
+         * \param props const vector<SProperty_t> * - properties of an inserted edge
+         * \param undirected bool                - whether the reverse edge is inserted alongside
+         ***************************************************************/
+        struct SEdgeChange_t
+        {
+            Id_t src                               = {};
+            Id_t dst                               = {};
+            std::string_view edge_label            = {};
+            const std::vector<SProperty_t> * props = {};
+            bool undirected                        = {};
         };
 
       public:
@@ -117,6 +341,7 @@ namespace graphquery::database::storage
         ~CMemoryModelMMAPLPG() override;
 
         void close() noexcept override;
+        [[nodiscard]] bool check_if_loaded() const noexcept override;
         void create_rollback(std::string_view) noexcept override;
         void rollback(uint8_t rollback_entry) noexcept override;
         void sync_graph() noexcept override;
@@ -134,6 +359,7 @@ namespace graphquery::database::storage
         [[nodiscard]] std::vector<std::string> fetch_rollback_table() const noexcept override;
         std::unique_ptr<std::vector<std::vector<int64_t>>> make_inverse_graph() noexcept override;
         void src_edgemap(Id_t vertex_offset, const std::function<void(int64_t src, int64_t dst)> &) override;
+        void dst_edgemap(Id_t vertex_offset, const std::function<bool(int64_t src, int64_t dst)> &) override;
 
         [[nodiscard]] inline int64_t get_num_edges() override;
         [[nodiscard]] inline int64_t get_num_vertices() override;
@@ -148,10 +374,10 @@ namespace graphquery::database::storage
         [[nodiscard]] std::vector<SVertex_t> get_vertices_by_label(std::string_view label) override;
 
         [[nodiscard]] std::vector<SProperty_t> get_properties_by_id(int64_t id) override;
-        [[nodiscard]] std::vector<SProperty_t> get_properties_by_property_id(uint32_t id) override;
+        [[nodiscard]] std::vector<SProperty_t> get_properties_by_property_id(Id_t id) override;
         [[nodiscard]] std::vector<SProperty_t> get_properties_by_vertex(Id_t src) override;
         [[nodiscard]] std::unordered_map<std::string, std::string> get_properties_by_id_map(int64_t id) override;
-        [[nodiscard]] std::unordered_map<std::string, std::string> get_properties_by_property_id_map(uint32_t id) override;
+        [[nodiscard]] std::unordered_map<std::string, std::string> get_properties_by_property_id_map(Id_t id) override;
         [[nodiscard]] std::unordered_map<std::string, std::string> get_properties_by_vertex_map(Id_t src) override;
 
         [[nodiscard]] std::vector<SEdge_t> get_edges(Id_t src, Id_t dst) override;
@@ -170,94 +396,212 @@ namespace graphquery::database::storage
         [[nodiscard]] std::vector<SEdge_t> get_edges(std::string_view vertex_label, std::string_view edge_label) override;
         [[nodiscard]] std::vector<SEdge_t> get_edges(std::string_view vertex_label, std::string_view edge_label, std::string_view dst_vertex_label) override;
 
+        bool create_temporal_index(std::string_view vertex_label, std::string_view edge_label, std::string_view property_key, bool incoming, bool edge_property) override;
+        [[nodiscard]] std::optional<std::vector<STemporalEdge_t>>
+        get_recent_edges(Id_t vertex_id, std::string_view vertex_label, std::string_view edge_label, bool incoming, size_t limit, int64_t max_timestamp) override;
+
+        bool create_property_column(std::string_view vertex_label, std::string_view property_key, EColumnType_t type) override;
+        [[nodiscard]] std::optional<uint8_t> get_property_column(std::string_view vertex_label, std::string_view property_key) override;
+        [[nodiscard]] std::optional<int64_t> get_column_value(uint8_t column_id, Id_t vertex_offset) override;
+        [[nodiscard]] std::optional<std::string> get_column_string(uint8_t column_id, Id_t vertex_offset) override;
+        bool scan_property_column(uint8_t column_id, const std::function<void(const int64_t * values, const uint8_t * valid, int64_t value_c)> & func) override;
+
+        bool create_property_index(std::string_view vertex_label, std::string_view property_key, EIndexType_t index_type, EColumnType_t value_type) override;
+        [[nodiscard]] std::optional<std::vector<Id_t>> get_vertices_by_property(std::string_view vertex_label, std::string_view property_key, std::string_view value) override;
+        [[nodiscard]] std::optional<std::vector<Id_t>>
+        get_vertices_by_property_range(std::string_view vertex_label, std::string_view property_key, std::string_view lower, std::string_view upper) override;
+
         void load_graph(std::filesystem::path path, std::string_view graph) noexcept override;
         void create_graph(std::filesystem::path path, std::string_view graph) noexcept override;
         void add_vertex(const std::vector<std::string_view> & label, const std::vector<SProperty_t> & prop) override;
         void add_vertex(Id_t src, const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & prop) override;
         void add_edge(Id_t src, Id_t dst, std::string_view label, const std::vector<SProperty_t> & prop, bool undirected) override;
+        [[nodiscard]] bool commit_transaction(STransaction_t & transaction) override;
+        void bulk_load(STransaction_t & batch, bool deduplicated) override;
+        [[nodiscard]] bool finish_bulk_load() override;
 
       private:
         friend class CTransaction;
         using SVertexDataBlock   = SDataBlock_t<SVertexEntry_t, 1>;
         using SEdgeDataBlock     = SDataBlock_t<SEdgeEntry_t, DATABLOCK_EDGE_PAYLOAD_C>;
-        using SPropertyDataBlock = SDataBlock_t<SProperty_t, DATABLOCK_PROPERTY_PAYLOAD_C>;
+        using SPropertyDataBlock = SDataBlock_t<SPropertyEntry_t, DATABLOCK_PROPERTY_PAYLOAD_C>;
         using SLabelRefDataBlock = SDataBlock_t<uint16_t, DATABLOCK_LABEL_REF_PAYLOAD_C>;
+        using SLabelDirDataBlock = SDataBlock_t<SLabelDirEntry_t, DATABLOCK_LABEL_DIR_PAYLOAD_C>;
+        using CTransactionUndoLog = CUndoLog<SUndoRecord_t, UNDO_INLINE_RECORD_C>;
 
-        void rollback() noexcept;
+        void undo_transaction(CTransactionUndoLog & undo_log) noexcept;
         void reset_graph() noexcept;
+        [[nodiscard]] bool checkpoint() noexcept;
+        [[nodiscard]] bool stamp_checkpoint(const std::filesystem::path & path, uint64_t checkpoint_id, uint64_t checkpoint_lsn) const noexcept;
+        [[nodiscard]] uint64_t restore_graph() noexcept;
+        [[nodiscard]] std::optional<std::filesystem::path> get_checkpoint_path() const noexcept;
+        [[nodiscard]] bool save_model_files(const std::filesystem::path & path) noexcept;
+        void restore_model_files(const std::filesystem::path & path) noexcept;
         void inline setup_files(const std::filesystem::path & path, bool initialise) noexcept;
+        void setup_temporal_files(const std::filesystem::path & path, bool initialise) noexcept;
+        void setup_column_files(const std::filesystem::path & path, bool initialise) noexcept;
+        void setup_property_index_files(const std::filesystem::path & path, bool initialise) noexcept;
         void persist_graph_changes() noexcept;
+        void build_csr_snapshot() noexcept;
+        inline void update_edge_version() noexcept;
+        [[nodiscard]] bool check_if_csr_valid() noexcept;
 
-        std::optional<SRef_t<SVertexDataBlock>> get_vertex_by_offset(uint32_t offset) noexcept;
+        std::optional<SRef_t<SVertexDataBlock>> get_vertex_by_offset(Id_t offset) noexcept;
         void read_index_list() noexcept;
         void define_luts() noexcept;
         void store_graph_metadata() noexcept;
-        [[nodiscard]] Id_t store_label_entry(uint16_t label_id, Id_t next_ref) noexcept;
         [[nodiscard]] Id_t store_property_entry(const SProperty_t & prop, Id_t next_ref) noexcept;
-        [[nodiscard]] bool store_index_entry(Id_t id, const std::unordered_set<uint16_t> & label_ids, uint32_t vertex_offset) noexcept;
-        [[nodiscard]] bool store_vertex_entry(Id_t id, const std::unordered_set<uint16_t> & label_id, const std::vector<SProperty_t> & props) noexcept;
+        [[nodiscard]] inline SProperty_t read_property_entry(const SPropertyEntry_t & entry) noexcept;
+        [[nodiscard]] inline std::string read_property_value(const SPropertyEntry_t & entry) noexcept;
+        [[nodiscard]] std::optional<std::string> get_property_value(Id_t property_id, uint16_t key_id) noexcept;
+        [[nodiscard]] bool store_index_entry(Id_t id, const std::unordered_set<uint16_t> & label_ids, Id_t vertex_offset) noexcept;
+        [[nodiscard]] bool store_vertex_entry(Id_t id, const std::unordered_set<uint16_t> & label_id, const std::vector<SProperty_t> & props, CTransactionUndoLog & undo_log) noexcept;
         void store_edge_entry(Id_t src, Id_t dst, uint16_t edge_label_id, const std::vector<SProperty_t> & props) noexcept;
+        [[nodiscard]] SEdge_t store_out_edge_entry(Id_t src, Id_t dst, uint16_t edge_label_id, const std::vector<SProperty_t> & props) noexcept;
+        void store_in_edge_entry(const SEdge_t & edge) noexcept;
+
+        template<bool incoming>
+        [[nodiscard]] SRef_t<SEdgeDataBlock, true> attain_label_edge_block(SRef_t<SVertexDataBlock, true> & vertex_ptr, uint16_t edge_label_id) noexcept;
+        [[nodiscard]] std::pair<SRef_t<SLabelDirDataBlock, true>, uint8_t> attain_label_dir_entry(SRef_t<SVertexDataBlock, true> & vertex_ptr, uint16_t edge_label_id) noexcept;
+        [[nodiscard]] Id_t get_label_edge_head(Id_t label_dir_idx, uint16_t edge_label_id, bool incoming) noexcept;
+        void update_label_edge_head(Id_t label_dir_idx, uint16_t edge_label_id, bool incoming, Id_t removed_ref, Id_t next_ref) noexcept;
+
+        [[nodiscard]] std::optional<uint8_t> get_temporal_index(std::string_view vertex_label, std::string_view edge_label, bool incoming) noexcept;
+        [[nodiscard]] std::optional<int64_t> get_temporal_timestamp(const STemporalIndex_t & index, const SEdge_t & edge) noexcept;
+        void store_temporal_entries(const SEdge_t & edge, bool incoming) noexcept;
+        void rm_temporal_entries(Id_t src_idx, Id_t dst_idx, std::optional<uint16_t> edge_label_id, std::optional<bool> incoming = std::nullopt) noexcept;
+        void store_column_entries(Id_t vertex_offset, const std::unordered_set<uint16_t> & label_ids, const std::vector<SProperty_t> & props) noexcept;
+
+        [[nodiscard]] std::optional<uint8_t> get_property_index(std::string_view vertex_label, std::string_view property_key) noexcept;
+        void store_property_index_entries(Id_t vertex_offset, const std::unordered_set<uint16_t> & label_ids, const std::vector<SProperty_t> & props) noexcept;
+        void rm_property_index_entries(Id_t vertex_offset, const std::bitset<CFG_LPG_VERTEX_LABELS_MAX_AMT> & label_mask, Id_t property_id) noexcept;
 
         template<bool write = false>
         inline SRef_t<SGraphMetaData_t, write> read_graph_metadata() noexcept;
+        template<bool write = false>
+        inline SRef_t<STemporalIndex_t, write> read_temporal_index_entry(uint32_t offset) noexcept;
+        template<bool write = false>
+        inline SRef_t<SPropertyColumn_t, write> read_property_column_entry(uint32_t offset) noexcept;
+        template<bool write = false>
+        inline SRef_t<SPropertyIndex_t, write> read_property_index_entry(uint32_t offset) noexcept;
 
         template<bool write = false>
         inline SRef_t<SLabel_t, write> read_vertex_label_entry(uint32_t offset) noexcept;
         template<bool write = false>
         inline SRef_t<SLabel_t, write> read_edge_label_entry(uint32_t offset) noexcept;
+        template<bool write = false>
+        inline SRef_t<SPropertyKey_t, write> read_property_key_entry(uint32_t offset) noexcept;
 
         [[nodiscard]] EActionState_t rm_vertex_entry(Id_t src) noexcept;
-        [[nodiscard]] EActionState_t rm_edge_entry(Id_t src, Id_t dst) noexcept;
-        [[nodiscard]] EActionState_t rm_edge_entry(Id_t src, Id_t dst, std::string_view edge_label) noexcept;
+        [[nodiscard]] EActionState_t rm_edge_entry(Id_t src, Id_t dst, EChainSide_t chains = EChainSide_t::both) noexcept;
+        [[nodiscard]] EActionState_t rm_edge_entry(Id_t src, Id_t dst, std::string_view edge_label, EChainSide_t chains = EChainSide_t::both) noexcept;
+        [[nodiscard]] Id_t rm_in_edge_entries(Id_t src_idx, Id_t dst_idx, std::optional<uint16_t> edge_label_id) noexcept;
 
         [[nodiscard]] EActionState_t add_vertex_entry(Id_t id, const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & props) noexcept;
         [[nodiscard]] EActionState_t add_vertex_entry(const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & props) noexcept;
-        [[nodiscard]] EActionState_t add_edge_entry(Id_t src, Id_t dst, std::string_view edge_label, const std::vector<SProperty_t> & props, bool undirected) noexcept;
+        [[nodiscard]] EActionState_t add_edge_entry(Id_t src, Id_t dst, std::string_view edge_label, const std::vector<SProperty_t> & props, bool undirected, bool deduplicated = false) noexcept;
+        [[nodiscard]] uint64_t add_edge_entries(const std::vector<SEdgeChange_t> & changes, bool deduplicated) noexcept;
+        [[nodiscard]] uint64_t rm_edge_entries(const std::vector<SEdgeChange_t> & changes) noexcept;
+        [[nodiscard]] EActionState_t apply_mutation(const SMutation_t & mutation, std::vector<SMutation_t> & undo) noexcept;
+        void undo_mutations(std::vector<SMutation_t> & undo) noexcept;
+        void read_edge_mutations(Id_t vertex_idx, bool incoming, const std::function<bool(const SEdge_t &)> & pred, std::vector<SMutation_t> & mutations) noexcept;
+        [[nodiscard]] SMutation_t make_edge_mutation(const SEdge_t & edge) noexcept;
+        void free_vertex_entry(const SVertex_t & metadata, Id_t vertex_offset) noexcept;
 
         [[nodiscard]] bool contains_vertex_label_id(int64_t vertex_offset, uint16_t label_id) noexcept;
         [[nodiscard]] uint16_t create_edge_label(std::string_view) noexcept;
         [[nodiscard]] uint16_t create_vertex_label(std::string_view) noexcept;
+        [[nodiscard]] std::optional<uint16_t> create_property_key(std::string_view) noexcept;
+        [[nodiscard]] bool intern_property_keys(const std::vector<SProperty_t> & props) noexcept;
+        [[nodiscard]] inline std::optional<uint16_t> check_if_property_key_exists(const std::string_view &) noexcept;
         [[nodiscard]] inline bool check_if_edge_exists(Id_t src_idx, Id_t dst_idx, uint16_t edge_label_id) noexcept;
         [[nodiscard]] inline std::optional<uint16_t> check_if_edge_label_exists(const std::string_view &) noexcept;
         [[nodiscard]] inline std::optional<uint16_t> check_if_vertex_label_exists(const std::string_view &) noexcept;
         [[nodiscard]] inline std::unordered_set<uint16_t> get_vertex_labels(const std::vector<std::string_view> & labels, bool create_if_absent = false) noexcept;
+        void intern_vertex_names(const std::vector<std::string_view> & labels, const std::vector<SProperty_t> & props) noexcept;
+        void intern_edge_names(std::string_view edge_label, const std::vector<SProperty_t> & props) noexcept;
 
         [[nodiscard]] std::optional<SRef_t<SVertexDataBlock>> get_vertex_by_id(Id_t id) noexcept;
+        [[nodiscard]] std::optional<Id_t> lookup_vertex(Id_t id) noexcept;
+        [[nodiscard]] std::vector<SProperty_t> read_property_chain(Id_t property_id) noexcept;
         [[nodiscard]] std::vector<int64_t> get_vertices_offset_by_label(std::string_view label);
-        [[nodiscard]] std::vector<SEdge_t> get_edges_by_offset(uint32_t src_vertex_id, uint32_t dst_vertex_id);
-        [[nodiscard]] std::vector<SEdge_t> get_edges_by_offset(uint32_t vertex_id, const std::function<bool(const SEdge_t &)> & pred);
-        [[nodiscard]] std::vector<SEdge_t> get_edges_by_offset(uint32_t src_vertex_id, uint32_t dst_vertex_id, const std::function<bool(const SEdge_t &)> & pred);
-        [[nodiscard]] std::vector<SEdge_t> get_edges_by_offset(uint32_t vertex_id, uint16_t edge_label_id, const std::function<bool(const SEdge_t &)> & pred);
+        [[nodiscard]] std::vector<SEdge_t> get_edges_by_offset(Id_t src_vertex_id, Id_t dst_vertex_id);
+        [[nodiscard]] std::vector<SEdge_t> get_edges_by_offset(Id_t vertex_id, const std::function<bool(const SEdge_t &)> & pred);
+        [[nodiscard]] std::vector<SEdge_t> get_edges_by_offset(Id_t src_vertex_id, Id_t dst_vertex_id, const std::function<bool(const SEdge_t &)> & pred);
+        [[nodiscard]] std::vector<SEdge_t> get_edges_by_offset(Id_t vertex_id, uint16_t edge_label_id, const std::function<bool(const SEdge_t &)> & pred);
         [[nodiscard]] std::vector<SEdge_t> get_edges_by_id(Id_t src, const std::function<bool(const SEdge_t &)> & pred);
+        [[nodiscard]] std::vector<SEdge_t> get_in_edges_by_offset(Id_t vertex_id, const std::function<bool(const SEdge_t &)> & pred);
+
+        template<bool incoming>
+        [[nodiscard]] std::vector<SEdge_t> get_label_edges_by_offset(Id_t vertex_id, uint16_t edge_label_id, const std::function<bool(const SEdge_t &)> & pred);
+        [[nodiscard]] std::optional<std::vector<SEdge_t>> get_csr_edges_by_offset(Id_t vertex_id, const std::function<bool(const SEdge_t &)> & pred) noexcept;
 
         std::string m_graph_name;
         std::string m_graph_path;
+        bool m_loaded = {}; //~ Whether the graph files are opened, solely then are they synced and closed.
         std::vector<std::vector<Id_t>> m_label_vertex;
         std::unordered_map<std::string, uint16_t> m_v_label_map;
         std::unordered_map<std::string, uint16_t> m_e_label_map;
+        std::unordered_map<std::string, uint16_t> m_p_key_map;
 
         //~ Disk/file drivers for graph mapping from disk to memory
         CDiskDriver m_master_file;
-        CIndexFile m_index_file;
+        CHashIndexFile m_index_file;
         CDatablockFile<SVertexEntry_t> m_vertices_file;
         CDatablockFile<SEdgeEntry_t, DATABLOCK_EDGE_PAYLOAD_C> m_edges_file;
-        CDatablockFile<SProperty_t, DATABLOCK_PROPERTY_PAYLOAD_C> m_properties_file;
+        CDatablockFile<SEdgeEntry_t, DATABLOCK_EDGE_PAYLOAD_C> m_in_edges_file;
+        CDatablockFile<SPropertyEntry_t, DATABLOCK_PROPERTY_PAYLOAD_C> m_properties_file;
+        CHeapFile m_heap_file;
         CDatablockFile<uint16_t, DATABLOCK_LABEL_REF_PAYLOAD_C> m_label_ref_file;
+        CDatablockFile<SLabelDirEntry_t, DATABLOCK_LABEL_DIR_PAYLOAD_C> m_label_dir_file;
+        CCSRFile m_csr_file;
+        std::vector<std::unique_ptr<CTemporalFile>> m_temporal_files;
+        std::vector<std::unique_ptr<CColumnFile>> m_column_files;
+        std::vector<std::unique_ptr<CPropertyIndexFile>> m_property_index_files;
+        std::shared_mutex m_csr_lock;
+        //~ Mutations hold the lock shared, such that a checkpoint or csr snapshot is taken once those running drain.
+        std::shared_mutex m_checkpoint_lock;
+        //~ Held exclusively whilst a transaction applies, readers take it shared such that none observes part of it. Taken prior to the checkpoint lock.
+        std::shared_mutex m_transaction_lock;
+        //~ Guards appending to the vertex lists of a label, as vertices are inserted concurrently.
+        std::mutex m_label_vertex_lock;
         std::shared_ptr<CTransaction> m_transactions = {};
 
         utils::CThreadPool<8> m_thread_pool;
-        static constexpr uint8_t VERTEX_LABELS_MAX_AMT = 128;
-        static constexpr uint8_t EDGE_LABELS_MAX_AMT   = 128;
-        static constexpr uint32_t METADATA_START_ADDR  = 0x00000000;
+        static constexpr uint8_t VERTEX_LABELS_MAX_AMT    = CFG_LPG_VERTEX_LABELS_MAX_AMT;
+        static constexpr uint8_t EDGE_LABELS_MAX_AMT      = 128;
+        static constexpr uint8_t TEMPORAL_INDEX_MAX_AMT   = 8;
+        static constexpr uint16_t PROPERTY_KEYS_MAX_AMT   = 1024;
+        static constexpr uint8_t PROPERTY_COLUMNS_MAX_AMT = 32;
+        static constexpr uint8_t PROPERTY_INDEX_MAX_AMT   = 32;
+        static constexpr uint32_t METADATA_START_ADDR     = 0x00000000;
+        static constexpr uint64_t CSR_REBUILD_DELTA       = 1 << 16; //~ Amount of edge mutations before the csr snapshot is rebuilt on sync.
+        static constexpr uint32_t BATCH_PARTITION_C       = 64;      //~ Partitions of a batch applied in parallel, each vertex is changed by a single one.
 
         static constexpr const char * MASTER_FILE_NAME     = "master";
         static constexpr const char * INDEX_FILE_NAME      = "index";
         static constexpr const char * VERTICES_FILE_NAME   = "vertices";
         static constexpr const char * EDGES_FILE_NAME      = "edges";
+        static constexpr const char * IN_EDGES_FILE_NAME   = "in_edges";
         static constexpr const char * PROPERTIES_FILE_NAME = "properties";
+        static constexpr const char * HEAP_FILE_NAME       = "property_heap";
         static constexpr const char * LABEL_REF_FILE_NAME  = "label_map";
+        static constexpr const char * LABEL_DIR_FILE_NAME  = "label_dir";
+        static constexpr const char * CSR_FILE_NAME        = "csr";
+        static constexpr const char * TEMPORAL_FILE_NAME   = "temporal";
+        static constexpr const char * COLUMN_FILE_NAME     = "column";
+        static constexpr const char * PROPERTY_INDEX_NAME  = "property_index";
+        static constexpr const char * CHECKPOINT_NAME      = "checkpoint";
+        static constexpr const char * STAGING_SUFFIX       = ".staging";
+
+        static constexpr uint32_t VERTEX_LABELS_START_ADDR  = METADATA_START_ADDR + sizeof(SGraphMetaData_t);
+        static constexpr uint32_t EDGE_LABELS_START_ADDR    = METADATA_START_ADDR + sizeof(SGraphMetaData_t) + sizeof(SLabel_t) * VERTEX_LABELS_MAX_AMT;
+        static constexpr uint32_t TEMPORAL_INDEX_START_ADDR = EDGE_LABELS_START_ADDR + sizeof(SLabel_t) * EDGE_LABELS_MAX_AMT;
+        static constexpr uint32_t PROPERTY_KEYS_START_ADDR  = TEMPORAL_INDEX_START_ADDR + sizeof(STemporalIndex_t) * TEMPORAL_INDEX_MAX_AMT;
+        static constexpr uint32_t PROPERTY_COLS_START_ADDR  = PROPERTY_KEYS_START_ADDR + sizeof(SPropertyKey_t) * PROPERTY_KEYS_MAX_AMT;
+        static constexpr uint32_t PROPERTY_IDXS_START_ADDR  = PROPERTY_COLS_START_ADDR + sizeof(SPropertyColumn_t) * PROPERTY_COLUMNS_MAX_AMT;
 
-        static constexpr uint32_t VERTEX_LABELS_START_ADDR = METADATA_START_ADDR + sizeof(SGraphMetaData_t);
-        static constexpr uint32_t EDGE_LABELS_START_ADDR   = METADATA_START_ADDR + sizeof(SGraphMetaData_t) + sizeof(SLabel_t) * VERTEX_LABELS_MAX_AMT;
+        template<typename Func>
+        [[nodiscard]] static std::array<std::vector<uint32_t>, BATCH_PARTITION_C> partition_batch(uint32_t item_c, Func && vertex_of) noexcept;
     };
 } // namespace graphquery::database::storage
@@ -0,0 +1,215 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file property_index_file.hpp
+ * \brief Secondary index of a property of a vertex label,
+ *        mapping property values to the offsets of the vertices
+ *        holding them, either hashed for equality or ordered for
+ *        ranges. Helper class for lpg mmap memory model.
+ ************************************************************/
+
+#pragma once
+
+#include "db/storage/graph_model.h"
+#include "hash_index_file.hpp"
+#include "bptree_file.hpp"
+#include "column_file.hpp"
+
+#include <bit>
+#include <charconv>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+namespace graphquery::database::storage
+{
+    class CPropertyIndexFile
+    {
+      public:
+        using EIndexType_t  = ILPGModel::EIndexType_t;
+        using EColumnType_t = ILPGModel::EColumnType_t;
+
+        ~CPropertyIndexFile() = default;
+        CPropertyIndexFile()  = default;
+        CPropertyIndexFile(const CPropertyIndexFile &)                 = delete;
+        CPropertyIndexFile(CPropertyIndexFile &&) noexcept             = delete;
+        CPropertyIndexFile & operator=(const CPropertyIndexFile &)     = delete;
+        CPropertyIndexFile & operator=(CPropertyIndexFile &&) noexcept = delete;
+
+        void reset() noexcept;
+        [[nodiscard]] bool save(const std::filesystem::path & folder_path) noexcept;
+        void restore(const std::filesystem::path & folder_path) noexcept;
+        inline void store_metadata() noexcept;
+        void open(const std::filesystem::path & path, std::string_view file_name, bool create, EIndexType_t index_type, EColumnType_t value_type) noexcept;
+        void insert(std::string_view value, Id_t vertex_offset) noexcept;
+        void remove(std::string_view value, Id_t vertex_offset) noexcept;
+        [[nodiscard]] std::vector<Id_t> lookup(std::string_view value) noexcept;
+        [[nodiscard]] std::vector<Id_t> range(std::string_view lower, std::string_view upper) noexcept;
+        [[nodiscard]] std::optional<int64_t> encode(std::string_view value) const noexcept;
+        [[nodiscard]] EIndexType_t get_index_type() const noexcept;
+
+      private:
+        [[nodiscard]] static inline uint64_t hash_value(std::string_view value) noexcept;
+
+        //~ Solely one of the files is opened, depending on the index type.
+        std::unique_ptr<CHashIndexFile> m_hash;
+        std::unique_ptr<CBPTreeFile> m_tree;
+        EIndexType_t m_index_type  = {};
+        EColumnType_t m_value_type = {};
+    };
+} // namespace graphquery::database::storage
+
+inline void
+graphquery::database::storage::CPropertyIndexFile::open(const std::filesystem::path & path,
+                                                        const std::string_view file_name,
+                                                        const bool create,
+                                                        const EIndexType_t index_type,
+                                                        const EColumnType_t value_type) noexcept
+{
+    m_index_type = index_type;
+    m_value_type = value_type;
+
+    if (m_index_type == EIndexType_t::hash)
+    {
+        m_hash = std::make_unique<CHashIndexFile>();
+        m_hash->open(path, file_name, create);
+    }
+    else
+    {
+        m_tree = std::make_unique<CBPTreeFile>();
+        m_tree->open(path, file_name, create);
+    }
+}
+
+inline void
+graphquery::database::storage::CPropertyIndexFile::store_metadata() noexcept
+{
+    if (m_index_type == EIndexType_t::hash)
+        m_hash->store_metadata();
+    else
+        m_tree->store_metadata();
+}
+
+inline void
+graphquery::database::storage::CPropertyIndexFile::reset() noexcept
+{
+    if (m_index_type == EIndexType_t::hash)
+        m_hash->reset();
+    else
+        m_tree->reset();
+}
+
+inline bool
+graphquery::database::storage::CPropertyIndexFile::save(const std::filesystem::path & folder_path) noexcept
+{
+    if (m_index_type == EIndexType_t::hash)
+        return m_hash->save(folder_path);
+    return m_tree->save(folder_path);
+}
+
+inline void
+graphquery::database::storage::CPropertyIndexFile::restore(const std::filesystem::path & folder_path) noexcept
+{
+    if (m_index_type == EIndexType_t::hash)
+        m_hash->restore(folder_path);
+    else
+        m_tree->restore(folder_path);
+}
+
+inline graphquery::database::storage::CPropertyIndexFile::EIndexType_t
+graphquery::database::storage::CPropertyIndexFile::get_index_type() const noexcept
+{
+    return m_index_type;
+}
+
+inline uint64_t
+graphquery::database::storage::CPropertyIndexFile::hash_value(const std::string_view value) noexcept
+{
+    //~ FNV-1a, as the hash is persisted it must not vary between builds.
+    uint64_t ret = 0xcbf29ce484222325ULL;
+
+    for (const char c : value)
+        ret = (ret ^ static_cast<uint8_t>(c)) * 0x100000001b3ULL;
+    return ret;
+}
+
+inline std::optional<int64_t>
+graphquery::database::storage::CPropertyIndexFile::encode(const std::string_view value) const noexcept
+{
+    int64_t ret = {};
+
+    switch (m_value_type)
+    {
+    case EColumnType_t::int64:
+        if (const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), ret); ec != std::errc())
+            return std::nullopt;
+        return ret;
+    case EColumnType_t::date: return utils::parse_date(value);
+    case EColumnType_t::float64:
+    {
+        double real = {};
+        if (const auto [ptr, ec] = std::from_chars(value.data(), value.data() + value.size(), real); ec != std::errc())
+            return std::nullopt;
+
+        //~ Flip the magnitude of negative values, such that the bit patterns order as the doubles do.
+        ret = std::bit_cast<int64_t>(real);
+        return ret < 0 ? ret ^ std::numeric_limits<int64_t>::max() : ret;
+    }
+    case EColumnType_t::string: return std::nullopt;
+    }
+
+    return std::nullopt;
+}
+
+inline void
+graphquery::database::storage::CPropertyIndexFile::insert(const std::string_view value, const Id_t vertex_offset) noexcept
+{
+    if (m_index_type == EIndexType_t::hash)
+    {
+        (void) m_hash->store_multi_entry(hash_value(value), vertex_offset);
+        return;
+    }
+
+    if (const auto key = encode(value); key.has_value())
+        m_tree->insert(*key, vertex_offset);
+}
+
+inline void
+graphquery::database::storage::CPropertyIndexFile::remove(const std::string_view value, const Id_t vertex_offset) noexcept
+{
+    if (m_index_type == EIndexType_t::hash)
+    {
+        (void) m_hash->remove(hash_value(value), vertex_offset);
+        return;
+    }
+
+    if (const auto key = encode(value); key.has_value())
+        (void) m_tree->remove(*key, vertex_offset);
+}
+
+inline std::vector<graphquery::database::storage::Id_t>
+graphquery::database::storage::CPropertyIndexFile::lookup(const std::string_view value) noexcept
+{
+    //~ Hashed candidates may collide, therefore the caller verifies them against the stored value.
+    if (m_index_type == EIndexType_t::hash)
+        return m_hash->lookup_all(hash_value(value));
+
+    return range(value, value);
+}
+
+inline std::vector<graphquery::database::storage::Id_t>
+graphquery::database::storage::CPropertyIndexFile::range(const std::string_view lower, const std::string_view upper) noexcept
+{
+    std::vector<Id_t> ret = {};
+    const auto lower_key  = encode(lower);
+    const auto upper_key  = encode(upper);
+
+    if (m_index_type != EIndexType_t::ordered || !(lower_key.has_value() && upper_key.has_value()))
+        return ret;
+
+    m_tree->range(*lower_key, *upper_key, [&ret](int64_t, const Id_t vertex_offset) -> void { ret.emplace_back(vertex_offset); });
+    return ret;
+}
@@ -0,0 +1,330 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file temporal_file.hpp
+ * \brief Secondary adjacency of a vertex ordered newest first by
+ *        a timestamp, such that the most recent neighbours can be
+ *        read without visiting the entire adjacency. Helper class
+ *        for lpg mmap memory model.
+ ************************************************************/
+
+#pragma once
+
+#include "db/storage/diskdriver/diskdriver.h"
+#include "db/utils/atomic_intrinsics.h"
+#include "db/storage/graph_model.h"
+#include "block_file.hpp"
+#include "index_file.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#define DATABLOCK_TEMPORAL_PAYLOAD_C 4 // ~ Amount of timestamped edges for temporal block.
+
+namespace graphquery::database::storage
+{
+    class CTemporalFile
+    {
+      public:
+        using STemporalEdge_t      = ILPGModel::STemporalEdge_t;
+        using STemporalDataBlock_t = SDataBlock_t<STemporalEdge_t, DATABLOCK_TEMPORAL_PAYLOAD_C>;
+
+        ~CTemporalFile() = default;
+        CTemporalFile()  = default;
+        CTemporalFile(const CTemporalFile &)                 = delete;
+        CTemporalFile(CTemporalFile &&) noexcept             = delete;
+        CTemporalFile & operator=(const CTemporalFile &)     = delete;
+        CTemporalFile & operator=(CTemporalFile &&) noexcept = delete;
+
+        void reset() noexcept;
+        [[nodiscard]] bool save(const std::filesystem::path & folder_path) noexcept;
+        void restore(const std::filesystem::path & folder_path) noexcept;
+        inline void store_metadata() noexcept;
+        void open(const std::filesystem::path & path, std::string_view file_name, bool create) noexcept;
+        void insert(Id_t vertex_offset, const STemporalEdge_t & entry) noexcept;
+        Id_t remove(Id_t vertex_offset, const std::function<bool(const STemporalEdge_t &)> & pred) noexcept;
+        [[nodiscard]] std::vector<STemporalEdge_t> get_recent(Id_t vertex_offset, int64_t max_timestamp, size_t limit, const std::function<bool(const STemporalEdge_t &)> & pred) noexcept;
+
+      private:
+        [[nodiscard]] static inline Id_t read_head(const CIndexFile::SIndexEntry_t * head_ptr) noexcept;
+        static inline void store_head(CIndexFile::SIndexEntry_t * head_ptr, Id_t head) noexcept;
+        inline void store_in_block(Id_t block_offset, const STemporalEdge_t & entry) noexcept;
+        [[nodiscard]] inline Id_t link_new_block(CIndexFile::SIndexEntry_t * head_ptr, Id_t prev_ref, Id_t next_ref, const STemporalEdge_t & entry) noexcept;
+        [[nodiscard]] static inline int64_t min_timestamp(const STemporalDataBlock_t & block) noexcept;
+        [[nodiscard]] static inline int64_t max_timestamp(const STemporalDataBlock_t & block) noexcept;
+
+        //~ Heads of each vertex adjacency, using the index set flag to mark an existing adjacency.
+        CIndexFile m_heads;
+        //~ Blocks are ordered such that each entry is at least as recent as the entries of the following blocks.
+        CDatablockFile<STemporalEdge_t, DATABLOCK_TEMPORAL_PAYLOAD_C> m_entries;
+
+        static constexpr const char * HEADS_FILE_SUFFIX = "_heads";
+    };
+} // namespace graphquery::database::storage
+
+inline void
+graphquery::database::storage::CTemporalFile::store_metadata() noexcept
+{
+    m_heads.store_metadata();
+    m_entries.store_metadata();
+}
+
+inline void
+graphquery::database::storage::CTemporalFile::open(const std::filesystem::path & path, const std::string_view file_name, const bool create) noexcept
+{
+    const std::string heads_file_name = std::string(file_name) + HEADS_FILE_SUFFIX;
+
+    m_heads.open(path, heads_file_name, create);
+    m_entries.open(path, file_name, create);
+}
+
+inline void
+graphquery::database::storage::CTemporalFile::reset() noexcept
+{
+    m_heads.reset();
+    m_entries.reset();
+}
+
+inline bool
+graphquery::database::storage::CTemporalFile::save(const std::filesystem::path & folder_path) noexcept
+{
+    return m_heads.save(folder_path) && m_entries.save(folder_path);
+}
+
+inline void
+graphquery::database::storage::CTemporalFile::restore(const std::filesystem::path & folder_path) noexcept
+{
+    m_heads.restore(folder_path);
+    m_entries.restore(folder_path);
+}
+
+inline graphquery::database::storage::Id_t
+graphquery::database::storage::CTemporalFile::read_head(const CIndexFile::SIndexEntry_t * head_ptr) noexcept
+{
+    return utils::atomic_load(&head_ptr->set) ? utils::atomic_load(&head_ptr->offset) : static_cast<Id_t>(END_INDEX);
+}
+
+inline void
+graphquery::database::storage::CTemporalFile::store_head(CIndexFile::SIndexEntry_t * head_ptr, const Id_t head) noexcept
+{
+    utils::atomic_store(&head_ptr->offset, head);
+    utils::atomic_store(&head_ptr->set, static_cast<uint8_t>(head != END_INDEX));
+}
+
+inline void
+graphquery::database::storage::CTemporalFile::store_in_block(const Id_t block_offset, const STemporalEdge_t & entry) noexcept
+{
+    auto block_ptr = m_entries.read_entry<true>(block_offset);
+    uint8_t slot   = 0;
+
+    while (block_ptr->state.test(slot))
+        slot++;
+
+    block_ptr->payload[slot] = entry;
+    block_ptr->state.set(slot);
+    utils::atomic_fetch_inc(&block_ptr->payload_amt);
+}
+
+inline graphquery::database::storage::Id_t
+graphquery::database::storage::CTemporalFile::link_new_block(CIndexFile::SIndexEntry_t * head_ptr, const Id_t prev_ref, const Id_t next_ref, const STemporalEdge_t & entry) noexcept
+{
+    Id_t block_offset = END_INDEX;
+    {
+        auto block_ptr = m_entries.attain_new_data_block(next_ref);
+        block_offset   = block_ptr->idx;
+    }
+
+    store_in_block(block_offset, entry);
+
+    if (prev_ref == END_INDEX)
+        store_head(head_ptr, block_offset);
+    else
+        utils::atomic_store(&m_entries.read_entry<true>(prev_ref)->next, block_offset);
+
+    return block_offset;
+}
+
+inline int64_t
+graphquery::database::storage::CTemporalFile::min_timestamp(const STemporalDataBlock_t & block) noexcept
+{
+    int64_t ret = std::numeric_limits<int64_t>::max();
+
+    for (size_t i = 0; i < block.payload.size(); i++)
+    {
+        if (block.state.test(i))
+            ret = std::min(ret, block.payload[i].timestamp);
+    }
+    return ret;
+}
+
+inline int64_t
+graphquery::database::storage::CTemporalFile::max_timestamp(const STemporalDataBlock_t & block) noexcept
+{
+    int64_t ret = std::numeric_limits<int64_t>::min();
+
+    for (size_t i = 0; i < block.payload.size(); i++)
+    {
+        if (block.state.test(i))
+            ret = std::max(ret, block.payload[i].timestamp);
+    }
+    return ret;
+}
+
+inline void
+graphquery::database::storage::CTemporalFile::insert(const Id_t vertex_offset, const STemporalEdge_t & entry) noexcept
+{
+    //~ Holding the head table exclusively serialises writers and excludes readers of the adjacency.
+    auto head_ptr = m_heads.read_entry<true>(vertex_offset);
+
+    Id_t prev = END_INDEX;
+    Id_t curr = read_head(head_ptr.ref);
+
+    //~ Find the first block which does not solely hold newer entries.
+    while (curr != END_INDEX)
+    {
+        auto block_ptr = m_entries.read_entry(curr);
+        if (entry.timestamp >= min_timestamp(*block_ptr.ref))
+            break;
+
+        prev = curr;
+        curr = block_ptr->next;
+    }
+
+    const auto is_full = [this](const Id_t block_offset) -> bool { return block_offset != END_INDEX && m_entries.read_entry(block_offset)->state.all(); };
+
+    //~ Older than every entry, therefore append to the tail.
+    if (curr == END_INDEX)
+    {
+        if (prev != END_INDEX && !is_full(prev))
+            store_in_block(prev, entry);
+        else
+            (void) link_new_block(head_ptr.ref, prev, END_INDEX, entry);
+        return;
+    }
+
+    if (!is_full(curr))
+    {
+        store_in_block(curr, entry);
+        return;
+    }
+
+    //~ Newer than the full block, place it in between the previous block and itself.
+    if (entry.timestamp >= max_timestamp(*m_entries.read_entry(curr).ref))
+    {
+        if (prev != END_INDEX && !is_full(prev))
+            store_in_block(prev, entry);
+        else
+            (void) link_new_block(head_ptr.ref, prev, curr, entry);
+        return;
+    }
+
+    //~ Otherwise evict the oldest entry of the full block towards the following block.
+    STemporalEdge_t evicted = {};
+    Id_t next               = END_INDEX;
+    {
+        auto block_ptr = m_entries.read_entry<true>(curr);
+        uint8_t slot   = 0;
+
+        for (uint8_t i = 1; i < block_ptr->payload.size(); i++)
+        {
+            if (block_ptr->payload[i].timestamp < block_ptr->payload[slot].timestamp)
+                slot = i;
+        }
+
+        evicted                  = block_ptr->payload[slot];
+        block_ptr->payload[slot] = entry;
+        next                     = block_ptr->next;
+    }
+
+    if (next != END_INDEX && !is_full(next))
+        store_in_block(next, evicted);
+    else
+        (void) link_new_block(head_ptr.ref, curr, next, evicted);
+}
+
+inline graphquery::database::storage::Id_t
+graphquery::database::storage::CTemporalFile::remove(const Id_t vertex_offset, const std::function<bool(const STemporalEdge_t &)> & pred) noexcept
+{
+    auto head_ptr = m_heads.read_entry<true>(vertex_offset);
+
+    Id_t prev    = END_INDEX;
+    Id_t curr    = read_head(head_ptr.ref);
+    Id_t entry_c = 0;
+
+    while (curr != END_INDEX)
+    {
+        Id_t next       = END_INDEX;
+        uint8_t remains = 0;
+        {
+            auto block_ptr = m_entries.read_entry<true>(curr);
+
+            for (size_t i = 0; i < block_ptr->payload.size(); i++)
+            {
+                if (block_ptr->state.test(i) && pred(block_ptr->payload[i]))
+                {
+                    block_ptr->state.reset(i);
+                    utils::atomic_fetch_dec(&block_ptr->payload_amt);
+                    entry_c++;
+                }
+            }
+
+            next    = block_ptr->next;
+            remains = block_ptr->payload_amt;
+        }
+
+        //~ Unlink emptied blocks from the adjacency.
+        if (remains == 0)
+        {
+            if (prev == END_INDEX)
+                store_head(head_ptr.ref, next);
+            else
+                utils::atomic_store(&m_entries.read_entry<true>(prev)->next, next);
+
+            m_entries.append_free_data_block(curr);
+        }
+        else
+            prev = curr;
+
+        curr = next;
+    }
+
+    return entry_c;
+}
+
+inline std::vector<graphquery::database::storage::CTemporalFile::STemporalEdge_t>
+graphquery::database::storage::CTemporalFile::get_recent(const Id_t vertex_offset,
+                                                         const int64_t max_timestamp,
+                                                         const size_t limit,
+                                                         const std::function<bool(const STemporalEdge_t &)> & pred) noexcept
+{
+    std::vector<STemporalEdge_t> ret = {};
+    ret.reserve(limit);
+
+    auto head_ptr      = m_heads.read_entry(vertex_offset);
+    auto gbl_block_ptr = m_entries.read_entry(0);
+    Id_t curr          = read_head(head_ptr.ref);
+
+    //~ Entries of a block are unordered, although every following block is older, so stop once the limit is met.
+    while (curr != END_INDEX && ret.size() < limit)
+    {
+        const auto block_ptr = gbl_block_ptr + curr;
+        const auto start     = ret.size();
+
+        for (size_t i = 0; i < block_ptr->payload.size(); i++)
+        {
+            if (block_ptr->state.test(i) && block_ptr->payload[i].timestamp <= max_timestamp && pred(block_ptr->payload[i]))
+                ret.emplace_back(block_ptr->payload[i]);
+        }
+
+        std::sort(ret.begin() + start, ret.end(), [](const STemporalEdge_t & a, const STemporalEdge_t & b) -> bool { return a.timestamp > b.timestamp; });
+        curr = block_ptr->next;
+    }
+
+    if (ret.size() > limit)
+        ret.resize(limit);
+
+    return ret;
+}
@@ -2,15 +2,22 @@
 
 #include "lpg_mmap.h"
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <utility>
+
 graphquery::database::storage::CTransaction::CTransaction(const std::filesystem::path & local_path, ILPGModel * lpg, const std::shared_ptr<logger::CLogSystem> & logsys, const bool & sync_state):
-    m_lpg(lpg), _sync_state_(sync_state), m_transaction_file(MAP_SHARED), m_log_system(logsys)
+    m_lpg(lpg), _sync_state_(sync_state), m_transaction_file(MAP_SHARED), m_group_commit(m_transaction_file, CFG_LPG_GROUP_COMMIT_MAX_DELAY, CFG_LPG_GROUP_COMMIT_MAX_BATCH), m_log_system(logsys)
 {
     m_transaction_file.set_path(local_path);
+    m_transaction_file.set_dirty_tracking(true);
 }
 
 void
 graphquery::database::storage::CTransaction::close() noexcept
 {
+    m_group_commit.stop();
     m_transaction_file.close();
 }
 
@@ -36,6 +43,8 @@ graphquery::database::storage::CTransaction::set_up()
 {
     CDiskDriver::create_file(m_transaction_file.get_path(), TRANSACTION_FILE_NAME);
     m_transaction_file.open(TRANSACTION_FILE_NAME);
+    m_transaction_file.start_flusher(CFG_LPG_FLUSH_INTERVAL);
+    m_group_commit.start();
     store_transaction_header();
 }
 
@@ -43,6 +52,8 @@ void
 graphquery::database::storage::CTransaction::load()
 {
     m_transaction_file.open(TRANSACTION_FILE_NAME);
+    m_transaction_file.start_flusher(CFG_LPG_FLUSH_INTERVAL);
+    m_group_commit.start();
 }
 
 void
@@ -54,8 +65,10 @@ graphquery::database::storage::CTransaction::store_transaction_header()
     utils::atomic_store(&header_ptr->rollback_entries_start_addr, ROLLBACK_ENTRIES_START_ADDR);
     utils::atomic_store(&header_ptr->eof_addr, TRANSACTIONS_START_ADDR);
     utils::atomic_store(&header_ptr->priv_eof_addr, TRANSACTIONS_START_ADDR);
+    utils::atomic_store(&header_ptr->lsn_base, 0ULL);
     utils::atomic_store(&header_ptr->running_transactions, static_cast<uint16_t>(0));
     utils::atomic_store(&header_ptr->rollback_entry_c, static_cast<uint8_t>(0));
+    m_transaction_file.mark_dirty(TRANSACTION_HEADER_START_ADDR, sizeof(SHeaderBlock));
 }
 
 void
@@ -70,10 +83,12 @@ graphquery::database::storage::CTransaction::store_rollback_entry(const std::str
     const uint8_t entry          = read_transaction_header()->rollback_entry_c++ % ROLLBACK_MAX_AMOUNT;
     SRef_t<SRollbackEntry> r_ptr = read_rollback_entry(entry);
 
-    const auto curr_eof_addr = utils::atomic_load(&read_transaction_header()->eof_addr);
+    const auto curr_eof_lsn = get_eof_lsn();
 
     strncpy(&r_ptr->name[0], fmt::format("{} ({})", ss.str(), name).c_str(), CFG_GRAPH_ROLLBACK_NAME_LENGTH - 1);
-    utils::atomic_store(&r_ptr->eor_addr, curr_eof_addr);
+    utils::atomic_store(&r_ptr->eor_lsn, curr_eof_lsn);
+    m_transaction_file.mark_dirty(TRANSACTION_HEADER_START_ADDR, sizeof(SHeaderBlock));
+    m_transaction_file.mark_dirty(ROLLBACK_ENTRIES_START_ADDR + static_cast<int64_t>(entry) * sizeof(SRollbackEntry), sizeof(SRollbackEntry));
     m_log_system->info(fmt::format("Rollback ({}) has been created", name));
 }
 
@@ -108,15 +123,23 @@ graphquery::database::storage::CTransaction::update_graph_state() noexcept
 
     if (running_transactions > 0)
     {
-        dynamic_cast<CMemoryModelMMAPLPG *>(m_lpg)->reset_graph();
-        rollback(utils::atomic_load(&transaction_hdr->transactions_start_addr), TRANSACTION_HEADER_START_ADDR);
+        //~ Mutations were interrupted, therefore the graph is restored to the last checkpoint and solely the records since are replayed.
+        const uint64_t checkpoint_lsn = dynamic_cast<CMemoryModelMMAPLPG *>(m_lpg)->restore_graph();
+        rollback(eof_addr, get_lsn_addr(checkpoint_lsn));
+
+        //~ The interrupted records were left uncommitted, therefore were skipped by the replay.
+        utils::atomic_store(&transaction_hdr->running_transactions, static_cast<uint16_t>(0));
+        m_transaction_file.mark_dirty(TRANSACTION_HEADER_START_ADDR, sizeof(SHeaderBlock));
     }
     else if (priv_eof_addr < eof_addr)
     {
         rollback(eof_addr, static_cast<int64_t>(priv_eof_addr));
 
         if constexpr (LPG_MAP_MODE == MAP_SHARED)
+        {
             utils::atomic_store(&transaction_hdr->priv_eof_addr, eof_addr);
+            m_transaction_file.mark_dirty(TRANSACTION_HEADER_START_ADDR, sizeof(SHeaderBlock));
+        }
     }
 }
 
@@ -139,11 +162,14 @@ graphquery::database::storage::CTransaction::read_rollback_entry(const uint8_t i
     return m_transaction_file.ref<SRollbackEntry>(ROLLBACK_ENTRIES_START_ADDR + static_cast<int64_t>(i) * sizeof(SRollbackEntry));
 }
 
-void
-graphquery::database::storage::CTransaction::storage_persist() const noexcept
+bool
+graphquery::database::storage::CTransaction::storage_persist() noexcept
 {
+    //~ Concurrent commits share a single sync, issued by the writer of the group commit.
     if (_sync_state_)
-        (void) m_transaction_file.sync();
+        return m_group_commit.commit();
+
+    return true;
 }
 
 uint64_t
@@ -159,113 +185,159 @@ graphquery::database::storage::CTransaction::get_transaction_start_addr() noexce
 }
 
 uint64_t
-graphquery::database::storage::CTransaction::log_rm_vertex(const Id_t src) noexcept
+graphquery::database::storage::CTransaction::get_eof_lsn() noexcept
 {
-    auto transaction_hdr           = read_transaction_header();
-    static constexpr uint64_t size = sizeof(SVertexTransaction);
-    const auto commit_addr         = utils::atomic_fetch_add(&transaction_hdr->eof_addr, size);
-
-    if constexpr (LPG_MAP_MODE == MAP_SHARED)
-        utils::atomic_fetch_add(&transaction_hdr->priv_eof_addr, size);
-
-    utils::atomic_fetch_inc(&transaction_hdr->running_transactions);
-    utils::atomic_fetch_inc(&transaction_hdr->transaction_c);
-
-    //~ Lose reference to transaction_hdr
-    transaction_hdr.~SRef_t();
-    transaction_hdr = {};
-
-    auto transaction_ptr = read_transaction<SVertexTransaction, true>(commit_addr);
-
-    transaction_ptr->size               = size;
-    transaction_ptr->committed          = 0;
-    transaction_ptr->type               = ETransactionType::vertex;
-    transaction_ptr->commit.optional_id = src;
-    transaction_ptr->commit.remove      = 1;
-    transaction_ptr->commit.property_c  = 0;
-    transaction_ptr->commit.label_c     = 0;
-
-    return commit_addr;
+    auto header_ptr = read_transaction_header();
+    return utils::atomic_load(&header_ptr->lsn_base) + utils::atomic_load(&header_ptr->eof_addr) - TRANSACTIONS_START_ADDR;
 }
 
 uint64_t
-graphquery::database::storage::CTransaction::log_rm_edge(const Id_t src, const Id_t dst, const std::string_view edge_label) noexcept
+graphquery::database::storage::CTransaction::get_log_size() noexcept
 {
-    auto transaction_hdr           = read_transaction_header();
-    static constexpr uint64_t size = sizeof(SEdgeTransaction);
-    const auto commit_addr         = utils::atomic_fetch_add(&transaction_hdr->eof_addr, size);
+    return utils::atomic_load(&read_transaction_header()->eof_addr) - TRANSACTIONS_START_ADDR;
+}
 
-    if constexpr (LPG_MAP_MODE == MAP_SHARED)
-        utils::atomic_fetch_add(&transaction_hdr->priv_eof_addr, size);
+int64_t
+graphquery::database::storage::CTransaction::get_lsn_addr(const uint64_t lsn) noexcept
+{
+    //~ Records prior to the base were truncated, as the checkpoint that did so covers them.
+    const uint64_t lsn_base = utils::atomic_load(&read_transaction_header()->lsn_base);
+    return TRANSACTIONS_START_ADDR + static_cast<int64_t>(std::max(lsn, lsn_base) - lsn_base);
+}
 
-    utils::atomic_fetch_inc(&transaction_hdr->running_transactions);
-    utils::atomic_fetch_inc(&transaction_hdr->transaction_c);
+void
+graphquery::database::storage::CTransaction::truncate(const uint64_t checkpoint_lsn) noexcept
+{
+    auto header_ptr = read_transaction_header();
 
-    //~ Lose reference to transaction_hdr
-    transaction_hdr.~SRef_t();
-    transaction_hdr = {};
+    //~ The log restarts at the lsn of the checkpoint, as its image covers every record prior.
+    utils::atomic_store(&header_ptr->lsn_base, checkpoint_lsn);
+    utils::atomic_store(&header_ptr->transaction_c, 0ULL);
+    utils::atomic_store(&header_ptr->eof_addr, TRANSACTIONS_START_ADDR);
+    utils::atomic_store(&header_ptr->priv_eof_addr, TRANSACTIONS_START_ADDR);
+    utils::atomic_store(&header_ptr->valid_eof_addr, TRANSACTIONS_START_ADDR);
+    utils::atomic_store(&header_ptr->running_transactions, static_cast<uint16_t>(0));
 
-    auto transaction_ptr = read_transaction<SEdgeTransaction>(commit_addr);
+    //~ Rollback entries are kept, addressed by lsn. Those preceding the checkpoint are rejected once rolled back to.
+    m_transaction_file.mark_dirty(TRANSACTION_HEADER_START_ADDR, sizeof(SHeaderBlock));
 
-    transaction_ptr->size              = size;
-    transaction_ptr->committed         = 0;
-    transaction_ptr->type              = ETransactionType::edge;
-    transaction_ptr->commit.src        = src;
-    transaction_ptr->commit.dst        = dst;
-    transaction_ptr->commit.remove     = 1;
-    transaction_ptr->commit.property_c = 0;
-    strcpy(&transaction_ptr->commit.edge_label[0], edge_label.data());
+    //~ Lose reference to header_ptr, as shrinking the file may move the mapping.
+    header_ptr.~SRef_t();
+    header_ptr = {};
 
-    return commit_addr;
+    //~ The header is made durable prior to shrinking, such that it never addresses records beyond the file.
+    (void) m_transaction_file.sync();
+    m_transaction_file.resize_override(TRANSACTIONS_START_ADDR);
+    m_log_system->info(fmt::format("Transaction log has been truncated at lsn ({})", checkpoint_lsn));
 }
 
 uint64_t
-graphquery::database::storage::CTransaction::log_vertex(const std::vector<std::string_view> & labels, const std::vector<ILPGModel::SProperty_t> & props, const Id_t optional_id) noexcept
+graphquery::database::storage::CTransaction::reserve_transaction(const uint64_t size, const uint64_t record_c) noexcept
 {
     auto transaction_hdr   = read_transaction_header();
-    const uint64_t size    = sizeof(SVertexTransaction) + props.size() * sizeof(ILPGModel::SProperty_t) + CFG_LPG_LABEL_LENGTH * labels.size();
     const auto commit_addr = utils::atomic_fetch_add(&transaction_hdr->eof_addr, size);
 
     if constexpr (LPG_MAP_MODE == MAP_SHARED)
         utils::atomic_fetch_add(&transaction_hdr->priv_eof_addr, size);
 
     utils::atomic_fetch_inc(&transaction_hdr->running_transactions);
-    utils::atomic_fetch_inc(&transaction_hdr->transaction_c);
-
-    //~ Lose reference to transaction_hdr
-    transaction_hdr.~SRef_t();
-    transaction_hdr = {};
+    utils::atomic_fetch_add(&transaction_hdr->transaction_c, record_c);
+    return commit_addr;
+}
 
-    SRef_t<SVertexTransaction, true> transaction_ptr = read_transaction<SVertexTransaction, true>(commit_addr);
+void
+graphquery::database::storage::CTransaction::store_vertex_record(const uint64_t addr,
+                                                                 const uint64_t size,
+                                                                 const std::vector<std::string_view> & labels,
+                                                                 const std::vector<ILPGModel::SProperty_t> & props,
+                                                                 const Id_t optional_id,
+                                                                 const bool remove) noexcept
+{
+    SRef_t<SVertexTransaction, true> transaction_ptr = read_transaction<SVertexTransaction, true>(addr);
 
     transaction_ptr->size               = size;
     transaction_ptr->committed          = 0;
     transaction_ptr->type               = ETransactionType::vertex;
     transaction_ptr->commit.optional_id = optional_id;
-    transaction_ptr->commit.remove      = 0;
+    transaction_ptr->commit.remove      = remove;
     transaction_ptr->commit.property_c  = props.size();
     transaction_ptr->commit.label_c     = labels.size();
 
     transaction_ptr.~SRef_t(); //~ Remove reference to transaction file.
     transaction_ptr = {};
 
-    auto curr_addr = commit_addr + sizeof(SVertexTransaction);
+    auto curr_addr = addr + sizeof(SVertexTransaction);
 
     for (const auto & label : labels)
     {
         auto label_ptr = m_transaction_file.ref<ILPGModel::SLabel>(static_cast<int64_t>(curr_addr));
-        strncpy(&label_ptr->label[0], label.data(), CFG_LPG_LABEL_LENGTH - 1);
+        const size_t label_len = std::min(label.size(), static_cast<size_t>(CFG_LPG_LABEL_LENGTH - 1));
+        strncpy(&label_ptr->label[0], label.data(), label_len);
+        label_ptr->label[label_len] = '\0';
         curr_addr += CFG_LPG_LABEL_LENGTH;
     }
 
-    for (const auto & [key, value] : props)
-    {
-        auto prop = m_transaction_file.ref<ILPGModel::SProperty_t>(static_cast<int64_t>(curr_addr));
-        strncpy(&prop->key[0], key, CFG_LPG_PROPERTY_KEY_LENGTH - 1);
-        strncpy(&prop->value[0], value, CFG_LPG_PROPERTY_VALUE_LENGTH - 1);
-        curr_addr += sizeof(ILPGModel::SProperty_t);
-    }
+    store_properties(curr_addr, props);
+}
 
+void
+graphquery::database::storage::CTransaction::store_edge_record(const uint64_t addr,
+                                                               const uint64_t size,
+                                                               const Id_t src,
+                                                               const Id_t dst,
+                                                               const std::string_view edge_label,
+                                                               const std::vector<ILPGModel::SProperty_t> & props,
+                                                               const bool undirected,
+                                                               const bool remove) noexcept
+{
+    SRef_t<SEdgeTransaction, true> transaction_ptr = read_transaction<SEdgeTransaction, true>(addr);
+
+    transaction_ptr->size              = size;
+    transaction_ptr->committed         = 0;
+    transaction_ptr->type              = ETransactionType::edge;
+    transaction_ptr->commit.src        = src;
+    transaction_ptr->commit.dst        = dst;
+    transaction_ptr->commit.remove     = remove;
+    transaction_ptr->commit.property_c = props.size();
+    transaction_ptr->commit.undirected = undirected;
+
+    const size_t label_len = std::min(edge_label.size(), static_cast<size_t>(CFG_LPG_LABEL_LENGTH - 1));
+    strncpy(&transaction_ptr->commit.edge_label[0], edge_label.data(), label_len);
+    transaction_ptr->commit.edge_label[label_len] = '\0';
+
+    transaction_ptr.~SRef_t(); //~ Remove reference to transaction file.
+    transaction_ptr = {};
+
+    store_properties(addr + sizeof(SEdgeTransaction), props);
+}
+
+uint64_t
+graphquery::database::storage::CTransaction::log_rm_vertex(const Id_t src) noexcept
+{
+    static constexpr uint64_t size = sizeof(SVertexTransaction);
+    const auto commit_addr         = reserve_transaction(size, 1);
+
+    store_vertex_record(commit_addr, size, {}, {}, src, true);
+    return commit_addr;
+}
+
+uint64_t
+graphquery::database::storage::CTransaction::log_rm_edge(const Id_t src, const Id_t dst, const std::string_view edge_label) noexcept
+{
+    static constexpr uint64_t size = sizeof(SEdgeTransaction);
+    const auto commit_addr         = reserve_transaction(size, 1);
+
+    store_edge_record(commit_addr, size, src, dst, edge_label, {}, false, true);
+    return commit_addr;
+}
+
+uint64_t
+graphquery::database::storage::CTransaction::log_vertex(const std::vector<std::string_view> & labels, const std::vector<ILPGModel::SProperty_t> & props, const Id_t optional_id) noexcept
+{
+    const uint64_t size    = get_vertex_record_size(labels.size(), props);
+    const auto commit_addr = reserve_transaction(size, 1);
+
+    store_vertex_record(commit_addr, size, labels, props, optional_id, false);
     return commit_addr;
 }
 
@@ -276,46 +348,88 @@ graphquery::database::storage::CTransaction::log_edge(const Id_t src,
                                                       const std::vector<ILPGModel::SProperty_t> & props,
                                                       const bool undirected) noexcept
 {
-    auto transaction_hdr   = read_transaction_header();
-    const uint64_t size    = sizeof(SEdgeTransaction) + props.size() * sizeof(ILPGModel::SProperty_t);
-    const auto commit_addr = utils::atomic_fetch_add(&transaction_hdr->eof_addr, size);
+    const uint64_t size    = get_edge_record_size(props);
+    const auto commit_addr = reserve_transaction(size, 1);
 
-    if constexpr (LPG_MAP_MODE == MAP_SHARED)
-        utils::atomic_fetch_add(&transaction_hdr->priv_eof_addr, size);
+    store_edge_record(commit_addr, size, src, dst, edge_label, props, undirected, false);
+    return commit_addr;
+}
 
-    utils::atomic_fetch_inc(&transaction_hdr->running_transactions);
-    utils::atomic_fetch_inc(&transaction_hdr->transaction_c);
+uint64_t
+graphquery::database::storage::CTransaction::log_group(const std::vector<ILPGModel::SMutation_t> & mutations) noexcept
+{
+    uint64_t size = sizeof(SGroupTransaction);
 
-    //~ Lose reference to transaction_hdr
-    transaction_hdr.~SRef_t();
-    transaction_hdr = {};
+    for (const auto & mutation : mutations)
+        size += get_mutation_size(mutation);
 
-    SRef_t<SEdgeTransaction> transaction_ptr = read_transaction<SEdgeTransaction>(commit_addr);
+    //~ Reserved at once, such that the records of the group are contiguous and counted as a single running transaction.
+    const auto group_addr = reserve_transaction(size, mutations.size() + 1);
 
-    transaction_ptr->size              = size;
-    transaction_ptr->committed         = 0;
-    transaction_ptr->type              = ETransactionType::edge;
-    transaction_ptr->commit.src        = src;
-    transaction_ptr->commit.dst        = dst;
-    transaction_ptr->commit.remove     = 0;
-    transaction_ptr->commit.property_c = props.size();
-    transaction_ptr->commit.undirected = undirected;
-    strcpy(&transaction_ptr->commit.edge_label[0], edge_label.data());
+    {
+        SRef_t<SGroupTransaction, true> group_ptr = read_transaction<SGroupTransaction, true>(group_addr);
+        group_ptr->size                           = size;
+        group_ptr->committed                      = 0;
+        group_ptr->type                           = ETransactionType::group;
+        group_ptr->commit.record_c                = mutations.size();
+    }
 
-    transaction_ptr.~SRef_t<SEdgeTransaction>(); //~ Remove reference to transaction file.
-    transaction_ptr = {};
+    auto curr_addr = group_addr + sizeof(SGroupTransaction);
 
-    auto curr_addr = commit_addr + sizeof(SEdgeTransaction);
+    for (const auto & mutation : mutations)
+    {
+        const uint64_t record_size = get_mutation_size(mutation);
 
-    for (const auto & [key, value] : props)
+        switch (mutation.type)
+        {
+        case ILPGModel::EMutationType_t::add_vertex:
+        {
+            const std::vector<std::string_view> labels(mutation.labels.begin(), mutation.labels.end());
+            store_vertex_record(curr_addr, record_size, labels, mutation.props, mutation.src, false);
+            break;
+        }
+        case ILPGModel::EMutationType_t::add_edge: store_edge_record(curr_addr, record_size, mutation.src, mutation.dst, mutation.edge_label, mutation.props, mutation.undirected, false); break;
+        case ILPGModel::EMutationType_t::rm_vertex: store_vertex_record(curr_addr, record_size, {}, {}, mutation.src, true); break;
+        case ILPGModel::EMutationType_t::rm_edge: store_edge_record(curr_addr, record_size, mutation.src, mutation.dst, mutation.edge_label, {}, false, true); break;
+        }
+
+        curr_addr += record_size;
+    }
+
+    return group_addr;
+}
+
+bool
+graphquery::database::storage::CTransaction::commit_group(const uint64_t group_addr) noexcept
+{
+    auto curr_addr          = group_addr + sizeof(SGroupTransaction);
+    const uint64_t member_c = read_transaction<SGroupTransaction>(group_addr)->commit.record_c;
+
+    //~ A group commits solely once every member applied, a failing member reverts the group instead.
+    for (uint64_t i = 0; i < member_c; i++)
     {
-        auto prop = m_transaction_file.ref<ILPGModel::SProperty_t>(static_cast<int64_t>(curr_addr));
-        strncpy(&prop->key[0], key, CFG_LPG_PROPERTY_KEY_LENGTH - 1);
-        strncpy(&prop->value[0], value, CFG_LPG_PROPERTY_VALUE_LENGTH - 1);
-        curr_addr += sizeof(ILPGModel::SProperty_t);
+        //~ The trailing fields of a member follow the commit of its type, therefore they are addressed by offset.
+        const bool vertex_member        = *read_transaction<ETransactionType>(curr_addr) == ETransactionType::vertex;
+        const uint64_t size_offset      = vertex_member ? offsetof(SVertexTransaction, size) : offsetof(SEdgeTransaction, size);
+        const uint64_t committed_offset = vertex_member ? offsetof(SVertexTransaction, committed) : offsetof(SEdgeTransaction, committed);
+
+        utils::atomic_store(read_transaction<uint8_t, true>(curr_addr + committed_offset).ref, static_cast<uint8_t>(1));
+        curr_addr += *read_transaction<uint32_t>(curr_addr + size_offset);
     }
 
-    return commit_addr;
+    //~ The group commits by its header alone, a crash prior discards every member.
+    utils::atomic_store(read_transaction<uint8_t, true>(group_addr + offsetof(SGroupTransaction, committed)).ref, static_cast<uint8_t>(1));
+    const uint64_t group_size = *read_transaction<uint32_t>(group_addr + offsetof(SGroupTransaction, size));
+
+    {
+        auto header_ptr = read_transaction_header();
+        utils::atomic_fetch_dec(&header_ptr->running_transactions);
+        utils::atomic_store(&header_ptr->valid_eof_addr, std::max(header_ptr->valid_eof_addr, group_addr + group_size));
+    }
+
+    m_transaction_file.mark_dirty(static_cast<int64_t>(group_addr), static_cast<int64_t>(group_size));
+    m_transaction_file.mark_dirty(TRANSACTION_HEADER_START_ADDR, sizeof(SHeaderBlock));
+    return storage_persist();
 }
 
 std::vector<std::string_view>
@@ -329,152 +443,276 @@ graphquery::database::storage::CTransaction::slabel_to_strview_vector(const std:
     return res;
 }
 
-void
-graphquery::database::storage::CTransaction::rollback(const uint64_t rollback_eor, const int64_t start_addr) noexcept
+uint64_t
+graphquery::database::storage::CTransaction::get_vertex_record_size(const size_t label_c, const std::vector<ILPGModel::SProperty_t> & props) noexcept
 {
-    m_transaction_file.seek(start_addr);
-    auto curr_addr         = m_transaction_file.get_seek_offset();
-    auto rollback_eor_addr = rollback_eor;
+    return sizeof(SVertexTransaction) + get_properties_size(props) + CFG_LPG_LABEL_LENGTH * label_c;
+}
+
+uint64_t
+graphquery::database::storage::CTransaction::get_edge_record_size(const std::vector<ILPGModel::SProperty_t> & props) noexcept
+{
+    return sizeof(SEdgeTransaction) + get_properties_size(props);
+}
+
+uint64_t
+graphquery::database::storage::CTransaction::get_mutation_size(const ILPGModel::SMutation_t & mutation) noexcept
+{
+    switch (mutation.type)
+    {
+    case ILPGModel::EMutationType_t::add_vertex: return get_vertex_record_size(mutation.labels.size(), mutation.props);
+    case ILPGModel::EMutationType_t::add_edge: return get_edge_record_size(mutation.props);
+    case ILPGModel::EMutationType_t::rm_vertex: return get_vertex_record_size(0, {});
+    case ILPGModel::EMutationType_t::rm_edge: return get_edge_record_size({});
+    }
+
+    return 0;
+}
 
-    SRef_t<ETransactionType> type;
-    SRef_t<SVertexTransaction> v_transc = SRef_t<SVertexTransaction>();
-    SRef_t<SEdgeTransaction> e_transc   = SRef_t<SEdgeTransaction>();
+uint64_t
+graphquery::database::storage::CTransaction::get_properties_size(const std::vector<ILPGModel::SProperty_t> & props) noexcept
+{
+    uint64_t size = props.size() * sizeof(SPropertyRecord);
+
+    for (const auto & [key, value] : props)
+        size += key.size() + value.size();
 
-    std::vector<ILPGModel::SLabel> labels     = {};
-    std::vector<ILPGModel::SProperty_t> props = {};
+    return size;
+}
+
+void
+graphquery::database::storage::CTransaction::store_properties(uint64_t addr, const std::vector<ILPGModel::SProperty_t> & props) noexcept
+{
+    //~ Grow the file beforehand, as the characters span beyond the record the reference covers.
+    const auto end_addr = static_cast<int64_t>(addr + get_properties_size(props));
+    if (static_cast<int64_t>(m_transaction_file.get_filesize()) <= end_addr)
+        m_transaction_file.resize(end_addr * 2);
 
-    while (curr_addr < rollback_eor_addr)
+    for (const auto & [key, value] : props)
     {
-        type = m_transaction_file.ref<ETransactionType>();
-        switch (*type)
-        {
-        case ETransactionType::vertex:
-        {
-            v_transc = m_transaction_file.ref_update<SVertexTransaction>();
-
-            if (v_transc->commit.label_c > 0)
-            {
-                labels.resize(v_transc->commit.label_c);
-                m_transaction_file.read(&labels[0], CFG_LPG_LABEL_LENGTH, v_transc->commit.label_c, true);
-            }
-
-            if (v_transc->commit.property_c > 0)
-            {
-                props.resize(v_transc->commit.property_c);
-                m_transaction_file.read(&props[0], CFG_LPG_PROPERTY_KEY_LENGTH + CFG_LPG_PROPERTY_VALUE_LENGTH, v_transc->commit.property_c, true);
-            }
-
-            if (v_transc->committed)
-                process_vertex_transaction(v_transc, labels, props);
-            curr_addr += v_transc->size;
-            break;
-        }
-        case ETransactionType::edge:
-        {
-            e_transc = m_transaction_file.ref_update<SEdgeTransaction>();
+        auto record_ptr          = m_transaction_file.ref<SPropertyRecord>(static_cast<int64_t>(addr));
+        record_ptr->key_length   = static_cast<uint32_t>(key.size());
+        record_ptr->value_length = static_cast<uint32_t>(value.size());
+
+        char * data = reinterpret_cast<char *>(record_ptr.ref + 1);
+        std::memcpy(data, key.data(), key.size());
+        std::memcpy(data + key.size(), value.data(), value.size());
+        addr += sizeof(SPropertyRecord) + key.size() + value.size();
+    }
+}
 
-            if (e_transc->commit.property_c > 0)
-            {
-                props.resize(e_transc->commit.property_c);
-                m_transaction_file.read(&props[0], CFG_LPG_PROPERTY_KEY_LENGTH + CFG_LPG_PROPERTY_VALUE_LENGTH, e_transc->commit.property_c, true);
-            }
+void
+graphquery::database::storage::CTransaction::read_properties(const uint16_t property_c, std::vector<ILPGModel::SProperty_t> & props) noexcept
+{
+    props.resize(property_c);
 
-            if (e_transc->committed)
-                process_edge_transaction(e_transc, props);
-            curr_addr += e_transc->size;
-            break;
-        }
-        }
+    for (auto & [key, value] : props)
+    {
+        SPropertyRecord record = {};
+        m_transaction_file.read(&record, sizeof(SPropertyRecord), 1);
 
-        labels.clear();
-        props.clear();
+        key.resize(record.key_length);
+        value.resize(record.value_length);
 
-        type.~SRef_t();
-        v_transc.~SRef_t();
-        e_transc.~SRef_t();
+        if (record.key_length > 0)
+            m_transaction_file.read(key.data(), record.key_length, 1);
+        if (record.value_length > 0)
+            m_transaction_file.read(value.data(), record.value_length, 1);
     }
 }
 
+void
+graphquery::database::storage::CTransaction::rollback(const uint64_t rollback_eor, const int64_t start_addr) noexcept
+{
+    replay(start_addr, rollback_eor, std::numeric_limits<uint64_t>::max());
+}
+
 void
 graphquery::database::storage::CTransaction::handle_transactions() noexcept
 {
-    m_transaction_file.seek(TRANSACTIONS_START_ADDR);
-    const uint32_t transaction_c = read_transaction_header()->transaction_c;
-    SRef_t<ETransactionType> type;
-    SRef_t<SVertexTransaction> v_transc = SRef_t<SVertexTransaction>();
-    SRef_t<SEdgeTransaction> e_transc   = SRef_t<SEdgeTransaction>();
+    uint64_t eof_addr      = 0;
+    uint64_t transaction_c = 0;
+
+    {
+        auto header_ptr = read_transaction_header();
+        eof_addr        = header_ptr->eof_addr;
+        transaction_c   = header_ptr->transaction_c;
+    }
+
+    replay(TRANSACTIONS_START_ADDR, eof_addr, transaction_c);
+}
+
+void
+graphquery::database::storage::CTransaction::replay(const int64_t start_addr, const uint64_t eor_addr, const uint64_t transaction_c) noexcept
+{
+    m_transaction_file.seek(start_addr);
+    auto curr_addr = m_transaction_file.get_seek_offset();
 
-    std::vector<ILPGModel::SLabel> labels     = {};
-    std::vector<ILPGModel::SProperty_t> props = {};
+    std::vector<SReplayRecord> phase = {};
+    SReplayRecord record             = {};
 
-    for (uint32_t i = 0; i < transaction_c; i++)
+    for (uint64_t i = 0; curr_addr < eor_addr && i < transaction_c; i++)
     {
-        type = m_transaction_file.ref<ETransactionType>();
-        switch (*type)
-        {
-        case ETransactionType::vertex:
-        {
-            v_transc = m_transaction_file.ref_update<SVertexTransaction>();
-
-            if (v_transc->commit.label_c > 0)
-            {
-                labels.resize(v_transc->commit.label_c);
-                m_transaction_file.read(&labels[0], CFG_LPG_LABEL_LENGTH, v_transc->commit.label_c);
-            }
-
-            if (v_transc->commit.property_c > 0)
-            {
-                props.resize(v_transc->commit.property_c);
-                m_transaction_file.read(&props[0], CFG_LPG_PROPERTY_KEY_LENGTH + CFG_LPG_PROPERTY_VALUE_LENGTH, v_transc->commit.property_c);
-            }
-
-            if (v_transc->committed)
-                process_vertex_transaction(v_transc, labels, props);
+        const auto [committed, size] = decode_transaction(record);
+
+        //~ An unknown record ends the valid log.
+        if (size == 0)
             break;
-        }
-        case ETransactionType::edge:
+
+        //~ Members of a committed group are replayed as records, whereas those of an uncommitted group are skipped together.
+        if (record.type == ETransactionType::group)
         {
-            e_transc = m_transaction_file.ref_update<SEdgeTransaction>();
+            curr_addr += committed ? sizeof(SGroupTransaction) : size;
+            m_transaction_file.seek(static_cast<int64_t>(curr_addr));
+            continue;
+        }
 
-            if (e_transc->commit.property_c > 0)
-            {
-                props.resize(e_transc->commit.property_c);
-                m_transaction_file.read(&props[0], CFG_LPG_PROPERTY_KEY_LENGTH + CFG_LPG_PROPERTY_VALUE_LENGTH, e_transc->commit.property_c);
-            }
+        curr_addr += size;
 
-            if (e_transc->committed)
-                process_edge_transaction(e_transc, props);
-            break;
+        if (!committed)
+            continue;
+
+        const bool rm_vertex = record.type == ETransactionType::vertex && record.vertex.remove != 0;
+
+        //~ A phase holds records of a single type, such that the vertices of an edge exist before it is applied.
+        //~ Edge inserts and removals are split likewise, such that a removal sees the inserts logged before it.
+        const bool split_edges = record.type == ETransactionType::edge && !phase.empty() && phase.back().type == ETransactionType::edge && phase.back().edge.remove != record.edge.remove;
+
+        if (!phase.empty() && (rm_vertex || split_edges || phase.back().type != record.type || phase.size() >= REPLAY_PHASE_MAX_C))
+            apply_replay_phase(phase);
+
+        //~ Removing a vertex unlinks the edges of its neighbours, therefore it is applied alone.
+        if (rm_vertex)
+        {
+            process_vertex_transaction(record);
+            continue;
         }
+
+        //~ Names are created in log order, such that label and key ids match those of a sequential replay.
+        intern_transaction_names(record);
+        phase.emplace_back(std::move(record));
+    }
+
+    if (!phase.empty())
+        apply_replay_phase(phase);
+}
+
+std::pair<bool, uint32_t>
+graphquery::database::storage::CTransaction::decode_transaction(SReplayRecord & record) noexcept
+{
+    //~ Copied out of the mapping, the log is not appended to whilst replaying, therefore no reference is locked.
+    m_transaction_file.read(&record.type, sizeof(ETransactionType), 1, false);
+    record.labels.clear();
+    record.props.clear();
+
+    switch (record.type)
+    {
+    case ETransactionType::vertex:
+    {
+        SVertexTransaction transaction = {};
+        m_transaction_file.read(&transaction, sizeof(SVertexTransaction), 1);
+        record.vertex = transaction.commit;
+
+        if (record.vertex.label_c > 0)
+        {
+            record.labels.resize(record.vertex.label_c);
+            m_transaction_file.read(&record.labels[0], CFG_LPG_LABEL_LENGTH, record.vertex.label_c);
         }
-        labels.clear();
-        props.clear();
 
-        v_transc.~SRef_t();
-        e_transc.~SRef_t();
+        if (record.vertex.property_c > 0)
+            read_properties(record.vertex.property_c, record.props);
+        return {transaction.committed != 0, transaction.size};
+    }
+    case ETransactionType::edge:
+    {
+        SEdgeTransaction transaction = {};
+        m_transaction_file.read(&transaction, sizeof(SEdgeTransaction), 1);
+        record.edge = transaction.commit;
+
+        if (record.edge.property_c > 0)
+            read_properties(record.edge.property_c, record.props);
+        return {transaction.committed != 0, transaction.size};
     }
+    case ETransactionType::group:
+    {
+        SGroupTransaction transaction = {};
+        m_transaction_file.read(&transaction, sizeof(SGroupTransaction), 1);
+        return {transaction.committed != 0, transaction.size};
+    }
+    }
+
+    return {false, 0};
 }
 
 void
-graphquery::database::storage::CTransaction::process_vertex_transaction(SRef_t<SVertexTransaction> & transaction,
-                                                                        const std::vector<ILPGModel::SLabel> & src_labels,
-                                                                        const std::vector<ILPGModel::SProperty_t> & props) const noexcept
-{
-    auto labels = slabel_to_strview_vector(src_labels);
-    if (transaction->commit.remove == 0)
-        if (transaction->commit.optional_id != std::numeric_limits<Id_t>::max())
-            (void) dynamic_cast<CMemoryModelMMAPLPG *>(m_lpg)->add_vertex_entry(transaction->commit.optional_id, labels, props);
-        else
-            (void) dynamic_cast<CMemoryModelMMAPLPG *>(m_lpg)->add_vertex_entry(labels, props);
-    else
-        (void) dynamic_cast<CMemoryModelMMAPLPG *>(m_lpg)->rm_vertex_entry(transaction->commit.optional_id);
+graphquery::database::storage::CTransaction::intern_transaction_names(const SReplayRecord & record) const noexcept
+{
+    auto * lpg = dynamic_cast<CMemoryModelMMAPLPG *>(m_lpg);
+
+    if (record.type == ETransactionType::vertex)
+        lpg->intern_vertex_names(slabel_to_strview_vector(record.labels), record.props);
+    else if (record.edge.remove == 0)
+        lpg->intern_edge_names(record.edge.edge_label, record.props);
 }
 
 void
-graphquery::database::storage::CTransaction::process_edge_transaction(SRef_t<SEdgeTransaction> & transaction, const std::vector<ILPGModel::SProperty_t> & props) const noexcept
+graphquery::database::storage::CTransaction::apply_replay_phase(std::vector<SReplayRecord> & phase) const noexcept
 {
-    if (transaction->commit.remove == 0)
-        (void) dynamic_cast<CMemoryModelMMAPLPG *>(m_lpg)->add_edge_entry(transaction->commit.src, transaction->commit.dst, transaction->commit.edge_label, props, transaction->commit.undirected);
+    //~ Ids are drawn in log order, such that each insert receives the id given by a sequential replay.
+    if (phase.front().type == ETransactionType::vertex)
+    {
+        auto next_id = static_cast<Id_t>(m_lpg->get_num_vertices());
+
+        for (auto & record : phase)
+        {
+            if (record.vertex.optional_id == std::numeric_limits<Id_t>::max())
+                record.vertex.optional_id = next_id;
+            next_id++;
+        }
+    }
+
+    //~ Edges are linked in two passes, such that each chain of a vertex is changed by a single partition.
+    if (phase.front().type == ETransactionType::edge)
+    {
+        std::vector<CMemoryModelMMAPLPG::SEdgeChange_t> changes = {};
+        changes.reserve(phase.size());
+
+        for (const auto & record : phase)
+            changes.emplace_back(CMemoryModelMMAPLPG::SEdgeChange_t {.src        = record.edge.src,
+                                                                     .dst        = record.edge.dst,
+                                                                     .edge_label = record.edge.edge_label,
+                                                                     .props      = &record.props,
+                                                                     .undirected = record.edge.undirected != 0});
+
+        auto * lpg = dynamic_cast<CMemoryModelMMAPLPG *>(m_lpg);
+        (void) (phase.front().edge.remove == 0 ? lpg->add_edge_entries(changes, false) : lpg->rm_edge_entries(changes));
+        phase.clear();
+        return;
+    }
+
+    //~ Records of a vertex share a partition, keeping their order.
+    std::array<std::vector<uint32_t>, REPLAY_PARTITION_C> partitions = {};
+
+    for (uint32_t i = 0; i < phase.size(); i++)
+        partitions[phase[i].vertex.optional_id % REPLAY_PARTITION_C].emplace_back(i);
+
+#pragma omp parallel for default(none) shared(partitions, phase) schedule(dynamic, 1)
+    for (uint32_t p = 0; p < REPLAY_PARTITION_C; p++)
+        for (const uint32_t i : partitions[p])
+            process_vertex_transaction(phase[i]);
+
+    phase.clear();
+}
+
+void
+graphquery::database::storage::CTransaction::process_vertex_transaction(const SReplayRecord & record) const noexcept
+{
+    auto labels = slabel_to_strview_vector(record.labels);
+    if (record.vertex.remove == 0)
+        if (record.vertex.optional_id != std::numeric_limits<Id_t>::max())
+            (void) dynamic_cast<CMemoryModelMMAPLPG *>(m_lpg)->add_vertex_entry(record.vertex.optional_id, labels, record.props);
+        else
+            (void) dynamic_cast<CMemoryModelMMAPLPG *>(m_lpg)->add_vertex_entry(labels, record.props);
     else
-        (void) dynamic_cast<CMemoryModelMMAPLPG *>(m_lpg)->rm_edge_entry(transaction->commit.src, transaction->commit.dst);
+        (void) dynamic_cast<CMemoryModelMMAPLPG *>(m_lpg)->rm_vertex_entry(record.vertex.optional_id);
 }
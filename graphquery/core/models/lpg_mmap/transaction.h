@@ -11,8 +11,11 @@
 #pragma once
 
 #include "db/storage/graph_model.h"
+#include "group_commit.hpp"
 
 #include <filesystem>
+#include <utility>
+#include <vector>
 
 namespace graphquery::database::storage
 {
@@ -22,7 +25,8 @@ namespace graphquery::database::storage
         enum class ETransactionType : uint8_t
         {
             vertex,
-            edge
+            edge,
+            group
         };
 
         struct SHeaderBlock
@@ -33,6 +37,7 @@ namespace graphquery::database::storage
             uint64_t eof_addr                    = {0};
             uint64_t priv_eof_addr               = {0};
             uint64_t valid_eof_addr              = {0};
+            uint64_t lsn_base                    = {0}; //~ Log sequence number of the first record, advanced as checkpoints truncate the log.
             uint16_t running_transactions        = {0};
             uint8_t rollback_entry_c             = {0};
         };
@@ -40,7 +45,7 @@ namespace graphquery::database::storage
         struct SRollbackEntry
         {
             char name[CFG_GRAPH_ROLLBACK_NAME_LENGTH] = {""};
-            uint64_t eor_addr                         = {0};
+            uint64_t eor_lsn                          = {0}; //~ Log sequence number the point ends at, such that it outlives a truncation.
         };
 
         struct SVertexCommit
@@ -61,15 +66,38 @@ namespace graphquery::database::storage
             uint8_t undirected                    = {0};
         };
 
+        //~ Header of a transaction of several statements, followed by a record for each of them.
+        struct SGroupCommit
+        {
+            uint32_t record_c = {0};
+        };
+
+        //~ Header of a logged property, followed by the key and value characters.
+        struct SPropertyRecord
+        {
+            uint32_t key_length   = {0};
+            uint32_t value_length = {0};
+        };
+
         template<typename T>
         struct STransaction
         {
             ETransactionType type = ETransactionType::vertex;
             T commit              = {};
-            uint16_t size         = {0};
+            uint32_t size         = {0};
             uint8_t committed     = {0};
         };
 
+        //~ Committed record decoded from the log, applied by a replay worker.
+        struct SReplayRecord
+        {
+            ETransactionType type                     = ETransactionType::vertex;
+            SVertexCommit vertex                      = {};
+            SEdgeCommit edge                          = {};
+            std::vector<ILPGModel::SLabel> labels     = {};
+            std::vector<ILPGModel::SProperty_t> props = {};
+        };
+
         explicit CTransaction(const std::filesystem::path & local_path, ILPGModel * lpg, const std::shared_ptr<logger::CLogSystem> &, const bool & sync_state_);
         ~CTransaction() = default;
 
@@ -82,6 +110,10 @@ namespace graphquery::database::storage
         void handle_transactions() noexcept;
         uint64_t get_valid_eor_addr() noexcept;
         int64_t get_transaction_start_addr() noexcept;
+        uint64_t get_eof_lsn() noexcept;
+        uint64_t get_log_size() noexcept;
+        int64_t get_lsn_addr(uint64_t lsn) noexcept;
+        void truncate(uint64_t checkpoint_lsn) noexcept;
         void store_rollback_entry(std::string_view name) noexcept;
         SRef_t<SRollbackEntry> read_rollback_entry(uint8_t) noexcept;
 
@@ -92,13 +124,16 @@ namespace graphquery::database::storage
         log_vertex(const std::vector<std::string_view> & labels, const std::vector<ILPGModel::SProperty_t> & props, Id_t optional_id = std::numeric_limits<Id_t>::max()) noexcept;
 
         [[nodiscard]] uint64_t log_edge(Id_t src, Id_t dst, std::string_view edge_label, const std::vector<ILPGModel::SProperty_t> & props, bool undirected) noexcept;
+        [[nodiscard]] uint64_t log_group(const std::vector<ILPGModel::SMutation_t> & mutations) noexcept;
+        [[nodiscard]] bool commit_group(uint64_t group_addr) noexcept;
 
         template<typename T>
-        void commit_transaction(uint64_t transaction_addr) noexcept;
+        [[nodiscard]] bool commit_transaction(uint64_t transaction_addr) noexcept;
         [[nodiscard]] std::vector<std::string> fetch_rollback_table() noexcept;
 
         using SVertexTransaction = STransaction<SVertexCommit>;
         using SEdgeTransaction   = STransaction<SEdgeCommit>;
+        using SGroupTransaction  = STransaction<SGroupCommit>;
 
       private:
         void load();
@@ -109,24 +144,39 @@ namespace graphquery::database::storage
         inline SRef_t<T, write> read_transaction(uint64_t seek);
         SRef_t<SHeaderBlock> read_transaction_header();
 
-        void storage_persist() const noexcept;
+        [[nodiscard]] bool storage_persist() noexcept;
         static inline std::vector<std::string_view> slabel_to_strview_vector(const std::vector<ILPGModel::SLabel> & vec) noexcept;
-        void process_edge_transaction(SRef_t<SEdgeTransaction> &, const std::vector<ILPGModel::SProperty_t> & props) const noexcept;
-        void process_vertex_transaction(SRef_t<SVertexTransaction> &, const std::vector<ILPGModel::SLabel> & src_labels, const std::vector<ILPGModel::SProperty_t> & props) const noexcept;
+        static inline uint64_t get_properties_size(const std::vector<ILPGModel::SProperty_t> & props) noexcept;
+        static inline uint64_t get_vertex_record_size(size_t label_c, const std::vector<ILPGModel::SProperty_t> & props) noexcept;
+        static inline uint64_t get_edge_record_size(const std::vector<ILPGModel::SProperty_t> & props) noexcept;
+        static inline uint64_t get_mutation_size(const ILPGModel::SMutation_t & mutation) noexcept;
+        [[nodiscard]] uint64_t reserve_transaction(uint64_t size, uint64_t record_c) noexcept;
+        void store_vertex_record(uint64_t addr, uint64_t size, const std::vector<std::string_view> & labels, const std::vector<ILPGModel::SProperty_t> & props, Id_t optional_id, bool remove) noexcept;
+        void store_edge_record(uint64_t addr, uint64_t size, Id_t src, Id_t dst, std::string_view edge_label, const std::vector<ILPGModel::SProperty_t> & props, bool undirected, bool remove) noexcept;
+        void store_properties(uint64_t addr, const std::vector<ILPGModel::SProperty_t> & props) noexcept;
+        void read_properties(uint16_t property_c, std::vector<ILPGModel::SProperty_t> & props) noexcept;
+        void replay(int64_t start_addr, uint64_t eor_addr, uint64_t transaction_c) noexcept;
+        [[nodiscard]] std::pair<bool, uint32_t> decode_transaction(SReplayRecord & record) noexcept;
+        void intern_transaction_names(const SReplayRecord & record) const noexcept;
+        void apply_replay_phase(std::vector<SReplayRecord> & phase) const noexcept;
+        void process_vertex_transaction(const SReplayRecord & record) const noexcept;
 
         ILPGModel * m_lpg;
         const bool & _sync_state_;
         CDiskDriver m_transaction_file;
+        CGroupCommit m_group_commit;
         std::shared_ptr<logger::CLogSystem> m_log_system;
         static constexpr const char * TRANSACTION_FILE_NAME    = "transactions";
         static constexpr uint8_t ROLLBACK_MAX_AMOUNT           = 5;
+        static constexpr uint32_t REPLAY_PARTITION_C           = 64;      //~ Partitions of a vertex replay phase, records of a vertex share one.
+        static constexpr uint32_t REPLAY_PHASE_MAX_C           = 1 << 16; //~ Records decoded before a phase is applied.
         static constexpr int32_t TRANSACTION_HEADER_START_ADDR = 0x00000000;
         static constexpr int64_t ROLLBACK_ENTRIES_START_ADDR   = TRANSACTION_HEADER_START_ADDR + sizeof(SHeaderBlock);
         static constexpr int64_t TRANSACTIONS_START_ADDR       = _align_(ROLLBACK_ENTRIES_START_ADDR + ROLLBACK_MAX_AMOUNT * sizeof(SRollbackEntry));
     };
 
     template<typename T>
-    void CTransaction::commit_transaction(const uint64_t transaction_addr) noexcept
+    bool CTransaction::commit_transaction(const uint64_t transaction_addr) noexcept
     {
         auto ref = m_transaction_file.ref<STransaction<T>>(static_cast<int64_t>(transaction_addr));
         utils::atomic_store(&ref->committed, 1);
@@ -134,6 +184,10 @@ namespace graphquery::database::storage
         auto header_ptr = read_transaction_header();
         utils::atomic_fetch_dec(&header_ptr->running_transactions);
         utils::atomic_store(&header_ptr->valid_eof_addr, std::max(header_ptr->valid_eof_addr, transaction_addr + ref->size));
-        storage_persist();
+
+        //~ Marked once written, such that the sync flushes the record along with the header.
+        m_transaction_file.mark_dirty(static_cast<int64_t>(transaction_addr), ref->size);
+        m_transaction_file.mark_dirty(TRANSACTION_HEADER_START_ADDR, sizeof(SHeaderBlock));
+        return storage_persist();
     }
 } // namespace graphquery::database::storage
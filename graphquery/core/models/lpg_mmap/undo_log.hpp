@@ -0,0 +1,85 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file undo_log.hpp
+ * \brief Undo log of a single transaction, recording a logical
+ *        undo for each change applied to the graph files, such
+ *        that an abort reverts solely its own changes. Helper
+ *        class for lpg mmap memory model.
+ ************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace graphquery::database::storage
+{
+    template<typename T, uint32_t N>
+    class CUndoLog
+    {
+        static_assert(std::is_trivially_copyable_v<T>, "Undo records are copied by value.");
+
+      public:
+        CUndoLog()  = default;
+        ~CUndoLog() = default;
+        CUndoLog(const CUndoLog &)             = delete;
+        CUndoLog & operator=(const CUndoLog &) = delete;
+
+        inline void push(const T & record) noexcept;
+        inline void clear() noexcept;
+        [[nodiscard]] inline uint32_t size() const noexcept;
+
+        template<typename Func>
+        void rewind(Func && func) noexcept;
+
+      private:
+        uint32_t m_size           = {}; //~ Amount of records held, inline and spilled.
+        std::array<T, N> m_inline = {}; //~ First records of the transaction, held without allocating.
+        std::vector<T> m_spill    = {}; //~ Records beyond the inline capacity.
+    };
+} // namespace graphquery::database::storage
+
+template<typename T, uint32_t N>
+inline void
+graphquery::database::storage::CUndoLog<T, N>::push(const T & record) noexcept
+{
+    if (m_size < N)
+        m_inline[m_size] = record;
+    else
+        m_spill.emplace_back(record);
+
+    m_size++;
+}
+
+template<typename T, uint32_t N>
+inline void
+graphquery::database::storage::CUndoLog<T, N>::clear() noexcept
+{
+    m_size = 0;
+    m_spill.clear();
+}
+
+template<typename T, uint32_t N>
+inline uint32_t
+graphquery::database::storage::CUndoLog<T, N>::size() const noexcept
+{
+    return m_size;
+}
+
+template<typename T, uint32_t N>
+template<typename Func>
+void
+graphquery::database::storage::CUndoLog<T, N>::rewind(Func && func) noexcept
+{
+    //~ Reverted newest first, such that each undo observes the state its change was applied to.
+    for (auto it = m_spill.rbegin(); it != m_spill.rend(); ++it)
+        func(*it);
+
+    for (uint32_t i = m_size < N ? m_size : N; i > 0; i--)
+        func(m_inline[i - 1]);
+
+    clear();
+}
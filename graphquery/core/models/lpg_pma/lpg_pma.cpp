@@ -0,0 +1,120 @@
+#include "lpg_pma.h"
+
+#include <cassert>
+
+graphquery::database::storage::CMemoryModelPMALPG::CMemoryModelPMALPG(const std::shared_ptr<logger::CLogSystem> & log_system, const bool & sync_state_):
+    CMemoryModelHeapLPG(log_system, sync_state_, true)
+{
+}
+
+graphquery::database::storage::CMemoryModelPMALPG::~
+CMemoryModelPMALPG()
+{
+    close();
+}
+
+void
+graphquery::database::storage::CMemoryModelPMALPG::edgemap(const std::unique_ptr<analytic::IRelax> & relax) noexcept
+{
+    //~ Stream the outgoing array directly, as the entries of every vertex are held in order.
+    std::shared_lock lock(m_graph_lock);
+    m_out_edges.foreach_parallel([&relax](const SEdge_t & edge) -> void { relax->relax(edge.src, edge.dst); });
+}
+
+void
+graphquery::database::storage::CMemoryModelPMALPG::store_edge(const SEdge_t & edge) noexcept
+{
+    [[maybe_unused]] const bool stored = m_out_edges.insert(edge);
+    assert(stored);
+    (void) m_in_edges.insert(edge);
+}
+
+void
+graphquery::database::storage::CMemoryModelPMALPG::store_edges(const std::vector<SEdge_t> & edges) noexcept
+{
+    m_out_edges.insert_batch(edges);
+    m_in_edges.insert_batch(edges);
+}
+
+void
+graphquery::database::storage::CMemoryModelPMALPG::rm_edges(const Id_t src_idx, const Id_t dst_idx, const std::optional<uint16_t> edge_label_id, std::vector<SEdge_t> & removed) noexcept
+{
+    std::vector<uint16_t> edge_label_ids = {};
+    m_out_edges.scan(src_idx,
+                     edge_label_id,
+                     [&edge_label_ids, dst_idx](const SEdge_t & edge) -> void
+                     {
+                         if (edge.dst == dst_idx)
+                             edge_label_ids.emplace_back(edge.edge_label_id);
+                     });
+
+    for (const auto label_id : edge_label_ids)
+    {
+        if (const auto edge = m_out_edges.remove(src_idx, label_id, dst_idx); edge.has_value())
+        {
+            (void) m_in_edges.remove(dst_idx, label_id, src_idx);
+            removed.emplace_back(*edge);
+        }
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelPMALPG::rm_vertex_edges(const Id_t vertex_idx, std::vector<SEdge_t> & removed) noexcept
+{
+    const size_t out_c = removed.size();
+    m_out_edges.remove_vertex(vertex_idx, removed);
+
+    for (size_t i = out_c; i < removed.size(); i++)
+        (void) m_in_edges.remove(removed[i].dst, removed[i].edge_label_id, removed[i].src);
+
+    //~ Self loops were removed along with the outgoing entries, therefore each edge is returned once.
+    std::vector<SEdge_t> in_removed = {};
+    m_in_edges.remove_vertex(vertex_idx, in_removed);
+
+    for (const auto & edge : in_removed)
+    {
+        if (m_out_edges.remove(edge.src, edge.edge_label_id, edge.dst).has_value())
+            removed.emplace_back(edge);
+    }
+}
+
+void
+graphquery::database::storage::CMemoryModelPMALPG::scan_out_edges(const Id_t src_idx, const std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept
+{
+    m_out_edges.scan(src_idx, edge_label_id, func);
+}
+
+void
+graphquery::database::storage::CMemoryModelPMALPG::scan_in_edges(const Id_t dst_idx, const std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept
+{
+    m_in_edges.scan(dst_idx, edge_label_id, func);
+}
+
+void
+graphquery::database::storage::CMemoryModelPMALPG::reset_edges() noexcept
+{
+    m_out_edges.clear();
+    m_in_edges.clear();
+}
+
+void
+graphquery::database::storage::CMemoryModelPMALPG::reserve_vertices(const Id_t vertex_c) noexcept
+{
+    m_out_edges.reserve_vertices(vertex_c);
+    m_in_edges.reserve_vertices(vertex_c);
+}
+
+bool
+graphquery::database::storage::CMemoryModelPMALPG::check_if_edge_exists(const Id_t src_idx, const Id_t dst_idx, const uint16_t edge_label_id) noexcept
+{
+    return m_out_edges.contains(src_idx, edge_label_id, dst_idx);
+}
+
+extern "C"
+{
+    LIB_EXPORT void create_graph_model(graphquery::database::storage::ILPGModel ** graph_model, const std::shared_ptr<graphquery::logger::CLogSystem> & log_system, const bool & _sync_state_)
+    {
+        assert(log_system != nullptr);
+        *graph_model = new graphquery::database::storage::CMemoryModelPMALPG(log_system, _sync_state_);
+    }
+}
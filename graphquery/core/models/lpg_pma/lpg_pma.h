@@ -0,0 +1,43 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file lpg_pma.h
+ * \brief Dervied instance of a memory model, supporting
+ *        the labelled property graph functionality, with the
+ *        adjacency held within packed memory arrays. Entries are
+ *        sorted by vertex, label and neighbour within one gapped
+ *        array per direction, such that the graph is scanned as a
+ *        dynamic csr whilst remaining updatable in place.
+ ************************************************************/
+
+#pragma once
+
+#include "models/lpg_heap/lpg_heap.h"
+#include "pma.hpp"
+
+namespace graphquery::database::storage
+{
+    class CMemoryModelPMALPG final : public CMemoryModelHeapLPG
+    {
+      public:
+        explicit CMemoryModelPMALPG(const std::shared_ptr<logger::CLogSystem> &, const bool & _sync_state_);
+        ~CMemoryModelPMALPG() override;
+
+        void edgemap(const std::unique_ptr<analytic::IRelax> & relax) noexcept override;
+
+      protected:
+        void store_edge(const SEdge_t & edge) noexcept override;
+        void store_edges(const std::vector<SEdge_t> & edges) noexcept override;
+        void rm_edges(Id_t src_idx, Id_t dst_idx, std::optional<uint16_t> edge_label_id, std::vector<SEdge_t> & removed) noexcept override;
+        void rm_vertex_edges(Id_t vertex_idx, std::vector<SEdge_t> & removed) noexcept override;
+        void scan_out_edges(Id_t src_idx, std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept override;
+        void scan_in_edges(Id_t dst_idx, std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) noexcept override;
+        void reset_edges() noexcept override;
+        void reserve_vertices(Id_t vertex_c) noexcept override;
+        [[nodiscard]] bool check_if_edge_exists(Id_t src_idx, Id_t dst_idx, uint16_t edge_label_id) noexcept override;
+
+      private:
+        CPackedMemoryArray<false> m_out_edges;
+        CPackedMemoryArray<true> m_in_edges;
+    };
+} // namespace graphquery::database::storage
@@ -0,0 +1,512 @@
+/************************************************************
+ * \author Ryan Skelton
+ * \date 18/09/2023
+ * \file pma.hpp
+ * \brief Packed memory array of edges, holding the adjacency of
+ *        every vertex within one globally sorted array with gaps
+ *        spread between the entries. Inserts shift entries within
+ *        a window of segments, rebalanced once it exceeds its
+ *        density threshold, such that updates are O(log² n)
+ *        amortized whilst scans remain contiguous. Helper class for
+ *        lpg pma memory model.
+ ************************************************************/
+
+#pragma once
+
+#include "db/storage/graph_model.h"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <tuple>
+#include <vector>
+
+namespace graphquery::database::storage
+{
+    template<bool incoming>
+    class CPackedMemoryArray
+    {
+      public:
+        using SEdge_t = ILPGModel::SEdge_t;
+
+        ~CPackedMemoryArray() = default;
+        CPackedMemoryArray();
+        CPackedMemoryArray(const CPackedMemoryArray &)                 = delete;
+        CPackedMemoryArray(CPackedMemoryArray &&) noexcept             = delete;
+        CPackedMemoryArray & operator=(const CPackedMemoryArray &)     = delete;
+        CPackedMemoryArray & operator=(CPackedMemoryArray &&) noexcept = delete;
+
+        void clear() noexcept;
+        void reserve_vertices(Id_t vertex_c) noexcept;
+        bool insert(const SEdge_t & edge) noexcept;
+        void insert_batch(const std::vector<SEdge_t> & edges) noexcept;
+        std::optional<SEdge_t> remove(Id_t vertex, uint16_t edge_label_id, Id_t neighbour) noexcept;
+        void remove_vertex(Id_t vertex, std::vector<SEdge_t> & removed) noexcept;
+        [[nodiscard]] bool contains(Id_t vertex, uint16_t edge_label_id, Id_t neighbour) const noexcept;
+        void scan(Id_t vertex, std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) const noexcept;
+
+        template<typename Func>
+        void foreach_parallel(Func && func) const noexcept;
+
+        [[nodiscard]] size_t get_capacity() const noexcept;
+        [[nodiscard]] size_t get_size() const noexcept;
+
+      private:
+        using Key_t = std::tuple<Id_t, uint16_t, Id_t>;
+
+        [[nodiscard]] static inline Id_t key_vertex(const SEdge_t & edge) noexcept;
+        [[nodiscard]] static inline Key_t key(const SEdge_t & edge) noexcept;
+        [[nodiscard]] inline size_t next_occupied(size_t begin, size_t end) const noexcept;
+        [[nodiscard]] size_t lower_bound(const Key_t & target) const noexcept;
+        [[nodiscard]] double upper_density(uint8_t level) const noexcept;
+        void redistribute(size_t begin, size_t end, std::vector<SEdge_t> & entries) noexcept;
+        void rebuild(std::vector<SEdge_t> & entries) noexcept;
+        void update_offsets(size_t begin, size_t end) noexcept;
+        void release_slot(size_t slot) noexcept;
+
+        size_t m_size         = {};
+        size_t m_capacity     = {};
+        size_t m_segment_size = {};
+        uint8_t m_height      = {};
+
+        std::vector<SEdge_t> m_slots;
+        std::vector<uint8_t> m_occupied;
+        std::vector<uint32_t> m_segment_c;
+        //~ First occupied slot keyed on each vertex or a following vertex, the final entry is the capacity.
+        std::vector<size_t> m_offsets;
+
+        static constexpr size_t MIN_CAPACITY        = 64;
+        static constexpr size_t MIN_SEGMENT_SIZE    = 8;
+        static constexpr double LEAF_UPPER_DENSITY  = 0.92;
+        static constexpr double ROOT_UPPER_DENSITY  = 0.70;
+        static constexpr size_t SHRINK_DENSITY_SHIFT = 3; //~ Shrink once less than an eighth of the array is occupied.
+    };
+} // namespace graphquery::database::storage
+
+template<bool incoming>
+graphquery::database::storage::CPackedMemoryArray<incoming>::CPackedMemoryArray()
+{
+    clear();
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CPackedMemoryArray<incoming>::clear() noexcept
+{
+    const size_t vertex_c = m_offsets.empty() ? 0 : m_offsets.size() - 1;
+    std::vector<SEdge_t> entries = {};
+
+    rebuild(entries);
+    reserve_vertices(vertex_c);
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CPackedMemoryArray<incoming>::reserve_vertices(const Id_t vertex_c) noexcept
+{
+    //~ Vertices appended hold no entries, therefore each is placed at the end of the array.
+    if (vertex_c + 1 > m_offsets.size())
+        m_offsets.resize(vertex_c + 1, m_capacity);
+}
+
+template<bool incoming>
+graphquery::database::storage::Id_t
+graphquery::database::storage::CPackedMemoryArray<incoming>::key_vertex(const SEdge_t & edge) noexcept
+{
+    if constexpr (incoming)
+        return edge.dst;
+    else
+        return edge.src;
+}
+
+template<bool incoming>
+typename graphquery::database::storage::CPackedMemoryArray<incoming>::Key_t
+graphquery::database::storage::CPackedMemoryArray<incoming>::key(const SEdge_t & edge) noexcept
+{
+    if constexpr (incoming)
+        return {edge.dst, edge.edge_label_id, edge.src};
+    else
+        return {edge.src, edge.edge_label_id, edge.dst};
+}
+
+template<bool incoming>
+size_t
+graphquery::database::storage::CPackedMemoryArray<incoming>::next_occupied(size_t begin, const size_t end) const noexcept
+{
+    while (begin < end && !m_occupied[begin])
+        begin++;
+    return begin;
+}
+
+template<bool incoming>
+size_t
+graphquery::database::storage::CPackedMemoryArray<incoming>::lower_bound(const Key_t & target) const noexcept
+{
+    //~ Solely the slots of the vertex are searched, skipping the gaps when probing.
+    const Id_t vertex = std::get<0>(target);
+    size_t begin      = m_offsets[vertex];
+    size_t end        = m_offsets[vertex + 1];
+    size_t ret        = end;
+
+    while (begin < end)
+    {
+        const size_t mid  = begin + (end - begin) / 2;
+        const size_t slot = next_occupied(mid, end);
+
+        if (slot == end)
+            end = mid;
+        else if (key(m_slots[slot]) < target)
+            begin = slot + 1;
+        else
+        {
+            ret = slot;
+            end = mid;
+        }
+    }
+
+    return ret;
+}
+
+template<bool incoming>
+double
+graphquery::database::storage::CPackedMemoryArray<incoming>::upper_density(const uint8_t level) const noexcept
+{
+    if (m_height == 0)
+        return ROOT_UPPER_DENSITY;
+
+    return LEAF_UPPER_DENSITY - (LEAF_UPPER_DENSITY - ROOT_UPPER_DENSITY) * static_cast<double>(level) / static_cast<double>(m_height);
+}
+
+template<bool incoming>
+bool
+graphquery::database::storage::CPackedMemoryArray<incoming>::insert(const SEdge_t & edge) noexcept
+{
+    const Key_t target = key(edge);
+    assert(key_vertex(edge) + 1 < m_offsets.size());
+
+    const size_t slot = lower_bound(target);
+    if (slot < m_capacity && m_occupied[slot] && key(m_slots[slot]) == target)
+        return false;
+
+    //~ Grow the window of segments around the slot, until it holds the entry within its threshold.
+    size_t segment      = std::min(slot, m_capacity - 1) / m_segment_size;
+    size_t window_c     = 1;
+    size_t window_count = m_segment_c[segment];
+    uint8_t level       = 0;
+
+    while (static_cast<double>(window_count + 1) > upper_density(level) * static_cast<double>(window_c * m_segment_size))
+    {
+        if (level == m_height)
+        {
+            std::vector<SEdge_t> entries = {};
+            entries.reserve(m_size + 1);
+
+            for (size_t i = 0; i < m_capacity; i++)
+            {
+                if (m_occupied[i])
+                    entries.emplace_back(m_slots[i]);
+            }
+
+            entries.insert(std::ranges::upper_bound(entries, target, {}, [](const SEdge_t & entry) -> Key_t { return key(entry); }), edge);
+            rebuild(entries);
+            return true;
+        }
+
+        const size_t window_begin = segment & ~(window_c * 2 - 1);
+        window_c *= 2;
+        level++;
+        segment      = window_begin;
+        window_count = 0;
+
+        for (size_t i = window_begin; i < window_begin + window_c; i++)
+            window_count += m_segment_c[i];
+    }
+
+    //~ Gather the window along with the entry, in order, before spreading them evenly.
+    const size_t begin           = segment * m_segment_size;
+    const size_t end             = begin + window_c * m_segment_size;
+    std::vector<SEdge_t> entries = {};
+    entries.reserve(window_count + 1);
+
+    bool stored = false;
+    for (size_t i = begin; i < end; i++)
+    {
+        if (!m_occupied[i])
+            continue;
+
+        if (!stored && target < key(m_slots[i]))
+        {
+            entries.emplace_back(edge);
+            stored = true;
+        }
+        entries.emplace_back(m_slots[i]);
+    }
+
+    if (!stored)
+        entries.emplace_back(edge);
+
+    redistribute(begin, end, entries);
+    return true;
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CPackedMemoryArray<incoming>::insert_batch(const std::vector<SEdge_t> & edges) noexcept
+{
+    //~ Merge the batch with the held entries, laying out the array once rather than per entry.
+    std::vector<SEdge_t> entries = {};
+    entries.reserve(m_size + edges.size());
+
+    for (size_t i = 0; i < m_capacity; i++)
+    {
+        if (m_occupied[i])
+            entries.emplace_back(m_slots[i]);
+    }
+
+    const auto held_c = static_cast<std::ptrdiff_t>(entries.size());
+    entries.insert(entries.end(), edges.begin(), edges.end());
+
+    const auto compare = [](const SEdge_t & lhs, const SEdge_t & rhs) -> bool { return key(lhs) < key(rhs); };
+    std::sort(entries.begin() + held_c, entries.end(), compare);
+    std::inplace_merge(entries.begin(), entries.begin() + held_c, entries.end(), compare);
+
+    const auto [first, last] = std::ranges::unique(entries, [](const SEdge_t & lhs, const SEdge_t & rhs) -> bool { return key(lhs) == key(rhs); });
+    entries.erase(first, last);
+    rebuild(entries);
+}
+
+template<bool incoming>
+std::optional<graphquery::database::storage::ILPGModel::SEdge_t>
+graphquery::database::storage::CPackedMemoryArray<incoming>::remove(const Id_t vertex, const uint16_t edge_label_id, const Id_t neighbour) noexcept
+{
+    if (vertex + 1 >= m_offsets.size())
+        return std::nullopt;
+
+    const Key_t target = {vertex, edge_label_id, neighbour};
+    const size_t slot  = lower_bound(target);
+
+    if (slot >= m_capacity || !m_occupied[slot] || key(m_slots[slot]) != target)
+        return std::nullopt;
+
+    const SEdge_t ret = m_slots[slot];
+    release_slot(slot);
+
+    if (m_capacity > MIN_CAPACITY && m_size < m_capacity >> SHRINK_DENSITY_SHIFT)
+    {
+        std::vector<SEdge_t> entries = {};
+        entries.reserve(m_size);
+
+        for (size_t i = 0; i < m_capacity; i++)
+        {
+            if (m_occupied[i])
+                entries.emplace_back(m_slots[i]);
+        }
+        rebuild(entries);
+    }
+
+    return ret;
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CPackedMemoryArray<incoming>::remove_vertex(const Id_t vertex, std::vector<SEdge_t> & removed) noexcept
+{
+    if (vertex + 1 >= m_offsets.size())
+        return;
+
+    const size_t begin = m_offsets[vertex];
+    const size_t end   = m_offsets[vertex + 1];
+
+    for (size_t i = begin; i < end; i++)
+    {
+        if (!m_occupied[i])
+            continue;
+
+        removed.emplace_back(m_slots[i]);
+        m_occupied[i] = false;
+        m_segment_c[i / m_segment_size]--;
+        m_size--;
+    }
+
+    //~ The vertex and those preceding it without entries now begin where the following vertex does.
+    for (int64_t v = vertex; v >= 0 && m_offsets[v] == begin; v--)
+        m_offsets[v] = end;
+}
+
+template<bool incoming>
+bool
+graphquery::database::storage::CPackedMemoryArray<incoming>::contains(const Id_t vertex, const uint16_t edge_label_id, const Id_t neighbour) const noexcept
+{
+    if (vertex + 1 >= m_offsets.size())
+        return false;
+
+    const Key_t target = {vertex, edge_label_id, neighbour};
+    const size_t slot  = lower_bound(target);
+
+    return slot < m_capacity && m_occupied[slot] && key(m_slots[slot]) == target;
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CPackedMemoryArray<incoming>::scan(const Id_t vertex, const std::optional<uint16_t> edge_label_id, const std::function<void(const SEdge_t &)> & func) const noexcept
+{
+    if (vertex + 1 >= m_offsets.size())
+        return;
+
+    const size_t end = m_offsets[vertex + 1];
+
+    if (!edge_label_id.has_value())
+    {
+        for (size_t i = m_offsets[vertex]; i < end; i++)
+        {
+            if (m_occupied[i])
+                func(m_slots[i]);
+        }
+        return;
+    }
+
+    //~ Entries of a label are contiguous within the slots of the vertex.
+    for (size_t i = lower_bound({vertex, *edge_label_id, 0}); i < end; i++)
+    {
+        if (!m_occupied[i])
+            continue;
+
+        if (m_slots[i].edge_label_id != *edge_label_id)
+            break;
+
+        func(m_slots[i]);
+    }
+}
+
+template<bool incoming>
+template<typename Func>
+void
+graphquery::database::storage::CPackedMemoryArray<incoming>::foreach_parallel(Func && func) const noexcept
+{
+    const auto capacity = static_cast<int64_t>(m_capacity);
+    const auto slots    = m_slots.data();
+    const auto occupied = m_occupied.data();
+
+#pragma omp parallel for default(none) firstprivate(capacity, slots, occupied) shared(func) schedule(static)
+    for (int64_t i = 0; i < capacity; i++)
+    {
+        if (occupied[i])
+            func(slots[i]);
+    }
+}
+
+template<bool incoming>
+size_t
+graphquery::database::storage::CPackedMemoryArray<incoming>::get_capacity() const noexcept
+{
+    return m_capacity;
+}
+
+template<bool incoming>
+size_t
+graphquery::database::storage::CPackedMemoryArray<incoming>::get_size() const noexcept
+{
+    return m_size;
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CPackedMemoryArray<incoming>::redistribute(const size_t begin, const size_t end, std::vector<SEdge_t> & entries) noexcept
+{
+    const size_t window_size = end - begin;
+    const size_t entry_c     = entries.size();
+    size_t window_count      = 0;
+
+    for (size_t i = begin / m_segment_size; i < end / m_segment_size; i++)
+        window_count += m_segment_c[i];
+
+    std::fill(m_occupied.begin() + begin, m_occupied.begin() + end, false);
+    std::fill(m_segment_c.begin() + begin / m_segment_size, m_segment_c.begin() + end / m_segment_size, 0);
+
+    for (size_t i = 0; i < entry_c; i++)
+    {
+        const size_t slot = begin + i * window_size / entry_c;
+        m_slots[slot]     = entries[i];
+        m_occupied[slot]  = true;
+        m_segment_c[slot / m_segment_size]++;
+    }
+
+    m_size = m_size - window_count + entry_c;
+
+    update_offsets(begin, end);
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CPackedMemoryArray<incoming>::rebuild(std::vector<SEdge_t> & entries) noexcept
+{
+    //~ Size the array to be at most half occupied, with segments of about log2 of the capacity.
+    m_capacity     = std::max(MIN_CAPACITY, std::bit_ceil(entries.size() * 2));
+    m_segment_size = std::max(MIN_SEGMENT_SIZE, std::bit_ceil(static_cast<size_t>(std::bit_width(m_capacity))));
+    m_height       = static_cast<uint8_t>(std::bit_width(m_capacity / m_segment_size) - 1);
+    m_size         = 0;
+
+    m_slots.assign(m_capacity, {});
+    m_occupied.assign(m_capacity, false);
+    m_segment_c.assign(m_capacity / m_segment_size, 0);
+
+    redistribute(0, m_capacity, entries);
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CPackedMemoryArray<incoming>::update_offsets(const size_t begin, const size_t end) noexcept
+{
+    if (m_offsets.empty())
+        return;
+
+    const size_t vertex_c = m_offsets.size() - 1;
+    m_offsets[vertex_c]   = m_capacity;
+
+    if (begin == 0 && end == m_capacity)
+        std::fill(m_offsets.begin(), m_offsets.end(), m_capacity);
+
+    const size_t first = next_occupied(begin, end);
+    if (first == end)
+        return;
+
+    //~ Vertices preceding the window without entries before it, now begin at its first entry.
+    for (int64_t v = key_vertex(m_slots[first]); v >= 0 && m_offsets[v] >= begin; v--)
+        m_offsets[v] = first;
+
+    //~ Otherwise, each vertex begins at the first entry of the window keyed on it or a following vertex.
+    int64_t prev_vertex = key_vertex(m_slots[first]);
+    for (size_t i = first + 1; i < end; i++)
+    {
+        if (!m_occupied[i])
+            continue;
+
+        const auto curr_vertex = static_cast<int64_t>(key_vertex(m_slots[i]));
+        for (int64_t v = prev_vertex + 1; v <= curr_vertex; v++)
+            m_offsets[v] = i;
+
+        prev_vertex = curr_vertex;
+    }
+}
+
+template<bool incoming>
+void
+graphquery::database::storage::CPackedMemoryArray<incoming>::release_slot(const size_t slot) noexcept
+{
+    const Id_t vertex = key_vertex(m_slots[slot]);
+
+    m_occupied[slot] = false;
+    m_segment_c[slot / m_segment_size]--;
+    m_size--;
+
+    if (m_offsets[vertex] != slot)
+        return;
+
+    //~ The slot began the vertex, therefore the vertex now begins at its following entry.
+    const size_t next = next_occupied(slot + 1, m_offsets[vertex + 1]);
+    for (int64_t v = vertex; v >= 0 && m_offsets[v] == slot; v--)
+        m_offsets[v] = next;
+}
@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include "models/lpg_lsm/lsm_tree.hpp"
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using CLsmTree_t = graphquery::database::storage::CLsmTree<false>;
+using SEdge_t    = graphquery::database::storage::ILPGModel::SEdge_t;
+using Id_t       = graphquery::database::storage::Id_t;
+
+static SEdge_t
+make_edge(const Id_t src, const uint16_t edge_label_id, const Id_t dst, const Id_t property_id = 0)
+{
+    SEdge_t edge       = {};
+    edge.src           = src;
+    edge.dst           = dst;
+    edge.edge_label_id = edge_label_id;
+    edge.property_id   = property_id;
+    return edge;
+}
+
+static std::vector<Id_t>
+scan_dsts(const CLsmTree_t & tree, const Id_t vertex)
+{
+    std::vector<Id_t> dsts = {};
+    tree.scan(vertex, std::nullopt, [&dsts](const SEdge_t & edge) -> void { dsts.emplace_back(edge.dst); });
+    return dsts;
+}
+
+static void
+wait_for_runs(const CLsmTree_t & tree, const size_t run_c)
+{
+    //~ Compactions run in the background, swapping the merged runs in once done.
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+    while (tree.get_run_count() > run_c && std::chrono::steady_clock::now() < deadline)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+}
+
+GTEST_TEST(lpg_lsm, init)
+{
+    CLsmTree_t tree;
+    ASSERT_EQ(tree.get_run_count(), 0);
+    ASSERT_FALSE(tree.contains(0, 0, 1));
+    ASSERT_TRUE(scan_dsts(tree, 0).empty());
+}
+
+GTEST_TEST(lpg_lsm, insert_memtable)
+{
+    CLsmTree_t tree;
+    tree.insert(make_edge(1, 0, 3));
+    tree.insert(make_edge(1, 0, 2));
+    tree.insert(make_edge(2, 0, 1));
+
+    ASSERT_TRUE(tree.contains(1, 0, 3));
+    ASSERT_EQ(scan_dsts(tree, 1), (std::vector<Id_t> {2, 3}));
+    ASSERT_EQ(tree.get_run_count(), 0);
+}
+
+GTEST_TEST(lpg_lsm, flush)
+{
+    CLsmTree_t tree;
+    tree.insert(make_edge(1, 0, 3));
+    tree.flush();
+
+    ASSERT_EQ(tree.get_run_count(), 1);
+    ASSERT_TRUE(tree.contains(1, 0, 3));
+    ASSERT_EQ(scan_dsts(tree, 1), (std::vector<Id_t> {3}));
+}
+
+GTEST_TEST(lpg_lsm, newest_entry_wins)
+{
+    CLsmTree_t tree;
+    tree.insert(make_edge(1, 0, 3, 10));
+    tree.flush();
+    tree.insert(make_edge(1, 0, 3, 20));
+    tree.flush();
+
+    std::vector<Id_t> property_ids = {};
+    tree.scan(1, 0, [&property_ids](const SEdge_t & edge) -> void { property_ids.emplace_back(edge.property_id); });
+    ASSERT_EQ(property_ids, (std::vector<Id_t> {20}));
+}
+
+GTEST_TEST(lpg_lsm, tombstone_memtable_hides_run)
+{
+    CLsmTree_t tree;
+    tree.insert(make_edge(1, 0, 3));
+    tree.insert(make_edge(1, 0, 4));
+    tree.flush();
+
+    tree.remove(1, 0, 3);
+    ASSERT_FALSE(tree.contains(1, 0, 3));
+    ASSERT_EQ(scan_dsts(tree, 1), (std::vector<Id_t> {4}));
+}
+
+GTEST_TEST(lpg_lsm, tombstone_hides_across_runs)
+{
+    CLsmTree_t tree;
+    tree.insert(make_edge(1, 0, 3));
+    tree.flush();
+    tree.insert(make_edge(1, 0, 5));
+    tree.flush();
+    tree.remove(1, 0, 3);
+    tree.flush();
+
+    ASSERT_EQ(tree.get_run_count(), 3);
+    ASSERT_FALSE(tree.contains(1, 0, 3));
+    ASSERT_EQ(scan_dsts(tree, 1), (std::vector<Id_t> {5}));
+
+    //~ Inserted again, the edge shadows its tombstone in turn.
+    tree.insert(make_edge(1, 0, 3));
+    tree.flush();
+    ASSERT_TRUE(tree.contains(1, 0, 3));
+    ASSERT_EQ(scan_dsts(tree, 1), (std::vector<Id_t> {3, 5}));
+}
+
+GTEST_TEST(lpg_lsm, tombstone_kept_by_partial_compaction)
+{
+    CLsmTree_t tree;
+
+    //~ An oldest run far larger than the rest is left out of the compaction, therefore its edges remain shadowed.
+    std::vector<SEdge_t> batch = {};
+    for (Id_t dst = 0; dst < 4096; dst++)
+        batch.emplace_back(make_edge(0, 0, dst));
+    tree.insert_batch(batch);
+
+    for (Id_t dst = 0; dst < 4; dst++)
+    {
+        tree.remove(0, 0, dst);
+        tree.flush();
+    }
+
+    wait_for_runs(tree, 2);
+    ASSERT_EQ(tree.get_run_count(), 2);
+
+    for (Id_t dst = 0; dst < 4; dst++)
+        ASSERT_FALSE(tree.contains(0, 0, dst));
+
+    const std::vector<Id_t> dsts = scan_dsts(tree, 0);
+    ASSERT_EQ(dsts.size(), 4096 - 4);
+    ASSERT_EQ(dsts.front(), 4);
+}
+
+GTEST_TEST(lpg_lsm, tombstone_dropped_by_full_compaction)
+{
+    CLsmTree_t tree;
+    tree.insert(make_edge(0, 0, 1));
+    tree.insert(make_edge(0, 0, 2));
+    tree.flush();
+
+    tree.remove(0, 0, 1);
+    tree.flush();
+
+    //~ Runs of similar sizes are merged down to one, dropping tombstones that shadow nothing older.
+    for (Id_t dst = 3; dst < 6; dst++)
+    {
+        tree.insert(make_edge(0, 0, dst));
+        tree.flush();
+    }
+
+    wait_for_runs(tree, 1);
+    ASSERT_EQ(tree.get_run_count(), 1);
+    ASSERT_FALSE(tree.contains(0, 0, 1));
+    ASSERT_EQ(scan_dsts(tree, 0), (std::vector<Id_t> {2, 3, 4, 5}));
+
+    tree.insert(make_edge(0, 0, 1));
+    ASSERT_TRUE(tree.contains(0, 0, 1));
+}
+
+GTEST_TEST(lpg_lsm, insert_batch)
+{
+    CLsmTree_t tree;
+    tree.insert(make_edge(2, 0, 1));
+
+    tree.insert_batch({make_edge(2, 1, 4), make_edge(2, 0, 3), make_edge(2, 0, 3)});
+    ASSERT_EQ(tree.get_run_count(), 2);
+    ASSERT_EQ(scan_dsts(tree, 2), (std::vector<Id_t> {1, 3, 4}));
+
+    std::vector<Id_t> dsts = {};
+    tree.scan(2, 1, [&dsts](const SEdge_t & edge) -> void { dsts.emplace_back(edge.dst); });
+    ASSERT_EQ(dsts, (std::vector<Id_t> {4}));
+}
+
+GTEST_TEST(lpg_lsm, clear)
+{
+    CLsmTree_t tree;
+    tree.insert(make_edge(1, 0, 3));
+    tree.flush();
+    tree.insert(make_edge(1, 0, 4));
+
+    tree.clear();
+    ASSERT_EQ(tree.get_run_count(), 0);
+    ASSERT_TRUE(scan_dsts(tree, 1).empty());
+}
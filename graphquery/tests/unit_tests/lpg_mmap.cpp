@@ -0,0 +1,548 @@
+#include <gtest/gtest.h>
+
+#include "models/lpg_mmap/bptree_file.hpp"
+#include "models/lpg_mmap/group_commit.hpp"
+#include "models/lpg_mmap/hash_index_file.hpp"
+#include "models/lpg_mmap/undo_log.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <latch>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
+static constexpr uint32_t undo_inline_c = 4;
+
+struct SUndoTestRecord_t
+{
+    uint32_t id     = {};
+    uint32_t offset = {};
+};
+
+using CUndoLog_t = graphquery::database::storage::CUndoLog<SUndoTestRecord_t, undo_inline_c>;
+
+static std::vector<uint32_t>
+rewind_ids(CUndoLog_t & log)
+{
+    std::vector<uint32_t> ids = {};
+    log.rewind([&ids](const SUndoTestRecord_t & record) -> void { ids.emplace_back(record.id); });
+    return ids;
+}
+
+GTEST_TEST(lpg_mmap_undo_log, init)
+{
+    CUndoLog_t log;
+    ASSERT_EQ(log.size(), 0);
+    ASSERT_TRUE(rewind_ids(log).empty());
+}
+
+GTEST_TEST(lpg_mmap_undo_log, push_inline)
+{
+    CUndoLog_t log;
+    for (uint32_t i = 0; i < undo_inline_c; i++)
+        log.push({i, i * 2});
+
+    ASSERT_EQ(log.size(), undo_inline_c);
+    ASSERT_EQ(rewind_ids(log), (std::vector<uint32_t> {3, 2, 1, 0}));
+}
+
+GTEST_TEST(lpg_mmap_undo_log, push_spill)
+{
+    CUndoLog_t log;
+    for (uint32_t i = 0; i < undo_inline_c * 3; i++)
+        log.push({i, i * 2});
+
+    ASSERT_EQ(log.size(), undo_inline_c * 3);
+
+    //~ Spilled records are the newest, therefore are reverted ahead of those held inline.
+    std::vector<uint32_t> expected = {};
+    for (uint32_t i = undo_inline_c * 3; i > 0; i--)
+        expected.emplace_back(i - 1);
+
+    ASSERT_EQ(rewind_ids(log), expected);
+}
+
+GTEST_TEST(lpg_mmap_undo_log, rewind_records)
+{
+    CUndoLog_t log;
+    for (uint32_t i = 0; i < undo_inline_c + 2; i++)
+        log.push({i, i * 2});
+
+    std::vector<SUndoTestRecord_t> records = {};
+    log.rewind([&records](const SUndoTestRecord_t & record) -> void { records.emplace_back(record); });
+
+    ASSERT_EQ(records.size(), undo_inline_c + 2);
+    for (const auto & record : records)
+        ASSERT_EQ(record.offset, record.id * 2);
+}
+
+GTEST_TEST(lpg_mmap_undo_log, rewind_clears)
+{
+    CUndoLog_t log;
+    for (uint32_t i = 0; i < undo_inline_c + 1; i++)
+        log.push({i, 0});
+
+    (void) rewind_ids(log);
+    ASSERT_EQ(log.size(), 0);
+    ASSERT_TRUE(rewind_ids(log).empty());
+}
+
+GTEST_TEST(lpg_mmap_undo_log, clear)
+{
+    CUndoLog_t log;
+    for (uint32_t i = 0; i < undo_inline_c + 1; i++)
+        log.push({i, 0});
+
+    log.clear();
+    ASSERT_EQ(log.size(), 0);
+
+    //~ Reused once cleared, solely the records pushed since are reverted.
+    log.push({7, 0});
+    log.push({8, 0});
+    ASSERT_EQ(rewind_ids(log), (std::vector<uint32_t> {8, 7}));
+}
+
+static void
+open_commit_file(graphquery::database::storage::CDiskDriver & file, const std::string_view name)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path();
+    std::filesystem::remove(path / name);
+
+    graphquery::database::storage::CDiskDriver::create_file(path, name);
+    file.set_path(path);
+    file.open(name);
+}
+
+static uint32_t
+commit_concurrently(graphquery::database::storage::CGroupCommit & group_commit, const uint32_t thread_c, const uint32_t commit_c)
+{
+    //~ Threads are released together, such that their commits arrive within the same batch.
+    std::latch start(thread_c + 1);
+    std::atomic<uint32_t> committed_c   = 0;
+    std::atomic<uint32_t> not_durable_c = 0;
+    std::vector<std::jthread> threads   = {};
+
+    for (uint32_t i = 0; i < thread_c; i++)
+        threads.emplace_back(
+            [&group_commit, &start, &committed_c, &not_durable_c, commit_c]() -> void
+            {
+                start.arrive_and_wait();
+                for (uint32_t j = 0; j < commit_c; j++)
+                {
+                    //~ The ticket of the commit follows those taken beforehand, therefore it is durable once returned.
+                    const uint64_t ticket = group_commit.get_enqueued_count() + 1;
+                    committed_c += group_commit.commit();
+                    not_durable_c += group_commit.get_durable_count() < ticket;
+                }
+            });
+
+    start.arrive_and_wait();
+    threads.clear();
+
+    EXPECT_EQ(not_durable_c.load(), 0);
+    return committed_c.load();
+}
+
+GTEST_TEST(lpg_mmap_group_commit, commit_stopped)
+{
+    graphquery::database::storage::CDiskDriver file;
+    open_commit_file(file, "group_commit_stopped");
+
+    //~ Without a writer, each commit syncs the file itself.
+    graphquery::database::storage::CGroupCommit group_commit(file, std::chrono::seconds(10), 64);
+    ASSERT_TRUE(group_commit.commit());
+    ASSERT_TRUE(group_commit.commit());
+    ASSERT_EQ(group_commit.get_sync_count(), 2);
+}
+
+GTEST_TEST(lpg_mmap_group_commit, commit_stopped_failed)
+{
+    graphquery::database::storage::CDiskDriver file;
+
+    //~ An unopened file fails to sync, which the commit reports.
+    graphquery::database::storage::CGroupCommit group_commit(file, std::chrono::seconds(10), 64);
+    ASSERT_FALSE(group_commit.commit());
+}
+
+GTEST_TEST(lpg_mmap_group_commit, single_commit)
+{
+    graphquery::database::storage::CDiskDriver file;
+    open_commit_file(file, "group_commit_single");
+
+    graphquery::database::storage::CGroupCommit group_commit(file, std::chrono::milliseconds(10), 64);
+    group_commit.start();
+
+    ASSERT_EQ(commit_concurrently(group_commit, 1, 1), 1);
+    ASSERT_EQ(group_commit.get_sync_count(), 1);
+    ASSERT_GE(group_commit.get_durable_count(), 1);
+}
+
+GTEST_TEST(lpg_mmap_group_commit, batch_shares_sync)
+{
+    graphquery::database::storage::CDiskDriver file;
+    open_commit_file(file, "group_commit_shared");
+
+    graphquery::database::storage::CGroupCommit group_commit(file, std::chrono::milliseconds(200), 64);
+    group_commit.start();
+
+    //~ Commits arriving within the delay are flushed together.
+    ASSERT_EQ(commit_concurrently(group_commit, 8, 1), 8);
+    ASSERT_LT(group_commit.get_sync_count(), 8);
+    ASSERT_GE(group_commit.get_durable_count(), 8);
+}
+
+GTEST_TEST(lpg_mmap_group_commit, full_batch_closes)
+{
+    graphquery::database::storage::CDiskDriver file;
+    open_commit_file(file, "group_commit_full");
+
+    graphquery::database::storage::CGroupCommit group_commit(file, std::chrono::seconds(10), 4);
+    group_commit.start();
+
+    //~ The batch closes once filled rather than once its delay passes, flushing every commit with one sync.
+    ASSERT_EQ(commit_concurrently(group_commit, 4, 1), 4);
+    ASSERT_EQ(group_commit.get_sync_count(), 1);
+    ASSERT_GE(group_commit.get_durable_count(), 4);
+}
+
+GTEST_TEST(lpg_mmap_group_commit, no_delay)
+{
+    graphquery::database::storage::CDiskDriver file;
+    open_commit_file(file, "group_commit_no_delay");
+
+    graphquery::database::storage::CGroupCommit group_commit(file, std::chrono::microseconds(0), 64);
+    group_commit.start();
+
+    //~ Each commit is released, batching solely those arriving during a sync, therefore never more syncs than commits.
+    ASSERT_EQ(commit_concurrently(group_commit, 8, 200), 8 * 200);
+    ASSERT_LE(group_commit.get_sync_count(), 8 * 200);
+    ASSERT_GE(group_commit.get_durable_count(), 8 * 200);
+}
+
+GTEST_TEST(lpg_mmap_group_commit, sync_failed)
+{
+    graphquery::database::storage::CDiskDriver file;
+
+    graphquery::database::storage::CGroupCommit group_commit(file, std::chrono::milliseconds(10), 64);
+    group_commit.start();
+
+    //~ A failed sync fails the commits of its batch and of every later batch.
+    ASSERT_EQ(commit_concurrently(group_commit, 4, 1), 0);
+    ASSERT_FALSE(group_commit.commit());
+}
+
+GTEST_TEST(lpg_mmap_group_commit, stop_releases_commits)
+{
+    graphquery::database::storage::CDiskDriver file;
+    open_commit_file(file, "group_commit_stop");
+
+    graphquery::database::storage::CGroupCommit group_commit(file, std::chrono::seconds(10), 64);
+    group_commit.start();
+
+    //~ Commits held open by the delay are made durable by the stop, rather than waiting it out.
+    std::atomic<uint32_t> committed_c = 0;
+    std::vector<std::jthread> threads = {};
+
+    for (uint32_t i = 0; i < 4; i++)
+        threads.emplace_back([&group_commit, &committed_c]() -> void { committed_c += group_commit.commit(); });
+
+    while (group_commit.get_enqueued_count() < 4)
+        std::this_thread::yield();
+
+    group_commit.stop();
+    threads.clear();
+
+    ASSERT_EQ(committed_c.load(), 4);
+    ASSERT_LT(group_commit.get_sync_count(), 4);
+}
+
+static void
+open_index_file(graphquery::database::storage::CHashIndexFile & index, const std::string_view name)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path();
+    std::filesystem::remove(path / name);
+
+    index.open(path, name, true);
+    index.store_metadata();
+}
+
+GTEST_TEST(lpg_mmap_hash_index, unopened)
+{
+    graphquery::database::storage::CHashIndexFile index;
+    ASSERT_FALSE(index.store_entry(1, 1));
+}
+
+GTEST_TEST(lpg_mmap_hash_index, insert_lookup)
+{
+    graphquery::database::storage::CHashIndexFile index;
+    open_index_file(index, "hash_index_lookup");
+
+    for (uint64_t key = 0; key < 100; key++)
+        ASSERT_TRUE(index.store_entry(key * 7919, static_cast<graphquery::database::storage::Id_t>(key)));
+
+    ASSERT_EQ(index.size(), 100);
+    for (uint64_t key = 0; key < 100; key++)
+        ASSERT_EQ(index.lookup(key * 7919), key);
+
+    ASSERT_FALSE(index.lookup(1).has_value());
+}
+
+GTEST_TEST(lpg_mmap_hash_index, insert_duplicate)
+{
+    graphquery::database::storage::CHashIndexFile index;
+    open_index_file(index, "hash_index_duplicate");
+
+    ASSERT_TRUE(index.store_entry(42, 1));
+    ASSERT_FALSE(index.store_entry(42, 2));
+    ASSERT_EQ(index.lookup(42), 1);
+    ASSERT_EQ(index.size(), 1);
+}
+
+GTEST_TEST(lpg_mmap_hash_index, remove)
+{
+    graphquery::database::storage::CHashIndexFile index;
+    open_index_file(index, "hash_index_remove");
+
+    for (uint64_t key = 0; key < 200; key++)
+        index.store_entry(key, static_cast<graphquery::database::storage::Id_t>(key));
+
+    for (uint64_t key = 0; key < 200; key += 2)
+        ASSERT_TRUE(index.remove(key));
+
+    ASSERT_FALSE(index.remove(0));
+    ASSERT_EQ(index.size(), 100);
+
+    //~ Tombstones left by the removals continue the probe, therefore keys stored past them remain reachable.
+    for (uint64_t key = 0; key < 200; key++)
+        ASSERT_EQ(index.lookup(key).has_value(), key % 2 == 1);
+}
+
+GTEST_TEST(lpg_mmap_hash_index, reinsert_tombstone)
+{
+    graphquery::database::storage::CHashIndexFile index;
+    open_index_file(index, "hash_index_reinsert");
+
+    ASSERT_TRUE(index.store_entry(9, 1));
+    ASSERT_TRUE(index.remove(9));
+    ASSERT_FALSE(index.lookup(9).has_value());
+
+    ASSERT_TRUE(index.store_entry(9, 2));
+    ASSERT_EQ(index.lookup(9), 2);
+    ASSERT_EQ(index.size(), 1);
+
+    ASSERT_TRUE(index.remove(9));
+    ASSERT_EQ(index.size(), 0);
+}
+
+GTEST_TEST(lpg_mmap_hash_index, multi_entry)
+{
+    graphquery::database::storage::CHashIndexFile index;
+    open_index_file(index, "hash_index_multi");
+
+    ASSERT_TRUE(index.store_multi_entry(5, 1));
+    ASSERT_TRUE(index.store_multi_entry(5, 2));
+    ASSERT_FALSE(index.store_multi_entry(5, 2));
+
+    std::vector<graphquery::database::storage::Id_t> offsets = index.lookup_all(5);
+    std::ranges::sort(offsets);
+    ASSERT_EQ(offsets, (std::vector<graphquery::database::storage::Id_t> {1, 2}));
+
+    ASSERT_TRUE(index.remove(5, 1));
+    ASSERT_EQ(index.lookup_all(5), (std::vector<graphquery::database::storage::Id_t> {2}));
+}
+
+GTEST_TEST(lpg_mmap_hash_index, resize_concurrent_inserts)
+{
+    graphquery::database::storage::CHashIndexFile index;
+    open_index_file(index, "hash_index_resize");
+
+    static constexpr uint32_t thread_c = 4;
+    static constexpr uint64_t key_c    = 4096;
+
+    const uint64_t initial_capacity = index.read_metadata()->capacity[0];
+    std::atomic<uint32_t> stored_c  = 0;
+
+    {
+        //~ Each thread stores its own keys, such that the table is resized repeatedly whilst others probe it.
+        std::latch start(thread_c);
+        std::vector<std::jthread> threads = {};
+
+        for (uint32_t i = 0; i < thread_c; i++)
+            threads.emplace_back(
+                [&index, &start, &stored_c, i]() -> void
+                {
+                    start.arrive_and_wait();
+                    for (uint64_t key = i; key < key_c; key += thread_c)
+                        stored_c += index.store_entry(key, static_cast<graphquery::database::storage::Id_t>(key + 1));
+                });
+    }
+
+    ASSERT_EQ(stored_c.load(), key_c);
+    ASSERT_EQ(index.size(), key_c);
+
+    {
+        auto metadata = index.read_metadata();
+        ASSERT_GT(metadata->capacity[metadata->active], initial_capacity);
+        ASSERT_LE(metadata->used_c * 2, metadata->capacity[metadata->active]);
+    }
+
+    for (uint64_t key = 0; key < key_c; key++)
+        ASSERT_EQ(index.lookup(key), key + 1);
+}
+
+using BPTreeEntry_t = std::pair<int64_t, graphquery::database::storage::Id_t>;
+
+static void
+open_bptree_file(graphquery::database::storage::CBPTreeFile & tree, const std::string_view name)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path();
+    std::filesystem::remove(path / name);
+
+    tree.open(path, name, true);
+    tree.store_metadata();
+}
+
+static std::vector<BPTreeEntry_t>
+range_entries(graphquery::database::storage::CBPTreeFile & tree, const int64_t lower, const int64_t upper)
+{
+    std::vector<BPTreeEntry_t> entries = {};
+    tree.range(lower, upper, [&entries](const int64_t value, const graphquery::database::storage::Id_t offset) -> void { entries.emplace_back(value, offset); });
+    return entries;
+}
+
+static std::vector<BPTreeEntry_t>
+expected_entries(const std::set<BPTreeEntry_t> & expected, const int64_t lower, const int64_t upper)
+{
+    return {expected.lower_bound({lower, 0}), expected.upper_bound({upper, std::numeric_limits<graphquery::database::storage::Id_t>::max()})};
+}
+
+GTEST_TEST(lpg_mmap_bptree, init)
+{
+    graphquery::database::storage::CBPTreeFile tree;
+    open_bptree_file(tree, "bptree_init");
+
+    ASSERT_EQ(tree.size(), 0);
+    ASSERT_FALSE(tree.remove(0, 0));
+    ASSERT_TRUE(range_entries(tree, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max()).empty());
+}
+
+GTEST_TEST(lpg_mmap_bptree, insert_range)
+{
+    graphquery::database::storage::CBPTreeFile tree;
+    open_bptree_file(tree, "bptree_range");
+
+    for (const int64_t value : {5, -3, 12, 0, 7})
+        tree.insert(value, static_cast<graphquery::database::storage::Id_t>(value + 3));
+
+    ASSERT_EQ(tree.size(), 5);
+    ASSERT_EQ(range_entries(tree, -3, 7), (std::vector<BPTreeEntry_t> {{-3, 0}, {0, 3}, {5, 8}, {7, 10}}));
+    ASSERT_EQ(range_entries(tree, 6, 6), (std::vector<BPTreeEntry_t> {}));
+    ASSERT_TRUE(range_entries(tree, 7, 5).empty());
+}
+
+GTEST_TEST(lpg_mmap_bptree, equal_values)
+{
+    graphquery::database::storage::CBPTreeFile tree;
+    open_bptree_file(tree, "bptree_equal");
+
+    //~ Equal values of several payloads are kept apart by their offset, whereas a repeated pair is ignored.
+    tree.insert(4, 2);
+    tree.insert(4, 1);
+    tree.insert(4, 2);
+
+    ASSERT_EQ(tree.size(), 2);
+    ASSERT_EQ(range_entries(tree, 4, 4), (std::vector<BPTreeEntry_t> {{4, 1}, {4, 2}}));
+}
+
+GTEST_TEST(lpg_mmap_bptree, split)
+{
+    graphquery::database::storage::CBPTreeFile tree;
+    open_bptree_file(tree, "bptree_split");
+    std::set<BPTreeEntry_t> expected = {};
+
+    //~ Enough entries to split leaves and inner nodes, raising the tree by several levels.
+    std::vector<int64_t> values(BPTREE_NODE_ORDER * BPTREE_NODE_ORDER * 2);
+    std::iota(values.begin(), values.end(), -static_cast<int64_t>(values.size() / 2));
+    std::ranges::shuffle(values, std::mt19937(7));
+
+    for (const int64_t value : values)
+    {
+        tree.insert(value, static_cast<graphquery::database::storage::Id_t>(value & 0xff));
+        expected.emplace(value, static_cast<graphquery::database::storage::Id_t>(value & 0xff));
+    }
+
+    ASSERT_GE(tree.read_metadata()->height, 3);
+    ASSERT_EQ(tree.size(), static_cast<int64_t>(expected.size()));
+    ASSERT_EQ(range_entries(tree, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max()), expected_entries(expected, std::numeric_limits<int64_t>::min(), std::numeric_limits<int64_t>::max()));
+    ASSERT_EQ(range_entries(tree, -100, 1000), expected_entries(expected, -100, 1000));
+}
+
+GTEST_TEST(lpg_mmap_bptree, remove)
+{
+    graphquery::database::storage::CBPTreeFile tree;
+    open_bptree_file(tree, "bptree_remove");
+    std::set<BPTreeEntry_t> expected = {};
+
+    for (int64_t value = 0; value < BPTREE_NODE_ORDER * 16; value++)
+    {
+        tree.insert(value, 0);
+        expected.emplace(value, 0);
+    }
+
+    //~ Whole leaves are emptied, which range reads must step over to the following leaf.
+    for (int64_t value = BPTREE_NODE_ORDER; value < BPTREE_NODE_ORDER * 8; value++)
+    {
+        ASSERT_TRUE(tree.remove(value, 0));
+        expected.erase({value, 0});
+    }
+
+    ASSERT_FALSE(tree.remove(BPTREE_NODE_ORDER, 0));
+    ASSERT_FALSE(tree.remove(0, 1));
+    ASSERT_EQ(tree.size(), static_cast<int64_t>(expected.size()));
+    ASSERT_EQ(range_entries(tree, 0, BPTREE_NODE_ORDER * 16), expected_entries(expected, 0, BPTREE_NODE_ORDER * 16));
+    ASSERT_EQ(range_entries(tree, BPTREE_NODE_ORDER * 2, BPTREE_NODE_ORDER * 9), expected_entries(expected, BPTREE_NODE_ORDER * 2, BPTREE_NODE_ORDER * 9));
+
+    //~ Removed keys may be stored again within their emptied leaves.
+    tree.insert(BPTREE_NODE_ORDER * 4, 3);
+    expected.emplace(BPTREE_NODE_ORDER * 4, 3);
+    ASSERT_EQ(range_entries(tree, 0, BPTREE_NODE_ORDER * 16), expected_entries(expected, 0, BPTREE_NODE_ORDER * 16));
+}
+
+GTEST_TEST(lpg_mmap_bptree, random_operations)
+{
+    graphquery::database::storage::CBPTreeFile tree;
+    open_bptree_file(tree, "bptree_random");
+    std::set<BPTreeEntry_t> expected = {};
+    std::mt19937 rng(42);
+
+    for (int i = 0; i < 20000; i++)
+    {
+        const int64_t value = static_cast<int64_t>(rng() % 2048) - 1024;
+        const auto offset   = static_cast<graphquery::database::storage::Id_t>(rng() % 4);
+
+        if (rng() % 3 != 0)
+        {
+            tree.insert(value, offset);
+            expected.emplace(value, offset);
+        }
+        else
+            ASSERT_EQ(tree.remove(value, offset), expected.erase({value, offset}) == 1);
+
+        if (i % 1000 == 0)
+        {
+            const int64_t lower = static_cast<int64_t>(rng() % 2048) - 1024;
+            ASSERT_EQ(range_entries(tree, lower, lower + 256), expected_entries(expected, lower, lower + 256));
+        }
+    }
+
+    ASSERT_EQ(tree.size(), static_cast<int64_t>(expected.size()));
+    ASSERT_EQ(range_entries(tree, -1024, 1024), expected_entries(expected, -1024, 1024));
+}
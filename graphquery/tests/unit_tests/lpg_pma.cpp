@@ -0,0 +1,260 @@
+#include <gtest/gtest.h>
+
+#include "models/lpg_pma/pma.hpp"
+
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+using CPackedMemoryArray_t = graphquery::database::storage::CPackedMemoryArray<false>;
+using SEdge_t              = graphquery::database::storage::ILPGModel::SEdge_t;
+using Id_t                 = graphquery::database::storage::Id_t;
+using Key_t                = std::tuple<Id_t, uint16_t, Id_t>;
+
+static constexpr Id_t vertex_c = 64;
+
+static SEdge_t
+make_edge(const Id_t src, const uint16_t edge_label_id, const Id_t dst)
+{
+    SEdge_t edge       = {};
+    edge.src           = src;
+    edge.dst           = dst;
+    edge.edge_label_id = edge_label_id;
+    edge.property_id   = src * vertex_c + dst;
+    return edge;
+}
+
+static std::vector<Key_t>
+scan_keys(const CPackedMemoryArray_t & pma, const Id_t vertex)
+{
+    std::vector<Key_t> keys = {};
+    pma.scan(vertex, std::nullopt, [&keys](const SEdge_t & edge) -> void { keys.emplace_back(edge.src, edge.edge_label_id, edge.dst); });
+    return keys;
+}
+
+static void
+expect_matches(const CPackedMemoryArray_t & pma, const std::set<Key_t> & expected)
+{
+    ASSERT_EQ(pma.get_size(), expected.size());
+
+    for (Id_t v = 0; v < vertex_c; v++)
+    {
+        const std::vector<Key_t> keys = scan_keys(pma, v);
+        const std::vector<Key_t> held(expected.lower_bound({v, 0, 0}), expected.lower_bound({v + 1, 0, 0}));
+        ASSERT_EQ(keys, held) << "vertex " << v;
+    }
+}
+
+GTEST_TEST(lpg_pma, init)
+{
+    CPackedMemoryArray_t pma;
+    pma.reserve_vertices(vertex_c);
+    ASSERT_EQ(pma.get_size(), 0);
+    ASSERT_GE(pma.get_capacity(), 64);
+    ASSERT_TRUE(scan_keys(pma, 0).empty());
+}
+
+GTEST_TEST(lpg_pma, insert_sorted)
+{
+    CPackedMemoryArray_t pma;
+    pma.reserve_vertices(vertex_c);
+
+    ASSERT_TRUE(pma.insert(make_edge(3, 1, 7)));
+    ASSERT_TRUE(pma.insert(make_edge(3, 0, 9)));
+    ASSERT_TRUE(pma.insert(make_edge(3, 1, 2)));
+    ASSERT_TRUE(pma.insert(make_edge(1, 0, 4)));
+
+    const std::vector<Key_t> keys = scan_keys(pma, 3);
+    ASSERT_EQ(keys, (std::vector<Key_t> {{3, 0, 9}, {3, 1, 2}, {3, 1, 7}}));
+    ASSERT_TRUE(pma.contains(1, 0, 4));
+    ASSERT_FALSE(pma.contains(1, 0, 5));
+}
+
+GTEST_TEST(lpg_pma, insert_duplicate)
+{
+    CPackedMemoryArray_t pma;
+    pma.reserve_vertices(vertex_c);
+
+    ASSERT_TRUE(pma.insert(make_edge(2, 0, 5)));
+    ASSERT_FALSE(pma.insert(make_edge(2, 0, 5)));
+    ASSERT_EQ(pma.get_size(), 1);
+}
+
+GTEST_TEST(lpg_pma, scan_label)
+{
+    CPackedMemoryArray_t pma;
+    pma.reserve_vertices(vertex_c);
+
+    for (Id_t dst = 0; dst < 10; dst++)
+        pma.insert(make_edge(5, static_cast<uint16_t>(dst % 3), dst));
+
+    std::vector<Id_t> dsts = {};
+    pma.scan(5, 1, [&dsts](const SEdge_t & edge) -> void { dsts.emplace_back(edge.dst); });
+    ASSERT_EQ(dsts, (std::vector<Id_t> {1, 4, 7}));
+}
+
+GTEST_TEST(lpg_pma, rebalance)
+{
+    CPackedMemoryArray_t pma;
+    pma.reserve_vertices(vertex_c);
+    std::set<Key_t> expected = {};
+
+    //~ Inserting into a single vertex overflows its segment repeatedly, forcing windows to rebalance and the array to grow.
+    const size_t initial_capacity = pma.get_capacity();
+    for (Id_t dst = vertex_c; dst-- > 0;)
+    {
+        ASSERT_TRUE(pma.insert(make_edge(10, 0, dst)));
+        expected.emplace(10, 0, dst);
+    }
+
+    ASSERT_GT(pma.get_capacity(), initial_capacity);
+    ASSERT_LE(pma.get_size() * 2, pma.get_capacity());
+    expect_matches(pma, expected);
+}
+
+GTEST_TEST(lpg_pma, insert_batch)
+{
+    CPackedMemoryArray_t pma;
+    pma.reserve_vertices(vertex_c);
+    std::set<Key_t> expected = {};
+
+    pma.insert(make_edge(4, 0, 1));
+    expected.emplace(4, 0, 1);
+
+    std::vector<SEdge_t> batch = {};
+    for (Id_t v = 0; v < vertex_c; v += 3)
+    {
+        batch.emplace_back(make_edge(v, 0, vertex_c - v - 1));
+        expected.emplace(v, 0, vertex_c - v - 1);
+    }
+    batch.emplace_back(make_edge(4, 0, 1));
+
+    pma.insert_batch(batch);
+    expect_matches(pma, expected);
+}
+
+GTEST_TEST(lpg_pma, remove)
+{
+    CPackedMemoryArray_t pma;
+    pma.reserve_vertices(vertex_c);
+
+    pma.insert(make_edge(6, 0, 1));
+    pma.insert(make_edge(6, 0, 2));
+
+    const auto removed = pma.remove(6, 0, 1);
+    ASSERT_TRUE(removed.has_value());
+    ASSERT_EQ(removed->property_id, 6 * vertex_c + 1);
+    ASSERT_FALSE(pma.remove(6, 0, 1).has_value());
+    ASSERT_EQ(scan_keys(pma, 6), (std::vector<Key_t> {{6, 0, 2}}));
+}
+
+GTEST_TEST(lpg_pma, remove_first_entry_offsets)
+{
+    CPackedMemoryArray_t pma;
+    pma.reserve_vertices(vertex_c);
+    std::set<Key_t> expected = {};
+
+    //~ Vertices 1 and 2 hold no entries, therefore begin where vertex 3 does, as does vertex 3 once its first entry is released.
+    for (const Key_t & k : {Key_t {0, 0, 1}, Key_t {3, 0, 1}, Key_t {3, 0, 2}, Key_t {5, 0, 1}})
+    {
+        pma.insert(make_edge(std::get<0>(k), std::get<1>(k), std::get<2>(k)));
+        expected.emplace(k);
+    }
+
+    pma.remove(3, 0, 1);
+    expected.erase({3, 0, 1});
+    expect_matches(pma, expected);
+
+    pma.remove(3, 0, 2);
+    expected.erase({3, 0, 2});
+    expect_matches(pma, expected);
+
+    //~ Inserts into the emptied vertex and those preceding it land between their neighbours.
+    for (const Key_t & k : {Key_t {2, 0, 9}, Key_t {3, 0, 8}, Key_t {1, 0, 7}})
+    {
+        ASSERT_TRUE(pma.insert(make_edge(std::get<0>(k), std::get<1>(k), std::get<2>(k))));
+        expected.emplace(k);
+    }
+    expect_matches(pma, expected);
+}
+
+GTEST_TEST(lpg_pma, remove_vertex_offsets)
+{
+    CPackedMemoryArray_t pma;
+    pma.reserve_vertices(vertex_c);
+    std::set<Key_t> expected = {};
+
+    for (const Key_t & k : {Key_t {1, 0, 1}, Key_t {4, 0, 1}, Key_t {4, 1, 2}, Key_t {4, 2, 3}, Key_t {7, 0, 1}})
+    {
+        pma.insert(make_edge(std::get<0>(k), std::get<1>(k), std::get<2>(k)));
+        expected.emplace(k);
+    }
+
+    std::vector<SEdge_t> removed = {};
+    pma.remove_vertex(4, removed);
+    ASSERT_EQ(removed.size(), 3);
+
+    for (const SEdge_t & edge : removed)
+        expected.erase({edge.src, edge.edge_label_id, edge.dst});
+    expect_matches(pma, expected);
+
+    //~ Vertices emptied ahead of vertex 4 must not reach into the entries of vertex 7.
+    ASSERT_TRUE(pma.insert(make_edge(3, 0, 5)));
+    ASSERT_TRUE(pma.insert(make_edge(4, 0, 6)));
+    expected.emplace(3, 0, 5);
+    expected.emplace(4, 0, 6);
+    expect_matches(pma, expected);
+}
+
+GTEST_TEST(lpg_pma, shrink)
+{
+    CPackedMemoryArray_t pma;
+    pma.reserve_vertices(vertex_c);
+
+    for (Id_t v = 0; v < vertex_c; v++)
+        for (Id_t dst = 0; dst < 8; dst++)
+            pma.insert(make_edge(v, 0, dst));
+
+    const size_t grown_capacity = pma.get_capacity();
+    for (Id_t v = 0; v < vertex_c; v++)
+        for (Id_t dst = 0; dst < 8; dst++)
+            pma.remove(v, 0, dst);
+
+    ASSERT_EQ(pma.get_size(), 0);
+    ASSERT_LT(pma.get_capacity(), grown_capacity);
+    ASSERT_TRUE(scan_keys(pma, 0).empty());
+}
+
+GTEST_TEST(lpg_pma, random_operations)
+{
+    CPackedMemoryArray_t pma;
+    pma.reserve_vertices(vertex_c);
+    std::set<Key_t> expected = {};
+    std::mt19937 rng(42);
+
+    for (int i = 0; i < 20000; i++)
+    {
+        const Id_t src    = rng() % vertex_c;
+        const auto label  = static_cast<uint16_t>(rng() % 3);
+        const Id_t dst    = rng() % vertex_c;
+        const uint32_t op = rng() % 10;
+
+        if (op < 6)
+            ASSERT_EQ(pma.insert(make_edge(src, label, dst)), expected.emplace(src, label, dst).second);
+        else if (op < 9)
+            ASSERT_EQ(pma.remove(src, label, dst).has_value(), expected.erase({src, label, dst}) == 1);
+        else
+        {
+            std::vector<SEdge_t> removed = {};
+            pma.remove_vertex(src, removed);
+            ASSERT_EQ(removed.size(), static_cast<size_t>(std::distance(expected.lower_bound({src, 0, 0}), expected.lower_bound({src + 1, 0, 0}))));
+            expected.erase(expected.lower_bound({src, 0, 0}), expected.lower_bound({src + 1, 0, 0}));
+        }
+
+        if (i % 500 == 0)
+            expect_matches(pma, expected);
+    }
+
+    expect_matches(pma, expected);
+}
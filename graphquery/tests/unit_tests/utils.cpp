@@ -3,6 +3,7 @@
 #include "fmt/include/fmt/format.h"
 #include "db/system.h"
 #include "db/utils/bitset.hpp"
+#include "db/utils/lib.h"
 #include "db/utils/ring_buffer.hpp"
 #include "db/utils/sliding_queue.hpp"
 
@@ -90,3 +91,33 @@ GTEST_TEST(utils_queue, slide_window)
     ASSERT_EQ(tmp.size(), 1);
     ASSERT_EQ(*tmp.begin(), 10);
 }
+
+GTEST_TEST(utils_parse_date, epoch)
+{
+    ASSERT_EQ(graphquery::database::utils::parse_date("1266161530447"), 1266161530447);
+}
+
+GTEST_TEST(utils_parse_date, date)
+{
+    ASSERT_EQ(graphquery::database::utils::parse_date("2010-02-14"), 1266105600000);
+    ASSERT_EQ(graphquery::database::utils::parse_date("2010-02-14T15:32:10"), 1266161530000);
+    ASSERT_EQ(graphquery::database::utils::parse_date("2010-02-14T15:32:10.447"), 1266161530447);
+}
+
+GTEST_TEST(utils_parse_date, zone)
+{
+    ASSERT_EQ(graphquery::database::utils::parse_date("2010-02-14T15:32:10.447+0000"), 1266161530447);
+    ASSERT_EQ(graphquery::database::utils::parse_date("2010-02-14T15:32:10.447Z"), 1266161530447);
+    ASSERT_EQ(graphquery::database::utils::parse_date("2010-02-14T16:32:10.447+01:00"), 1266161530447);
+    ASSERT_EQ(graphquery::database::utils::parse_date("2010-02-14T14:32:10.447-0100"), 1266161530447);
+}
+
+GTEST_TEST(utils_parse_date, reject_partial)
+{
+    ASSERT_FALSE(graphquery::database::utils::parse_date("2010-02-14x").has_value());
+    ASSERT_FALSE(graphquery::database::utils::parse_date("2010-02-14T15").has_value());
+    ASSERT_FALSE(graphquery::database::utils::parse_date("2010-02-14T15:32:10.").has_value());
+    ASSERT_FALSE(graphquery::database::utils::parse_date("2010-02-14T15:32:10.447+00").has_value());
+    ASSERT_FALSE(graphquery::database::utils::parse_date("2010-02-30").has_value());
+    ASSERT_FALSE(graphquery::database::utils::parse_date("1266161530447ms").has_value());
+}